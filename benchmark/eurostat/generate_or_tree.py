@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+"""
+Generate the query of the 'or_tree' benchmark: an EUROSTAT_Read filtered by a large OR tree of (geo, age) pairs,
+taken from the contentconstraint of DEMO_R_D2JAN in the docs folder.
+
+Usage: python3 benchmark/eurostat/generate_or_tree.py [branch_count] > benchmark/eurostat/or_tree.sql
+
+The generated file is versioned, run it again when the contentconstraint in the docs folder changes.
+"""
+
+import os
+import re
+import sys
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+CONSTRAINT_FILE = os.path.join(ROOT_DIR, "docs", "DEMO_R_D2JAN---contentconstraint.xml")
+
+
+def get_codes(document, dimension):
+    """Returns the codes of a dimension of the contentconstraint."""
+    match = re.search(r'<c:KeyValue id="%s">(.*?)</c:KeyValue>' % dimension, document, re.S)
+    return re.findall(r"<c:Value>([^<]+)</c:Value>", match.group(1)) if match else []
+
+
+def main():
+    branch_count = int(sys.argv[1]) if len(sys.argv) > 1 else 5000
+
+    with open(CONSTRAINT_FILE, encoding="utf-8") as stream:
+        document = stream.read()
+
+    geo_codes = get_codes(document, "geo")
+    age_codes = get_codes(document, "age")
+    branches = []
+
+    for index in range(branch_count):
+        geo = geo_codes[index % len(geo_codes)]
+        age = age_codes[(index // len(geo_codes)) % len(age_codes)]
+        branches.append("(geo = '%s' AND age = '%s')" % (geo, age))
+
+    print("EXPLAIN SELECT count(*) FROM EUROSTAT_Read('ESTAT', 'DEMO_R_D2JAN') WHERE sex = 'T' AND (")
+    print("\n OR ".join(branches))
+    print(");")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,5002 @@
+EXPLAIN SELECT count(*) FROM EUROSTAT_Read('ESTAT', 'DEMO_R_D2JAN') WHERE sex = 'T' AND (
+(geo = 'EU27_2020' AND age = 'TOTAL')
+ OR (geo = 'EU28' AND age = 'TOTAL')
+ OR (geo = 'EU27_2007' AND age = 'TOTAL')
+ OR (geo = 'BE' AND age = 'TOTAL')
+ OR (geo = 'BE1' AND age = 'TOTAL')
+ OR (geo = 'BE10' AND age = 'TOTAL')
+ OR (geo = 'BE2' AND age = 'TOTAL')
+ OR (geo = 'BE21' AND age = 'TOTAL')
+ OR (geo = 'BE22' AND age = 'TOTAL')
+ OR (geo = 'BE23' AND age = 'TOTAL')
+ OR (geo = 'BE24' AND age = 'TOTAL')
+ OR (geo = 'BE25' AND age = 'TOTAL')
+ OR (geo = 'BE3' AND age = 'TOTAL')
+ OR (geo = 'BE31' AND age = 'TOTAL')
+ OR (geo = 'BE32' AND age = 'TOTAL')
+ OR (geo = 'BE33' AND age = 'TOTAL')
+ OR (geo = 'BE34' AND age = 'TOTAL')
+ OR (geo = 'BE35' AND age = 'TOTAL')
+ OR (geo = 'BG' AND age = 'TOTAL')
+ OR (geo = 'BG3' AND age = 'TOTAL')
+ OR (geo = 'BG31' AND age = 'TOTAL')
+ OR (geo = 'BG32' AND age = 'TOTAL')
+ OR (geo = 'BG33' AND age = 'TOTAL')
+ OR (geo = 'BG34' AND age = 'TOTAL')
+ OR (geo = 'BG4' AND age = 'TOTAL')
+ OR (geo = 'BG41' AND age = 'TOTAL')
+ OR (geo = 'BG42' AND age = 'TOTAL')
+ OR (geo = 'CZ' AND age = 'TOTAL')
+ OR (geo = 'CZ0' AND age = 'TOTAL')
+ OR (geo = 'CZ01' AND age = 'TOTAL')
+ OR (geo = 'CZ02' AND age = 'TOTAL')
+ OR (geo = 'CZ03' AND age = 'TOTAL')
+ OR (geo = 'CZ04' AND age = 'TOTAL')
+ OR (geo = 'CZ05' AND age = 'TOTAL')
+ OR (geo = 'CZ06' AND age = 'TOTAL')
+ OR (geo = 'CZ07' AND age = 'TOTAL')
+ OR (geo = 'CZ08' AND age = 'TOTAL')
+ OR (geo = 'DK' AND age = 'TOTAL')
+ OR (geo = 'DK0' AND age = 'TOTAL')
+ OR (geo = 'DK01' AND age = 'TOTAL')
+ OR (geo = 'DK02' AND age = 'TOTAL')
+ OR (geo = 'DK03' AND age = 'TOTAL')
+ OR (geo = 'DK04' AND age = 'TOTAL')
+ OR (geo = 'DK05' AND age = 'TOTAL')
+ OR (geo = 'DE' AND age = 'TOTAL')
+ OR (geo = 'DE_TOT' AND age = 'TOTAL')
+ OR (geo = 'DE1' AND age = 'TOTAL')
+ OR (geo = 'DE11' AND age = 'TOTAL')
+ OR (geo = 'DE12' AND age = 'TOTAL')
+ OR (geo = 'DE13' AND age = 'TOTAL')
+ OR (geo = 'DE14' AND age = 'TOTAL')
+ OR (geo = 'DE2' AND age = 'TOTAL')
+ OR (geo = 'DE21' AND age = 'TOTAL')
+ OR (geo = 'DE22' AND age = 'TOTAL')
+ OR (geo = 'DE23' AND age = 'TOTAL')
+ OR (geo = 'DE24' AND age = 'TOTAL')
+ OR (geo = 'DE25' AND age = 'TOTAL')
+ OR (geo = 'DE26' AND age = 'TOTAL')
+ OR (geo = 'DE27' AND age = 'TOTAL')
+ OR (geo = 'DE3' AND age = 'TOTAL')
+ OR (geo = 'DE30' AND age = 'TOTAL')
+ OR (geo = 'DE4' AND age = 'TOTAL')
+ OR (geo = 'DE40' AND age = 'TOTAL')
+ OR (geo = 'DE5' AND age = 'TOTAL')
+ OR (geo = 'DE50' AND age = 'TOTAL')
+ OR (geo = 'DE6' AND age = 'TOTAL')
+ OR (geo = 'DE60' AND age = 'TOTAL')
+ OR (geo = 'DE7' AND age = 'TOTAL')
+ OR (geo = 'DE71' AND age = 'TOTAL')
+ OR (geo = 'DE72' AND age = 'TOTAL')
+ OR (geo = 'DE73' AND age = 'TOTAL')
+ OR (geo = 'DE8' AND age = 'TOTAL')
+ OR (geo = 'DE80' AND age = 'TOTAL')
+ OR (geo = 'DE9' AND age = 'TOTAL')
+ OR (geo = 'DE91' AND age = 'TOTAL')
+ OR (geo = 'DE92' AND age = 'TOTAL')
+ OR (geo = 'DE93' AND age = 'TOTAL')
+ OR (geo = 'DE94' AND age = 'TOTAL')
+ OR (geo = 'DEA' AND age = 'TOTAL')
+ OR (geo = 'DEA1' AND age = 'TOTAL')
+ OR (geo = 'DEA2' AND age = 'TOTAL')
+ OR (geo = 'DEA3' AND age = 'TOTAL')
+ OR (geo = 'DEA4' AND age = 'TOTAL')
+ OR (geo = 'DEA5' AND age = 'TOTAL')
+ OR (geo = 'DEB' AND age = 'TOTAL')
+ OR (geo = 'DEB1' AND age = 'TOTAL')
+ OR (geo = 'DEB2' AND age = 'TOTAL')
+ OR (geo = 'DEB3' AND age = 'TOTAL')
+ OR (geo = 'DEC' AND age = 'TOTAL')
+ OR (geo = 'DEC0' AND age = 'TOTAL')
+ OR (geo = 'DED' AND age = 'TOTAL')
+ OR (geo = 'DED2' AND age = 'TOTAL')
+ OR (geo = 'DED4' AND age = 'TOTAL')
+ OR (geo = 'DED5' AND age = 'TOTAL')
+ OR (geo = 'DEE' AND age = 'TOTAL')
+ OR (geo = 'DEE0' AND age = 'TOTAL')
+ OR (geo = 'DEF' AND age = 'TOTAL')
+ OR (geo = 'DEF0' AND age = 'TOTAL')
+ OR (geo = 'DEG' AND age = 'TOTAL')
+ OR (geo = 'DEG0' AND age = 'TOTAL')
+ OR (geo = 'EE' AND age = 'TOTAL')
+ OR (geo = 'EE0' AND age = 'TOTAL')
+ OR (geo = 'EE00' AND age = 'TOTAL')
+ OR (geo = 'IE' AND age = 'TOTAL')
+ OR (geo = 'IE0' AND age = 'TOTAL')
+ OR (geo = 'IE04' AND age = 'TOTAL')
+ OR (geo = 'IE05' AND age = 'TOTAL')
+ OR (geo = 'IE06' AND age = 'TOTAL')
+ OR (geo = 'EL' AND age = 'TOTAL')
+ OR (geo = 'EL3' AND age = 'TOTAL')
+ OR (geo = 'EL30' AND age = 'TOTAL')
+ OR (geo = 'EL4' AND age = 'TOTAL')
+ OR (geo = 'EL41' AND age = 'TOTAL')
+ OR (geo = 'EL42' AND age = 'TOTAL')
+ OR (geo = 'EL43' AND age = 'TOTAL')
+ OR (geo = 'EL5' AND age = 'TOTAL')
+ OR (geo = 'EL51' AND age = 'TOTAL')
+ OR (geo = 'EL52' AND age = 'TOTAL')
+ OR (geo = 'EL53' AND age = 'TOTAL')
+ OR (geo = 'EL54' AND age = 'TOTAL')
+ OR (geo = 'EL6' AND age = 'TOTAL')
+ OR (geo = 'EL61' AND age = 'TOTAL')
+ OR (geo = 'EL62' AND age = 'TOTAL')
+ OR (geo = 'EL63' AND age = 'TOTAL')
+ OR (geo = 'EL64' AND age = 'TOTAL')
+ OR (geo = 'EL65' AND age = 'TOTAL')
+ OR (geo = 'ES' AND age = 'TOTAL')
+ OR (geo = 'ES1' AND age = 'TOTAL')
+ OR (geo = 'ES11' AND age = 'TOTAL')
+ OR (geo = 'ES12' AND age = 'TOTAL')
+ OR (geo = 'ES13' AND age = 'TOTAL')
+ OR (geo = 'ES2' AND age = 'TOTAL')
+ OR (geo = 'ES21' AND age = 'TOTAL')
+ OR (geo = 'ES22' AND age = 'TOTAL')
+ OR (geo = 'ES23' AND age = 'TOTAL')
+ OR (geo = 'ES24' AND age = 'TOTAL')
+ OR (geo = 'ES3' AND age = 'TOTAL')
+ OR (geo = 'ES30' AND age = 'TOTAL')
+ OR (geo = 'ES4' AND age = 'TOTAL')
+ OR (geo = 'ES41' AND age = 'TOTAL')
+ OR (geo = 'ES42' AND age = 'TOTAL')
+ OR (geo = 'ES43' AND age = 'TOTAL')
+ OR (geo = 'ES5' AND age = 'TOTAL')
+ OR (geo = 'ES51' AND age = 'TOTAL')
+ OR (geo = 'ES52' AND age = 'TOTAL')
+ OR (geo = 'ES53' AND age = 'TOTAL')
+ OR (geo = 'ES6' AND age = 'TOTAL')
+ OR (geo = 'ES61' AND age = 'TOTAL')
+ OR (geo = 'ES62' AND age = 'TOTAL')
+ OR (geo = 'ES63' AND age = 'TOTAL')
+ OR (geo = 'ES64' AND age = 'TOTAL')
+ OR (geo = 'ES7' AND age = 'TOTAL')
+ OR (geo = 'ES70' AND age = 'TOTAL')
+ OR (geo = 'FR' AND age = 'TOTAL')
+ OR (geo = 'FR1' AND age = 'TOTAL')
+ OR (geo = 'FR10' AND age = 'TOTAL')
+ OR (geo = 'FRB' AND age = 'TOTAL')
+ OR (geo = 'FRB0' AND age = 'TOTAL')
+ OR (geo = 'FRC' AND age = 'TOTAL')
+ OR (geo = 'FRC1' AND age = 'TOTAL')
+ OR (geo = 'FRC2' AND age = 'TOTAL')
+ OR (geo = 'FRD' AND age = 'TOTAL')
+ OR (geo = 'FRD1' AND age = 'TOTAL')
+ OR (geo = 'FRD2' AND age = 'TOTAL')
+ OR (geo = 'FRE' AND age = 'TOTAL')
+ OR (geo = 'FRE1' AND age = 'TOTAL')
+ OR (geo = 'FRE2' AND age = 'TOTAL')
+ OR (geo = 'FRF' AND age = 'TOTAL')
+ OR (geo = 'FRF1' AND age = 'TOTAL')
+ OR (geo = 'FRF2' AND age = 'TOTAL')
+ OR (geo = 'FRF3' AND age = 'TOTAL')
+ OR (geo = 'FRG' AND age = 'TOTAL')
+ OR (geo = 'FRG0' AND age = 'TOTAL')
+ OR (geo = 'FRH' AND age = 'TOTAL')
+ OR (geo = 'FRH0' AND age = 'TOTAL')
+ OR (geo = 'FRI' AND age = 'TOTAL')
+ OR (geo = 'FRI1' AND age = 'TOTAL')
+ OR (geo = 'FRI2' AND age = 'TOTAL')
+ OR (geo = 'FRI3' AND age = 'TOTAL')
+ OR (geo = 'FRJ' AND age = 'TOTAL')
+ OR (geo = 'FRJ1' AND age = 'TOTAL')
+ OR (geo = 'FRJ2' AND age = 'TOTAL')
+ OR (geo = 'FRK' AND age = 'TOTAL')
+ OR (geo = 'FRK1' AND age = 'TOTAL')
+ OR (geo = 'FRK2' AND age = 'TOTAL')
+ OR (geo = 'FRL' AND age = 'TOTAL')
+ OR (geo = 'FRL0' AND age = 'TOTAL')
+ OR (geo = 'FRM' AND age = 'TOTAL')
+ OR (geo = 'FRM0' AND age = 'TOTAL')
+ OR (geo = 'FRY' AND age = 'TOTAL')
+ OR (geo = 'FRY1' AND age = 'TOTAL')
+ OR (geo = 'FRY2' AND age = 'TOTAL')
+ OR (geo = 'FRY3' AND age = 'TOTAL')
+ OR (geo = 'FRY4' AND age = 'TOTAL')
+ OR (geo = 'FRY5' AND age = 'TOTAL')
+ OR (geo = 'FRX' AND age = 'TOTAL')
+ OR (geo = 'FRXX' AND age = 'TOTAL')
+ OR (geo = 'HR' AND age = 'TOTAL')
+ OR (geo = 'HR0' AND age = 'TOTAL')
+ OR (geo = 'HR02' AND age = 'TOTAL')
+ OR (geo = 'HR03' AND age = 'TOTAL')
+ OR (geo = 'HR04' AND age = 'TOTAL')
+ OR (geo = 'HR05' AND age = 'TOTAL')
+ OR (geo = 'HR06' AND age = 'TOTAL')
+ OR (geo = 'IT' AND age = 'TOTAL')
+ OR (geo = 'ITC' AND age = 'TOTAL')
+ OR (geo = 'ITC1' AND age = 'TOTAL')
+ OR (geo = 'ITC2' AND age = 'TOTAL')
+ OR (geo = 'ITC3' AND age = 'TOTAL')
+ OR (geo = 'ITC4' AND age = 'TOTAL')
+ OR (geo = 'ITF' AND age = 'TOTAL')
+ OR (geo = 'ITF1' AND age = 'TOTAL')
+ OR (geo = 'ITF2' AND age = 'TOTAL')
+ OR (geo = 'ITF3' AND age = 'TOTAL')
+ OR (geo = 'ITF4' AND age = 'TOTAL')
+ OR (geo = 'ITF5' AND age = 'TOTAL')
+ OR (geo = 'ITF6' AND age = 'TOTAL')
+ OR (geo = 'ITG' AND age = 'TOTAL')
+ OR (geo = 'ITG1' AND age = 'TOTAL')
+ OR (geo = 'ITG2' AND age = 'TOTAL')
+ OR (geo = 'ITH' AND age = 'TOTAL')
+ OR (geo = 'ITH1' AND age = 'TOTAL')
+ OR (geo = 'ITH2' AND age = 'TOTAL')
+ OR (geo = 'ITH3' AND age = 'TOTAL')
+ OR (geo = 'ITH4' AND age = 'TOTAL')
+ OR (geo = 'ITH5' AND age = 'TOTAL')
+ OR (geo = 'ITI' AND age = 'TOTAL')
+ OR (geo = 'ITI1' AND age = 'TOTAL')
+ OR (geo = 'ITI2' AND age = 'TOTAL')
+ OR (geo = 'ITI3' AND age = 'TOTAL')
+ OR (geo = 'ITI4' AND age = 'TOTAL')
+ OR (geo = 'CY' AND age = 'TOTAL')
+ OR (geo = 'CY0' AND age = 'TOTAL')
+ OR (geo = 'CY00' AND age = 'TOTAL')
+ OR (geo = 'LV' AND age = 'TOTAL')
+ OR (geo = 'LV0' AND age = 'TOTAL')
+ OR (geo = 'LV00' AND age = 'TOTAL')
+ OR (geo = 'LT' AND age = 'TOTAL')
+ OR (geo = 'LT0' AND age = 'TOTAL')
+ OR (geo = 'LT01' AND age = 'TOTAL')
+ OR (geo = 'LT02' AND age = 'TOTAL')
+ OR (geo = 'LU' AND age = 'TOTAL')
+ OR (geo = 'LU0' AND age = 'TOTAL')
+ OR (geo = 'LU00' AND age = 'TOTAL')
+ OR (geo = 'HU' AND age = 'TOTAL')
+ OR (geo = 'HU1' AND age = 'TOTAL')
+ OR (geo = 'HU11' AND age = 'TOTAL')
+ OR (geo = 'HU12' AND age = 'TOTAL')
+ OR (geo = 'HU2' AND age = 'TOTAL')
+ OR (geo = 'HU21' AND age = 'TOTAL')
+ OR (geo = 'HU22' AND age = 'TOTAL')
+ OR (geo = 'HU23' AND age = 'TOTAL')
+ OR (geo = 'HU3' AND age = 'TOTAL')
+ OR (geo = 'HU31' AND age = 'TOTAL')
+ OR (geo = 'HU32' AND age = 'TOTAL')
+ OR (geo = 'HU33' AND age = 'TOTAL')
+ OR (geo = 'HUX' AND age = 'TOTAL')
+ OR (geo = 'HUXX' AND age = 'TOTAL')
+ OR (geo = 'MT' AND age = 'TOTAL')
+ OR (geo = 'MT0' AND age = 'TOTAL')
+ OR (geo = 'MT00' AND age = 'TOTAL')
+ OR (geo = 'NL' AND age = 'TOTAL')
+ OR (geo = 'NL1' AND age = 'TOTAL')
+ OR (geo = 'NL11' AND age = 'TOTAL')
+ OR (geo = 'NL12' AND age = 'TOTAL')
+ OR (geo = 'NL13' AND age = 'TOTAL')
+ OR (geo = 'NL2' AND age = 'TOTAL')
+ OR (geo = 'NL21' AND age = 'TOTAL')
+ OR (geo = 'NL22' AND age = 'TOTAL')
+ OR (geo = 'NL23' AND age = 'TOTAL')
+ OR (geo = 'NL3' AND age = 'TOTAL')
+ OR (geo = 'NL31' AND age = 'TOTAL')
+ OR (geo = 'NL32' AND age = 'TOTAL')
+ OR (geo = 'NL33' AND age = 'TOTAL')
+ OR (geo = 'NL34' AND age = 'TOTAL')
+ OR (geo = 'NL35' AND age = 'TOTAL')
+ OR (geo = 'NL36' AND age = 'TOTAL')
+ OR (geo = 'NL4' AND age = 'TOTAL')
+ OR (geo = 'NL41' AND age = 'TOTAL')
+ OR (geo = 'NL42' AND age = 'TOTAL')
+ OR (geo = 'AT' AND age = 'TOTAL')
+ OR (geo = 'AT1' AND age = 'TOTAL')
+ OR (geo = 'AT11' AND age = 'TOTAL')
+ OR (geo = 'AT12' AND age = 'TOTAL')
+ OR (geo = 'AT13' AND age = 'TOTAL')
+ OR (geo = 'AT2' AND age = 'TOTAL')
+ OR (geo = 'AT21' AND age = 'TOTAL')
+ OR (geo = 'AT22' AND age = 'TOTAL')
+ OR (geo = 'AT3' AND age = 'TOTAL')
+ OR (geo = 'AT31' AND age = 'TOTAL')
+ OR (geo = 'AT32' AND age = 'TOTAL')
+ OR (geo = 'AT33' AND age = 'TOTAL')
+ OR (geo = 'AT34' AND age = 'TOTAL')
+ OR (geo = 'PL' AND age = 'TOTAL')
+ OR (geo = 'PL2' AND age = 'TOTAL')
+ OR (geo = 'PL21' AND age = 'TOTAL')
+ OR (geo = 'PL22' AND age = 'TOTAL')
+ OR (geo = 'PL4' AND age = 'TOTAL')
+ OR (geo = 'PL41' AND age = 'TOTAL')
+ OR (geo = 'PL42' AND age = 'TOTAL')
+ OR (geo = 'PL43' AND age = 'TOTAL')
+ OR (geo = 'PL5' AND age = 'TOTAL')
+ OR (geo = 'PL51' AND age = 'TOTAL')
+ OR (geo = 'PL52' AND age = 'TOTAL')
+ OR (geo = 'PL6' AND age = 'TOTAL')
+ OR (geo = 'PL61' AND age = 'TOTAL')
+ OR (geo = 'PL62' AND age = 'TOTAL')
+ OR (geo = 'PL63' AND age = 'TOTAL')
+ OR (geo = 'PL7' AND age = 'TOTAL')
+ OR (geo = 'PL71' AND age = 'TOTAL')
+ OR (geo = 'PL72' AND age = 'TOTAL')
+ OR (geo = 'PL8' AND age = 'TOTAL')
+ OR (geo = 'PL81' AND age = 'TOTAL')
+ OR (geo = 'PL82' AND age = 'TOTAL')
+ OR (geo = 'PL84' AND age = 'TOTAL')
+ OR (geo = 'PL9' AND age = 'TOTAL')
+ OR (geo = 'PL91' AND age = 'TOTAL')
+ OR (geo = 'PL92' AND age = 'TOTAL')
+ OR (geo = 'PT' AND age = 'TOTAL')
+ OR (geo = 'PT1' AND age = 'TOTAL')
+ OR (geo = 'PT11' AND age = 'TOTAL')
+ OR (geo = 'PT15' AND age = 'TOTAL')
+ OR (geo = 'PT16' AND age = 'TOTAL')
+ OR (geo = 'PT17' AND age = 'TOTAL')
+ OR (geo = 'PT18' AND age = 'TOTAL')
+ OR (geo = 'PT19' AND age = 'TOTAL')
+ OR (geo = 'PT1A' AND age = 'TOTAL')
+ OR (geo = 'PT1B' AND age = 'TOTAL')
+ OR (geo = 'PT1C' AND age = 'TOTAL')
+ OR (geo = 'PT1D' AND age = 'TOTAL')
+ OR (geo = 'PT2' AND age = 'TOTAL')
+ OR (geo = 'PT20' AND age = 'TOTAL')
+ OR (geo = 'PT3' AND age = 'TOTAL')
+ OR (geo = 'PT30' AND age = 'TOTAL')
+ OR (geo = 'RO' AND age = 'TOTAL')
+ OR (geo = 'RO1' AND age = 'TOTAL')
+ OR (geo = 'RO11' AND age = 'TOTAL')
+ OR (geo = 'RO12' AND age = 'TOTAL')
+ OR (geo = 'RO2' AND age = 'TOTAL')
+ OR (geo = 'RO21' AND age = 'TOTAL')
+ OR (geo = 'RO22' AND age = 'TOTAL')
+ OR (geo = 'RO3' AND age = 'TOTAL')
+ OR (geo = 'RO31' AND age = 'TOTAL')
+ OR (geo = 'RO32' AND age = 'TOTAL')
+ OR (geo = 'RO4' AND age = 'TOTAL')
+ OR (geo = 'RO41' AND age = 'TOTAL')
+ OR (geo = 'RO42' AND age = 'TOTAL')
+ OR (geo = 'SI' AND age = 'TOTAL')
+ OR (geo = 'SI0' AND age = 'TOTAL')
+ OR (geo = 'SI03' AND age = 'TOTAL')
+ OR (geo = 'SI04' AND age = 'TOTAL')
+ OR (geo = 'SK' AND age = 'TOTAL')
+ OR (geo = 'SK0' AND age = 'TOTAL')
+ OR (geo = 'SK01' AND age = 'TOTAL')
+ OR (geo = 'SK02' AND age = 'TOTAL')
+ OR (geo = 'SK03' AND age = 'TOTAL')
+ OR (geo = 'SK04' AND age = 'TOTAL')
+ OR (geo = 'FI' AND age = 'TOTAL')
+ OR (geo = 'FI1' AND age = 'TOTAL')
+ OR (geo = 'FI19' AND age = 'TOTAL')
+ OR (geo = 'FI1B' AND age = 'TOTAL')
+ OR (geo = 'FI1C' AND age = 'TOTAL')
+ OR (geo = 'FI1D' AND age = 'TOTAL')
+ OR (geo = 'FI2' AND age = 'TOTAL')
+ OR (geo = 'FI20' AND age = 'TOTAL')
+ OR (geo = 'SE' AND age = 'TOTAL')
+ OR (geo = 'SE1' AND age = 'TOTAL')
+ OR (geo = 'SE11' AND age = 'TOTAL')
+ OR (geo = 'SE12' AND age = 'TOTAL')
+ OR (geo = 'SE2' AND age = 'TOTAL')
+ OR (geo = 'SE21' AND age = 'TOTAL')
+ OR (geo = 'SE22' AND age = 'TOTAL')
+ OR (geo = 'SE23' AND age = 'TOTAL')
+ OR (geo = 'SE3' AND age = 'TOTAL')
+ OR (geo = 'SE31' AND age = 'TOTAL')
+ OR (geo = 'SE32' AND age = 'TOTAL')
+ OR (geo = 'SE33' AND age = 'TOTAL')
+ OR (geo = 'EFTA' AND age = 'TOTAL')
+ OR (geo = 'IS' AND age = 'TOTAL')
+ OR (geo = 'IS0' AND age = 'TOTAL')
+ OR (geo = 'IS00' AND age = 'TOTAL')
+ OR (geo = 'LI' AND age = 'TOTAL')
+ OR (geo = 'LI0' AND age = 'TOTAL')
+ OR (geo = 'LI00' AND age = 'TOTAL')
+ OR (geo = 'NO' AND age = 'TOTAL')
+ OR (geo = 'NO0' AND age = 'TOTAL')
+ OR (geo = 'NO01' AND age = 'TOTAL')
+ OR (geo = 'NO02' AND age = 'TOTAL')
+ OR (geo = 'NO03' AND age = 'TOTAL')
+ OR (geo = 'NO04' AND age = 'TOTAL')
+ OR (geo = 'NO05' AND age = 'TOTAL')
+ OR (geo = 'NO06' AND age = 'TOTAL')
+ OR (geo = 'NO07' AND age = 'TOTAL')
+ OR (geo = 'NO08' AND age = 'TOTAL')
+ OR (geo = 'NO09' AND age = 'TOTAL')
+ OR (geo = 'NO0A' AND age = 'TOTAL')
+ OR (geo = 'NO0B' AND age = 'TOTAL')
+ OR (geo = 'CH' AND age = 'TOTAL')
+ OR (geo = 'CH0' AND age = 'TOTAL')
+ OR (geo = 'CH01' AND age = 'TOTAL')
+ OR (geo = 'CH02' AND age = 'TOTAL')
+ OR (geo = 'CH03' AND age = 'TOTAL')
+ OR (geo = 'CH04' AND age = 'TOTAL')
+ OR (geo = 'CH05' AND age = 'TOTAL')
+ OR (geo = 'CH06' AND age = 'TOTAL')
+ OR (geo = 'CH07' AND age = 'TOTAL')
+ OR (geo = 'UK' AND age = 'TOTAL')
+ OR (geo = 'UKC' AND age = 'TOTAL')
+ OR (geo = 'UKC1' AND age = 'TOTAL')
+ OR (geo = 'UKC2' AND age = 'TOTAL')
+ OR (geo = 'UKD' AND age = 'TOTAL')
+ OR (geo = 'UKD1' AND age = 'TOTAL')
+ OR (geo = 'UKD3' AND age = 'TOTAL')
+ OR (geo = 'UKD4' AND age = 'TOTAL')
+ OR (geo = 'UKD6' AND age = 'TOTAL')
+ OR (geo = 'UKD7' AND age = 'TOTAL')
+ OR (geo = 'UKE' AND age = 'TOTAL')
+ OR (geo = 'UKE1' AND age = 'TOTAL')
+ OR (geo = 'UKE2' AND age = 'TOTAL')
+ OR (geo = 'UKE3' AND age = 'TOTAL')
+ OR (geo = 'UKE4' AND age = 'TOTAL')
+ OR (geo = 'UKF' AND age = 'TOTAL')
+ OR (geo = 'UKF1' AND age = 'TOTAL')
+ OR (geo = 'UKF2' AND age = 'TOTAL')
+ OR (geo = 'UKF3' AND age = 'TOTAL')
+ OR (geo = 'UKG' AND age = 'TOTAL')
+ OR (geo = 'UKG1' AND age = 'TOTAL')
+ OR (geo = 'UKG2' AND age = 'TOTAL')
+ OR (geo = 'UKG3' AND age = 'TOTAL')
+ OR (geo = 'UKH' AND age = 'TOTAL')
+ OR (geo = 'UKH1' AND age = 'TOTAL')
+ OR (geo = 'UKH2' AND age = 'TOTAL')
+ OR (geo = 'UKH3' AND age = 'TOTAL')
+ OR (geo = 'UKI' AND age = 'TOTAL')
+ OR (geo = 'UKI3' AND age = 'TOTAL')
+ OR (geo = 'UKI4' AND age = 'TOTAL')
+ OR (geo = 'UKI5' AND age = 'TOTAL')
+ OR (geo = 'UKI6' AND age = 'TOTAL')
+ OR (geo = 'UKI7' AND age = 'TOTAL')
+ OR (geo = 'UKJ' AND age = 'TOTAL')
+ OR (geo = 'UKJ1' AND age = 'TOTAL')
+ OR (geo = 'UKJ2' AND age = 'TOTAL')
+ OR (geo = 'UKJ3' AND age = 'TOTAL')
+ OR (geo = 'UKJ4' AND age = 'TOTAL')
+ OR (geo = 'UKK' AND age = 'TOTAL')
+ OR (geo = 'UKK1' AND age = 'TOTAL')
+ OR (geo = 'UKK2' AND age = 'TOTAL')
+ OR (geo = 'UKK3' AND age = 'TOTAL')
+ OR (geo = 'UKK4' AND age = 'TOTAL')
+ OR (geo = 'UKL' AND age = 'TOTAL')
+ OR (geo = 'UKL1' AND age = 'TOTAL')
+ OR (geo = 'UKL2' AND age = 'TOTAL')
+ OR (geo = 'UKM' AND age = 'TOTAL')
+ OR (geo = 'UKM5' AND age = 'TOTAL')
+ OR (geo = 'UKM6' AND age = 'TOTAL')
+ OR (geo = 'UKM7' AND age = 'TOTAL')
+ OR (geo = 'UKM8' AND age = 'TOTAL')
+ OR (geo = 'UKM9' AND age = 'TOTAL')
+ OR (geo = 'UKN' AND age = 'TOTAL')
+ OR (geo = 'UKN0' AND age = 'TOTAL')
+ OR (geo = 'ME' AND age = 'TOTAL')
+ OR (geo = 'ME0' AND age = 'TOTAL')
+ OR (geo = 'ME00' AND age = 'TOTAL')
+ OR (geo = 'MK' AND age = 'TOTAL')
+ OR (geo = 'MK0' AND age = 'TOTAL')
+ OR (geo = 'MK00' AND age = 'TOTAL')
+ OR (geo = 'MKX' AND age = 'TOTAL')
+ OR (geo = 'MKXX' AND age = 'TOTAL')
+ OR (geo = 'AL' AND age = 'TOTAL')
+ OR (geo = 'AL0' AND age = 'TOTAL')
+ OR (geo = 'AL01' AND age = 'TOTAL')
+ OR (geo = 'AL02' AND age = 'TOTAL')
+ OR (geo = 'AL03' AND age = 'TOTAL')
+ OR (geo = 'ALX' AND age = 'TOTAL')
+ OR (geo = 'ALXX' AND age = 'TOTAL')
+ OR (geo = 'RS' AND age = 'TOTAL')
+ OR (geo = 'RS1' AND age = 'TOTAL')
+ OR (geo = 'RS11' AND age = 'TOTAL')
+ OR (geo = 'RS12' AND age = 'TOTAL')
+ OR (geo = 'RS2' AND age = 'TOTAL')
+ OR (geo = 'RS21' AND age = 'TOTAL')
+ OR (geo = 'RS22' AND age = 'TOTAL')
+ OR (geo = 'TR' AND age = 'TOTAL')
+ OR (geo = 'TR1' AND age = 'TOTAL')
+ OR (geo = 'TR10' AND age = 'TOTAL')
+ OR (geo = 'TR2' AND age = 'TOTAL')
+ OR (geo = 'TR21' AND age = 'TOTAL')
+ OR (geo = 'TR22' AND age = 'TOTAL')
+ OR (geo = 'TR3' AND age = 'TOTAL')
+ OR (geo = 'TR31' AND age = 'TOTAL')
+ OR (geo = 'TR32' AND age = 'TOTAL')
+ OR (geo = 'TR33' AND age = 'TOTAL')
+ OR (geo = 'TR4' AND age = 'TOTAL')
+ OR (geo = 'TR41' AND age = 'TOTAL')
+ OR (geo = 'TR42' AND age = 'TOTAL')
+ OR (geo = 'TR5' AND age = 'TOTAL')
+ OR (geo = 'TR51' AND age = 'TOTAL')
+ OR (geo = 'TR52' AND age = 'TOTAL')
+ OR (geo = 'TR6' AND age = 'TOTAL')
+ OR (geo = 'TR61' AND age = 'TOTAL')
+ OR (geo = 'TR62' AND age = 'TOTAL')
+ OR (geo = 'TR63' AND age = 'TOTAL')
+ OR (geo = 'TR7' AND age = 'TOTAL')
+ OR (geo = 'TR71' AND age = 'TOTAL')
+ OR (geo = 'TR72' AND age = 'TOTAL')
+ OR (geo = 'TR8' AND age = 'TOTAL')
+ OR (geo = 'TR81' AND age = 'TOTAL')
+ OR (geo = 'TR82' AND age = 'TOTAL')
+ OR (geo = 'TR83' AND age = 'TOTAL')
+ OR (geo = 'TR9' AND age = 'TOTAL')
+ OR (geo = 'TR90' AND age = 'TOTAL')
+ OR (geo = 'TRA' AND age = 'TOTAL')
+ OR (geo = 'TRA1' AND age = 'TOTAL')
+ OR (geo = 'TRA2' AND age = 'TOTAL')
+ OR (geo = 'TRB' AND age = 'TOTAL')
+ OR (geo = 'TRB1' AND age = 'TOTAL')
+ OR (geo = 'TRB2' AND age = 'TOTAL')
+ OR (geo = 'TRC' AND age = 'TOTAL')
+ OR (geo = 'TRC1' AND age = 'TOTAL')
+ OR (geo = 'TRC2' AND age = 'TOTAL')
+ OR (geo = 'TRC3' AND age = 'TOTAL')
+ OR (geo = 'EU27_2020' AND age = 'Y_LT1')
+ OR (geo = 'EU28' AND age = 'Y_LT1')
+ OR (geo = 'EU27_2007' AND age = 'Y_LT1')
+ OR (geo = 'BE' AND age = 'Y_LT1')
+ OR (geo = 'BE1' AND age = 'Y_LT1')
+ OR (geo = 'BE10' AND age = 'Y_LT1')
+ OR (geo = 'BE2' AND age = 'Y_LT1')
+ OR (geo = 'BE21' AND age = 'Y_LT1')
+ OR (geo = 'BE22' AND age = 'Y_LT1')
+ OR (geo = 'BE23' AND age = 'Y_LT1')
+ OR (geo = 'BE24' AND age = 'Y_LT1')
+ OR (geo = 'BE25' AND age = 'Y_LT1')
+ OR (geo = 'BE3' AND age = 'Y_LT1')
+ OR (geo = 'BE31' AND age = 'Y_LT1')
+ OR (geo = 'BE32' AND age = 'Y_LT1')
+ OR (geo = 'BE33' AND age = 'Y_LT1')
+ OR (geo = 'BE34' AND age = 'Y_LT1')
+ OR (geo = 'BE35' AND age = 'Y_LT1')
+ OR (geo = 'BG' AND age = 'Y_LT1')
+ OR (geo = 'BG3' AND age = 'Y_LT1')
+ OR (geo = 'BG31' AND age = 'Y_LT1')
+ OR (geo = 'BG32' AND age = 'Y_LT1')
+ OR (geo = 'BG33' AND age = 'Y_LT1')
+ OR (geo = 'BG34' AND age = 'Y_LT1')
+ OR (geo = 'BG4' AND age = 'Y_LT1')
+ OR (geo = 'BG41' AND age = 'Y_LT1')
+ OR (geo = 'BG42' AND age = 'Y_LT1')
+ OR (geo = 'CZ' AND age = 'Y_LT1')
+ OR (geo = 'CZ0' AND age = 'Y_LT1')
+ OR (geo = 'CZ01' AND age = 'Y_LT1')
+ OR (geo = 'CZ02' AND age = 'Y_LT1')
+ OR (geo = 'CZ03' AND age = 'Y_LT1')
+ OR (geo = 'CZ04' AND age = 'Y_LT1')
+ OR (geo = 'CZ05' AND age = 'Y_LT1')
+ OR (geo = 'CZ06' AND age = 'Y_LT1')
+ OR (geo = 'CZ07' AND age = 'Y_LT1')
+ OR (geo = 'CZ08' AND age = 'Y_LT1')
+ OR (geo = 'DK' AND age = 'Y_LT1')
+ OR (geo = 'DK0' AND age = 'Y_LT1')
+ OR (geo = 'DK01' AND age = 'Y_LT1')
+ OR (geo = 'DK02' AND age = 'Y_LT1')
+ OR (geo = 'DK03' AND age = 'Y_LT1')
+ OR (geo = 'DK04' AND age = 'Y_LT1')
+ OR (geo = 'DK05' AND age = 'Y_LT1')
+ OR (geo = 'DE' AND age = 'Y_LT1')
+ OR (geo = 'DE_TOT' AND age = 'Y_LT1')
+ OR (geo = 'DE1' AND age = 'Y_LT1')
+ OR (geo = 'DE11' AND age = 'Y_LT1')
+ OR (geo = 'DE12' AND age = 'Y_LT1')
+ OR (geo = 'DE13' AND age = 'Y_LT1')
+ OR (geo = 'DE14' AND age = 'Y_LT1')
+ OR (geo = 'DE2' AND age = 'Y_LT1')
+ OR (geo = 'DE21' AND age = 'Y_LT1')
+ OR (geo = 'DE22' AND age = 'Y_LT1')
+ OR (geo = 'DE23' AND age = 'Y_LT1')
+ OR (geo = 'DE24' AND age = 'Y_LT1')
+ OR (geo = 'DE25' AND age = 'Y_LT1')
+ OR (geo = 'DE26' AND age = 'Y_LT1')
+ OR (geo = 'DE27' AND age = 'Y_LT1')
+ OR (geo = 'DE3' AND age = 'Y_LT1')
+ OR (geo = 'DE30' AND age = 'Y_LT1')
+ OR (geo = 'DE4' AND age = 'Y_LT1')
+ OR (geo = 'DE40' AND age = 'Y_LT1')
+ OR (geo = 'DE5' AND age = 'Y_LT1')
+ OR (geo = 'DE50' AND age = 'Y_LT1')
+ OR (geo = 'DE6' AND age = 'Y_LT1')
+ OR (geo = 'DE60' AND age = 'Y_LT1')
+ OR (geo = 'DE7' AND age = 'Y_LT1')
+ OR (geo = 'DE71' AND age = 'Y_LT1')
+ OR (geo = 'DE72' AND age = 'Y_LT1')
+ OR (geo = 'DE73' AND age = 'Y_LT1')
+ OR (geo = 'DE8' AND age = 'Y_LT1')
+ OR (geo = 'DE80' AND age = 'Y_LT1')
+ OR (geo = 'DE9' AND age = 'Y_LT1')
+ OR (geo = 'DE91' AND age = 'Y_LT1')
+ OR (geo = 'DE92' AND age = 'Y_LT1')
+ OR (geo = 'DE93' AND age = 'Y_LT1')
+ OR (geo = 'DE94' AND age = 'Y_LT1')
+ OR (geo = 'DEA' AND age = 'Y_LT1')
+ OR (geo = 'DEA1' AND age = 'Y_LT1')
+ OR (geo = 'DEA2' AND age = 'Y_LT1')
+ OR (geo = 'DEA3' AND age = 'Y_LT1')
+ OR (geo = 'DEA4' AND age = 'Y_LT1')
+ OR (geo = 'DEA5' AND age = 'Y_LT1')
+ OR (geo = 'DEB' AND age = 'Y_LT1')
+ OR (geo = 'DEB1' AND age = 'Y_LT1')
+ OR (geo = 'DEB2' AND age = 'Y_LT1')
+ OR (geo = 'DEB3' AND age = 'Y_LT1')
+ OR (geo = 'DEC' AND age = 'Y_LT1')
+ OR (geo = 'DEC0' AND age = 'Y_LT1')
+ OR (geo = 'DED' AND age = 'Y_LT1')
+ OR (geo = 'DED2' AND age = 'Y_LT1')
+ OR (geo = 'DED4' AND age = 'Y_LT1')
+ OR (geo = 'DED5' AND age = 'Y_LT1')
+ OR (geo = 'DEE' AND age = 'Y_LT1')
+ OR (geo = 'DEE0' AND age = 'Y_LT1')
+ OR (geo = 'DEF' AND age = 'Y_LT1')
+ OR (geo = 'DEF0' AND age = 'Y_LT1')
+ OR (geo = 'DEG' AND age = 'Y_LT1')
+ OR (geo = 'DEG0' AND age = 'Y_LT1')
+ OR (geo = 'EE' AND age = 'Y_LT1')
+ OR (geo = 'EE0' AND age = 'Y_LT1')
+ OR (geo = 'EE00' AND age = 'Y_LT1')
+ OR (geo = 'IE' AND age = 'Y_LT1')
+ OR (geo = 'IE0' AND age = 'Y_LT1')
+ OR (geo = 'IE04' AND age = 'Y_LT1')
+ OR (geo = 'IE05' AND age = 'Y_LT1')
+ OR (geo = 'IE06' AND age = 'Y_LT1')
+ OR (geo = 'EL' AND age = 'Y_LT1')
+ OR (geo = 'EL3' AND age = 'Y_LT1')
+ OR (geo = 'EL30' AND age = 'Y_LT1')
+ OR (geo = 'EL4' AND age = 'Y_LT1')
+ OR (geo = 'EL41' AND age = 'Y_LT1')
+ OR (geo = 'EL42' AND age = 'Y_LT1')
+ OR (geo = 'EL43' AND age = 'Y_LT1')
+ OR (geo = 'EL5' AND age = 'Y_LT1')
+ OR (geo = 'EL51' AND age = 'Y_LT1')
+ OR (geo = 'EL52' AND age = 'Y_LT1')
+ OR (geo = 'EL53' AND age = 'Y_LT1')
+ OR (geo = 'EL54' AND age = 'Y_LT1')
+ OR (geo = 'EL6' AND age = 'Y_LT1')
+ OR (geo = 'EL61' AND age = 'Y_LT1')
+ OR (geo = 'EL62' AND age = 'Y_LT1')
+ OR (geo = 'EL63' AND age = 'Y_LT1')
+ OR (geo = 'EL64' AND age = 'Y_LT1')
+ OR (geo = 'EL65' AND age = 'Y_LT1')
+ OR (geo = 'ES' AND age = 'Y_LT1')
+ OR (geo = 'ES1' AND age = 'Y_LT1')
+ OR (geo = 'ES11' AND age = 'Y_LT1')
+ OR (geo = 'ES12' AND age = 'Y_LT1')
+ OR (geo = 'ES13' AND age = 'Y_LT1')
+ OR (geo = 'ES2' AND age = 'Y_LT1')
+ OR (geo = 'ES21' AND age = 'Y_LT1')
+ OR (geo = 'ES22' AND age = 'Y_LT1')
+ OR (geo = 'ES23' AND age = 'Y_LT1')
+ OR (geo = 'ES24' AND age = 'Y_LT1')
+ OR (geo = 'ES3' AND age = 'Y_LT1')
+ OR (geo = 'ES30' AND age = 'Y_LT1')
+ OR (geo = 'ES4' AND age = 'Y_LT1')
+ OR (geo = 'ES41' AND age = 'Y_LT1')
+ OR (geo = 'ES42' AND age = 'Y_LT1')
+ OR (geo = 'ES43' AND age = 'Y_LT1')
+ OR (geo = 'ES5' AND age = 'Y_LT1')
+ OR (geo = 'ES51' AND age = 'Y_LT1')
+ OR (geo = 'ES52' AND age = 'Y_LT1')
+ OR (geo = 'ES53' AND age = 'Y_LT1')
+ OR (geo = 'ES6' AND age = 'Y_LT1')
+ OR (geo = 'ES61' AND age = 'Y_LT1')
+ OR (geo = 'ES62' AND age = 'Y_LT1')
+ OR (geo = 'ES63' AND age = 'Y_LT1')
+ OR (geo = 'ES64' AND age = 'Y_LT1')
+ OR (geo = 'ES7' AND age = 'Y_LT1')
+ OR (geo = 'ES70' AND age = 'Y_LT1')
+ OR (geo = 'FR' AND age = 'Y_LT1')
+ OR (geo = 'FR1' AND age = 'Y_LT1')
+ OR (geo = 'FR10' AND age = 'Y_LT1')
+ OR (geo = 'FRB' AND age = 'Y_LT1')
+ OR (geo = 'FRB0' AND age = 'Y_LT1')
+ OR (geo = 'FRC' AND age = 'Y_LT1')
+ OR (geo = 'FRC1' AND age = 'Y_LT1')
+ OR (geo = 'FRC2' AND age = 'Y_LT1')
+ OR (geo = 'FRD' AND age = 'Y_LT1')
+ OR (geo = 'FRD1' AND age = 'Y_LT1')
+ OR (geo = 'FRD2' AND age = 'Y_LT1')
+ OR (geo = 'FRE' AND age = 'Y_LT1')
+ OR (geo = 'FRE1' AND age = 'Y_LT1')
+ OR (geo = 'FRE2' AND age = 'Y_LT1')
+ OR (geo = 'FRF' AND age = 'Y_LT1')
+ OR (geo = 'FRF1' AND age = 'Y_LT1')
+ OR (geo = 'FRF2' AND age = 'Y_LT1')
+ OR (geo = 'FRF3' AND age = 'Y_LT1')
+ OR (geo = 'FRG' AND age = 'Y_LT1')
+ OR (geo = 'FRG0' AND age = 'Y_LT1')
+ OR (geo = 'FRH' AND age = 'Y_LT1')
+ OR (geo = 'FRH0' AND age = 'Y_LT1')
+ OR (geo = 'FRI' AND age = 'Y_LT1')
+ OR (geo = 'FRI1' AND age = 'Y_LT1')
+ OR (geo = 'FRI2' AND age = 'Y_LT1')
+ OR (geo = 'FRI3' AND age = 'Y_LT1')
+ OR (geo = 'FRJ' AND age = 'Y_LT1')
+ OR (geo = 'FRJ1' AND age = 'Y_LT1')
+ OR (geo = 'FRJ2' AND age = 'Y_LT1')
+ OR (geo = 'FRK' AND age = 'Y_LT1')
+ OR (geo = 'FRK1' AND age = 'Y_LT1')
+ OR (geo = 'FRK2' AND age = 'Y_LT1')
+ OR (geo = 'FRL' AND age = 'Y_LT1')
+ OR (geo = 'FRL0' AND age = 'Y_LT1')
+ OR (geo = 'FRM' AND age = 'Y_LT1')
+ OR (geo = 'FRM0' AND age = 'Y_LT1')
+ OR (geo = 'FRY' AND age = 'Y_LT1')
+ OR (geo = 'FRY1' AND age = 'Y_LT1')
+ OR (geo = 'FRY2' AND age = 'Y_LT1')
+ OR (geo = 'FRY3' AND age = 'Y_LT1')
+ OR (geo = 'FRY4' AND age = 'Y_LT1')
+ OR (geo = 'FRY5' AND age = 'Y_LT1')
+ OR (geo = 'FRX' AND age = 'Y_LT1')
+ OR (geo = 'FRXX' AND age = 'Y_LT1')
+ OR (geo = 'HR' AND age = 'Y_LT1')
+ OR (geo = 'HR0' AND age = 'Y_LT1')
+ OR (geo = 'HR02' AND age = 'Y_LT1')
+ OR (geo = 'HR03' AND age = 'Y_LT1')
+ OR (geo = 'HR04' AND age = 'Y_LT1')
+ OR (geo = 'HR05' AND age = 'Y_LT1')
+ OR (geo = 'HR06' AND age = 'Y_LT1')
+ OR (geo = 'IT' AND age = 'Y_LT1')
+ OR (geo = 'ITC' AND age = 'Y_LT1')
+ OR (geo = 'ITC1' AND age = 'Y_LT1')
+ OR (geo = 'ITC2' AND age = 'Y_LT1')
+ OR (geo = 'ITC3' AND age = 'Y_LT1')
+ OR (geo = 'ITC4' AND age = 'Y_LT1')
+ OR (geo = 'ITF' AND age = 'Y_LT1')
+ OR (geo = 'ITF1' AND age = 'Y_LT1')
+ OR (geo = 'ITF2' AND age = 'Y_LT1')
+ OR (geo = 'ITF3' AND age = 'Y_LT1')
+ OR (geo = 'ITF4' AND age = 'Y_LT1')
+ OR (geo = 'ITF5' AND age = 'Y_LT1')
+ OR (geo = 'ITF6' AND age = 'Y_LT1')
+ OR (geo = 'ITG' AND age = 'Y_LT1')
+ OR (geo = 'ITG1' AND age = 'Y_LT1')
+ OR (geo = 'ITG2' AND age = 'Y_LT1')
+ OR (geo = 'ITH' AND age = 'Y_LT1')
+ OR (geo = 'ITH1' AND age = 'Y_LT1')
+ OR (geo = 'ITH2' AND age = 'Y_LT1')
+ OR (geo = 'ITH3' AND age = 'Y_LT1')
+ OR (geo = 'ITH4' AND age = 'Y_LT1')
+ OR (geo = 'ITH5' AND age = 'Y_LT1')
+ OR (geo = 'ITI' AND age = 'Y_LT1')
+ OR (geo = 'ITI1' AND age = 'Y_LT1')
+ OR (geo = 'ITI2' AND age = 'Y_LT1')
+ OR (geo = 'ITI3' AND age = 'Y_LT1')
+ OR (geo = 'ITI4' AND age = 'Y_LT1')
+ OR (geo = 'CY' AND age = 'Y_LT1')
+ OR (geo = 'CY0' AND age = 'Y_LT1')
+ OR (geo = 'CY00' AND age = 'Y_LT1')
+ OR (geo = 'LV' AND age = 'Y_LT1')
+ OR (geo = 'LV0' AND age = 'Y_LT1')
+ OR (geo = 'LV00' AND age = 'Y_LT1')
+ OR (geo = 'LT' AND age = 'Y_LT1')
+ OR (geo = 'LT0' AND age = 'Y_LT1')
+ OR (geo = 'LT01' AND age = 'Y_LT1')
+ OR (geo = 'LT02' AND age = 'Y_LT1')
+ OR (geo = 'LU' AND age = 'Y_LT1')
+ OR (geo = 'LU0' AND age = 'Y_LT1')
+ OR (geo = 'LU00' AND age = 'Y_LT1')
+ OR (geo = 'HU' AND age = 'Y_LT1')
+ OR (geo = 'HU1' AND age = 'Y_LT1')
+ OR (geo = 'HU11' AND age = 'Y_LT1')
+ OR (geo = 'HU12' AND age = 'Y_LT1')
+ OR (geo = 'HU2' AND age = 'Y_LT1')
+ OR (geo = 'HU21' AND age = 'Y_LT1')
+ OR (geo = 'HU22' AND age = 'Y_LT1')
+ OR (geo = 'HU23' AND age = 'Y_LT1')
+ OR (geo = 'HU3' AND age = 'Y_LT1')
+ OR (geo = 'HU31' AND age = 'Y_LT1')
+ OR (geo = 'HU32' AND age = 'Y_LT1')
+ OR (geo = 'HU33' AND age = 'Y_LT1')
+ OR (geo = 'HUX' AND age = 'Y_LT1')
+ OR (geo = 'HUXX' AND age = 'Y_LT1')
+ OR (geo = 'MT' AND age = 'Y_LT1')
+ OR (geo = 'MT0' AND age = 'Y_LT1')
+ OR (geo = 'MT00' AND age = 'Y_LT1')
+ OR (geo = 'NL' AND age = 'Y_LT1')
+ OR (geo = 'NL1' AND age = 'Y_LT1')
+ OR (geo = 'NL11' AND age = 'Y_LT1')
+ OR (geo = 'NL12' AND age = 'Y_LT1')
+ OR (geo = 'NL13' AND age = 'Y_LT1')
+ OR (geo = 'NL2' AND age = 'Y_LT1')
+ OR (geo = 'NL21' AND age = 'Y_LT1')
+ OR (geo = 'NL22' AND age = 'Y_LT1')
+ OR (geo = 'NL23' AND age = 'Y_LT1')
+ OR (geo = 'NL3' AND age = 'Y_LT1')
+ OR (geo = 'NL31' AND age = 'Y_LT1')
+ OR (geo = 'NL32' AND age = 'Y_LT1')
+ OR (geo = 'NL33' AND age = 'Y_LT1')
+ OR (geo = 'NL34' AND age = 'Y_LT1')
+ OR (geo = 'NL35' AND age = 'Y_LT1')
+ OR (geo = 'NL36' AND age = 'Y_LT1')
+ OR (geo = 'NL4' AND age = 'Y_LT1')
+ OR (geo = 'NL41' AND age = 'Y_LT1')
+ OR (geo = 'NL42' AND age = 'Y_LT1')
+ OR (geo = 'AT' AND age = 'Y_LT1')
+ OR (geo = 'AT1' AND age = 'Y_LT1')
+ OR (geo = 'AT11' AND age = 'Y_LT1')
+ OR (geo = 'AT12' AND age = 'Y_LT1')
+ OR (geo = 'AT13' AND age = 'Y_LT1')
+ OR (geo = 'AT2' AND age = 'Y_LT1')
+ OR (geo = 'AT21' AND age = 'Y_LT1')
+ OR (geo = 'AT22' AND age = 'Y_LT1')
+ OR (geo = 'AT3' AND age = 'Y_LT1')
+ OR (geo = 'AT31' AND age = 'Y_LT1')
+ OR (geo = 'AT32' AND age = 'Y_LT1')
+ OR (geo = 'AT33' AND age = 'Y_LT1')
+ OR (geo = 'AT34' AND age = 'Y_LT1')
+ OR (geo = 'PL' AND age = 'Y_LT1')
+ OR (geo = 'PL2' AND age = 'Y_LT1')
+ OR (geo = 'PL21' AND age = 'Y_LT1')
+ OR (geo = 'PL22' AND age = 'Y_LT1')
+ OR (geo = 'PL4' AND age = 'Y_LT1')
+ OR (geo = 'PL41' AND age = 'Y_LT1')
+ OR (geo = 'PL42' AND age = 'Y_LT1')
+ OR (geo = 'PL43' AND age = 'Y_LT1')
+ OR (geo = 'PL5' AND age = 'Y_LT1')
+ OR (geo = 'PL51' AND age = 'Y_LT1')
+ OR (geo = 'PL52' AND age = 'Y_LT1')
+ OR (geo = 'PL6' AND age = 'Y_LT1')
+ OR (geo = 'PL61' AND age = 'Y_LT1')
+ OR (geo = 'PL62' AND age = 'Y_LT1')
+ OR (geo = 'PL63' AND age = 'Y_LT1')
+ OR (geo = 'PL7' AND age = 'Y_LT1')
+ OR (geo = 'PL71' AND age = 'Y_LT1')
+ OR (geo = 'PL72' AND age = 'Y_LT1')
+ OR (geo = 'PL8' AND age = 'Y_LT1')
+ OR (geo = 'PL81' AND age = 'Y_LT1')
+ OR (geo = 'PL82' AND age = 'Y_LT1')
+ OR (geo = 'PL84' AND age = 'Y_LT1')
+ OR (geo = 'PL9' AND age = 'Y_LT1')
+ OR (geo = 'PL91' AND age = 'Y_LT1')
+ OR (geo = 'PL92' AND age = 'Y_LT1')
+ OR (geo = 'PT' AND age = 'Y_LT1')
+ OR (geo = 'PT1' AND age = 'Y_LT1')
+ OR (geo = 'PT11' AND age = 'Y_LT1')
+ OR (geo = 'PT15' AND age = 'Y_LT1')
+ OR (geo = 'PT16' AND age = 'Y_LT1')
+ OR (geo = 'PT17' AND age = 'Y_LT1')
+ OR (geo = 'PT18' AND age = 'Y_LT1')
+ OR (geo = 'PT19' AND age = 'Y_LT1')
+ OR (geo = 'PT1A' AND age = 'Y_LT1')
+ OR (geo = 'PT1B' AND age = 'Y_LT1')
+ OR (geo = 'PT1C' AND age = 'Y_LT1')
+ OR (geo = 'PT1D' AND age = 'Y_LT1')
+ OR (geo = 'PT2' AND age = 'Y_LT1')
+ OR (geo = 'PT20' AND age = 'Y_LT1')
+ OR (geo = 'PT3' AND age = 'Y_LT1')
+ OR (geo = 'PT30' AND age = 'Y_LT1')
+ OR (geo = 'RO' AND age = 'Y_LT1')
+ OR (geo = 'RO1' AND age = 'Y_LT1')
+ OR (geo = 'RO11' AND age = 'Y_LT1')
+ OR (geo = 'RO12' AND age = 'Y_LT1')
+ OR (geo = 'RO2' AND age = 'Y_LT1')
+ OR (geo = 'RO21' AND age = 'Y_LT1')
+ OR (geo = 'RO22' AND age = 'Y_LT1')
+ OR (geo = 'RO3' AND age = 'Y_LT1')
+ OR (geo = 'RO31' AND age = 'Y_LT1')
+ OR (geo = 'RO32' AND age = 'Y_LT1')
+ OR (geo = 'RO4' AND age = 'Y_LT1')
+ OR (geo = 'RO41' AND age = 'Y_LT1')
+ OR (geo = 'RO42' AND age = 'Y_LT1')
+ OR (geo = 'SI' AND age = 'Y_LT1')
+ OR (geo = 'SI0' AND age = 'Y_LT1')
+ OR (geo = 'SI03' AND age = 'Y_LT1')
+ OR (geo = 'SI04' AND age = 'Y_LT1')
+ OR (geo = 'SK' AND age = 'Y_LT1')
+ OR (geo = 'SK0' AND age = 'Y_LT1')
+ OR (geo = 'SK01' AND age = 'Y_LT1')
+ OR (geo = 'SK02' AND age = 'Y_LT1')
+ OR (geo = 'SK03' AND age = 'Y_LT1')
+ OR (geo = 'SK04' AND age = 'Y_LT1')
+ OR (geo = 'FI' AND age = 'Y_LT1')
+ OR (geo = 'FI1' AND age = 'Y_LT1')
+ OR (geo = 'FI19' AND age = 'Y_LT1')
+ OR (geo = 'FI1B' AND age = 'Y_LT1')
+ OR (geo = 'FI1C' AND age = 'Y_LT1')
+ OR (geo = 'FI1D' AND age = 'Y_LT1')
+ OR (geo = 'FI2' AND age = 'Y_LT1')
+ OR (geo = 'FI20' AND age = 'Y_LT1')
+ OR (geo = 'SE' AND age = 'Y_LT1')
+ OR (geo = 'SE1' AND age = 'Y_LT1')
+ OR (geo = 'SE11' AND age = 'Y_LT1')
+ OR (geo = 'SE12' AND age = 'Y_LT1')
+ OR (geo = 'SE2' AND age = 'Y_LT1')
+ OR (geo = 'SE21' AND age = 'Y_LT1')
+ OR (geo = 'SE22' AND age = 'Y_LT1')
+ OR (geo = 'SE23' AND age = 'Y_LT1')
+ OR (geo = 'SE3' AND age = 'Y_LT1')
+ OR (geo = 'SE31' AND age = 'Y_LT1')
+ OR (geo = 'SE32' AND age = 'Y_LT1')
+ OR (geo = 'SE33' AND age = 'Y_LT1')
+ OR (geo = 'EFTA' AND age = 'Y_LT1')
+ OR (geo = 'IS' AND age = 'Y_LT1')
+ OR (geo = 'IS0' AND age = 'Y_LT1')
+ OR (geo = 'IS00' AND age = 'Y_LT1')
+ OR (geo = 'LI' AND age = 'Y_LT1')
+ OR (geo = 'LI0' AND age = 'Y_LT1')
+ OR (geo = 'LI00' AND age = 'Y_LT1')
+ OR (geo = 'NO' AND age = 'Y_LT1')
+ OR (geo = 'NO0' AND age = 'Y_LT1')
+ OR (geo = 'NO01' AND age = 'Y_LT1')
+ OR (geo = 'NO02' AND age = 'Y_LT1')
+ OR (geo = 'NO03' AND age = 'Y_LT1')
+ OR (geo = 'NO04' AND age = 'Y_LT1')
+ OR (geo = 'NO05' AND age = 'Y_LT1')
+ OR (geo = 'NO06' AND age = 'Y_LT1')
+ OR (geo = 'NO07' AND age = 'Y_LT1')
+ OR (geo = 'NO08' AND age = 'Y_LT1')
+ OR (geo = 'NO09' AND age = 'Y_LT1')
+ OR (geo = 'NO0A' AND age = 'Y_LT1')
+ OR (geo = 'NO0B' AND age = 'Y_LT1')
+ OR (geo = 'CH' AND age = 'Y_LT1')
+ OR (geo = 'CH0' AND age = 'Y_LT1')
+ OR (geo = 'CH01' AND age = 'Y_LT1')
+ OR (geo = 'CH02' AND age = 'Y_LT1')
+ OR (geo = 'CH03' AND age = 'Y_LT1')
+ OR (geo = 'CH04' AND age = 'Y_LT1')
+ OR (geo = 'CH05' AND age = 'Y_LT1')
+ OR (geo = 'CH06' AND age = 'Y_LT1')
+ OR (geo = 'CH07' AND age = 'Y_LT1')
+ OR (geo = 'UK' AND age = 'Y_LT1')
+ OR (geo = 'UKC' AND age = 'Y_LT1')
+ OR (geo = 'UKC1' AND age = 'Y_LT1')
+ OR (geo = 'UKC2' AND age = 'Y_LT1')
+ OR (geo = 'UKD' AND age = 'Y_LT1')
+ OR (geo = 'UKD1' AND age = 'Y_LT1')
+ OR (geo = 'UKD3' AND age = 'Y_LT1')
+ OR (geo = 'UKD4' AND age = 'Y_LT1')
+ OR (geo = 'UKD6' AND age = 'Y_LT1')
+ OR (geo = 'UKD7' AND age = 'Y_LT1')
+ OR (geo = 'UKE' AND age = 'Y_LT1')
+ OR (geo = 'UKE1' AND age = 'Y_LT1')
+ OR (geo = 'UKE2' AND age = 'Y_LT1')
+ OR (geo = 'UKE3' AND age = 'Y_LT1')
+ OR (geo = 'UKE4' AND age = 'Y_LT1')
+ OR (geo = 'UKF' AND age = 'Y_LT1')
+ OR (geo = 'UKF1' AND age = 'Y_LT1')
+ OR (geo = 'UKF2' AND age = 'Y_LT1')
+ OR (geo = 'UKF3' AND age = 'Y_LT1')
+ OR (geo = 'UKG' AND age = 'Y_LT1')
+ OR (geo = 'UKG1' AND age = 'Y_LT1')
+ OR (geo = 'UKG2' AND age = 'Y_LT1')
+ OR (geo = 'UKG3' AND age = 'Y_LT1')
+ OR (geo = 'UKH' AND age = 'Y_LT1')
+ OR (geo = 'UKH1' AND age = 'Y_LT1')
+ OR (geo = 'UKH2' AND age = 'Y_LT1')
+ OR (geo = 'UKH3' AND age = 'Y_LT1')
+ OR (geo = 'UKI' AND age = 'Y_LT1')
+ OR (geo = 'UKI3' AND age = 'Y_LT1')
+ OR (geo = 'UKI4' AND age = 'Y_LT1')
+ OR (geo = 'UKI5' AND age = 'Y_LT1')
+ OR (geo = 'UKI6' AND age = 'Y_LT1')
+ OR (geo = 'UKI7' AND age = 'Y_LT1')
+ OR (geo = 'UKJ' AND age = 'Y_LT1')
+ OR (geo = 'UKJ1' AND age = 'Y_LT1')
+ OR (geo = 'UKJ2' AND age = 'Y_LT1')
+ OR (geo = 'UKJ3' AND age = 'Y_LT1')
+ OR (geo = 'UKJ4' AND age = 'Y_LT1')
+ OR (geo = 'UKK' AND age = 'Y_LT1')
+ OR (geo = 'UKK1' AND age = 'Y_LT1')
+ OR (geo = 'UKK2' AND age = 'Y_LT1')
+ OR (geo = 'UKK3' AND age = 'Y_LT1')
+ OR (geo = 'UKK4' AND age = 'Y_LT1')
+ OR (geo = 'UKL' AND age = 'Y_LT1')
+ OR (geo = 'UKL1' AND age = 'Y_LT1')
+ OR (geo = 'UKL2' AND age = 'Y_LT1')
+ OR (geo = 'UKM' AND age = 'Y_LT1')
+ OR (geo = 'UKM5' AND age = 'Y_LT1')
+ OR (geo = 'UKM6' AND age = 'Y_LT1')
+ OR (geo = 'UKM7' AND age = 'Y_LT1')
+ OR (geo = 'UKM8' AND age = 'Y_LT1')
+ OR (geo = 'UKM9' AND age = 'Y_LT1')
+ OR (geo = 'UKN' AND age = 'Y_LT1')
+ OR (geo = 'UKN0' AND age = 'Y_LT1')
+ OR (geo = 'ME' AND age = 'Y_LT1')
+ OR (geo = 'ME0' AND age = 'Y_LT1')
+ OR (geo = 'ME00' AND age = 'Y_LT1')
+ OR (geo = 'MK' AND age = 'Y_LT1')
+ OR (geo = 'MK0' AND age = 'Y_LT1')
+ OR (geo = 'MK00' AND age = 'Y_LT1')
+ OR (geo = 'MKX' AND age = 'Y_LT1')
+ OR (geo = 'MKXX' AND age = 'Y_LT1')
+ OR (geo = 'AL' AND age = 'Y_LT1')
+ OR (geo = 'AL0' AND age = 'Y_LT1')
+ OR (geo = 'AL01' AND age = 'Y_LT1')
+ OR (geo = 'AL02' AND age = 'Y_LT1')
+ OR (geo = 'AL03' AND age = 'Y_LT1')
+ OR (geo = 'ALX' AND age = 'Y_LT1')
+ OR (geo = 'ALXX' AND age = 'Y_LT1')
+ OR (geo = 'RS' AND age = 'Y_LT1')
+ OR (geo = 'RS1' AND age = 'Y_LT1')
+ OR (geo = 'RS11' AND age = 'Y_LT1')
+ OR (geo = 'RS12' AND age = 'Y_LT1')
+ OR (geo = 'RS2' AND age = 'Y_LT1')
+ OR (geo = 'RS21' AND age = 'Y_LT1')
+ OR (geo = 'RS22' AND age = 'Y_LT1')
+ OR (geo = 'TR' AND age = 'Y_LT1')
+ OR (geo = 'TR1' AND age = 'Y_LT1')
+ OR (geo = 'TR10' AND age = 'Y_LT1')
+ OR (geo = 'TR2' AND age = 'Y_LT1')
+ OR (geo = 'TR21' AND age = 'Y_LT1')
+ OR (geo = 'TR22' AND age = 'Y_LT1')
+ OR (geo = 'TR3' AND age = 'Y_LT1')
+ OR (geo = 'TR31' AND age = 'Y_LT1')
+ OR (geo = 'TR32' AND age = 'Y_LT1')
+ OR (geo = 'TR33' AND age = 'Y_LT1')
+ OR (geo = 'TR4' AND age = 'Y_LT1')
+ OR (geo = 'TR41' AND age = 'Y_LT1')
+ OR (geo = 'TR42' AND age = 'Y_LT1')
+ OR (geo = 'TR5' AND age = 'Y_LT1')
+ OR (geo = 'TR51' AND age = 'Y_LT1')
+ OR (geo = 'TR52' AND age = 'Y_LT1')
+ OR (geo = 'TR6' AND age = 'Y_LT1')
+ OR (geo = 'TR61' AND age = 'Y_LT1')
+ OR (geo = 'TR62' AND age = 'Y_LT1')
+ OR (geo = 'TR63' AND age = 'Y_LT1')
+ OR (geo = 'TR7' AND age = 'Y_LT1')
+ OR (geo = 'TR71' AND age = 'Y_LT1')
+ OR (geo = 'TR72' AND age = 'Y_LT1')
+ OR (geo = 'TR8' AND age = 'Y_LT1')
+ OR (geo = 'TR81' AND age = 'Y_LT1')
+ OR (geo = 'TR82' AND age = 'Y_LT1')
+ OR (geo = 'TR83' AND age = 'Y_LT1')
+ OR (geo = 'TR9' AND age = 'Y_LT1')
+ OR (geo = 'TR90' AND age = 'Y_LT1')
+ OR (geo = 'TRA' AND age = 'Y_LT1')
+ OR (geo = 'TRA1' AND age = 'Y_LT1')
+ OR (geo = 'TRA2' AND age = 'Y_LT1')
+ OR (geo = 'TRB' AND age = 'Y_LT1')
+ OR (geo = 'TRB1' AND age = 'Y_LT1')
+ OR (geo = 'TRB2' AND age = 'Y_LT1')
+ OR (geo = 'TRC' AND age = 'Y_LT1')
+ OR (geo = 'TRC1' AND age = 'Y_LT1')
+ OR (geo = 'TRC2' AND age = 'Y_LT1')
+ OR (geo = 'TRC3' AND age = 'Y_LT1')
+ OR (geo = 'EU27_2020' AND age = 'Y1')
+ OR (geo = 'EU28' AND age = 'Y1')
+ OR (geo = 'EU27_2007' AND age = 'Y1')
+ OR (geo = 'BE' AND age = 'Y1')
+ OR (geo = 'BE1' AND age = 'Y1')
+ OR (geo = 'BE10' AND age = 'Y1')
+ OR (geo = 'BE2' AND age = 'Y1')
+ OR (geo = 'BE21' AND age = 'Y1')
+ OR (geo = 'BE22' AND age = 'Y1')
+ OR (geo = 'BE23' AND age = 'Y1')
+ OR (geo = 'BE24' AND age = 'Y1')
+ OR (geo = 'BE25' AND age = 'Y1')
+ OR (geo = 'BE3' AND age = 'Y1')
+ OR (geo = 'BE31' AND age = 'Y1')
+ OR (geo = 'BE32' AND age = 'Y1')
+ OR (geo = 'BE33' AND age = 'Y1')
+ OR (geo = 'BE34' AND age = 'Y1')
+ OR (geo = 'BE35' AND age = 'Y1')
+ OR (geo = 'BG' AND age = 'Y1')
+ OR (geo = 'BG3' AND age = 'Y1')
+ OR (geo = 'BG31' AND age = 'Y1')
+ OR (geo = 'BG32' AND age = 'Y1')
+ OR (geo = 'BG33' AND age = 'Y1')
+ OR (geo = 'BG34' AND age = 'Y1')
+ OR (geo = 'BG4' AND age = 'Y1')
+ OR (geo = 'BG41' AND age = 'Y1')
+ OR (geo = 'BG42' AND age = 'Y1')
+ OR (geo = 'CZ' AND age = 'Y1')
+ OR (geo = 'CZ0' AND age = 'Y1')
+ OR (geo = 'CZ01' AND age = 'Y1')
+ OR (geo = 'CZ02' AND age = 'Y1')
+ OR (geo = 'CZ03' AND age = 'Y1')
+ OR (geo = 'CZ04' AND age = 'Y1')
+ OR (geo = 'CZ05' AND age = 'Y1')
+ OR (geo = 'CZ06' AND age = 'Y1')
+ OR (geo = 'CZ07' AND age = 'Y1')
+ OR (geo = 'CZ08' AND age = 'Y1')
+ OR (geo = 'DK' AND age = 'Y1')
+ OR (geo = 'DK0' AND age = 'Y1')
+ OR (geo = 'DK01' AND age = 'Y1')
+ OR (geo = 'DK02' AND age = 'Y1')
+ OR (geo = 'DK03' AND age = 'Y1')
+ OR (geo = 'DK04' AND age = 'Y1')
+ OR (geo = 'DK05' AND age = 'Y1')
+ OR (geo = 'DE' AND age = 'Y1')
+ OR (geo = 'DE_TOT' AND age = 'Y1')
+ OR (geo = 'DE1' AND age = 'Y1')
+ OR (geo = 'DE11' AND age = 'Y1')
+ OR (geo = 'DE12' AND age = 'Y1')
+ OR (geo = 'DE13' AND age = 'Y1')
+ OR (geo = 'DE14' AND age = 'Y1')
+ OR (geo = 'DE2' AND age = 'Y1')
+ OR (geo = 'DE21' AND age = 'Y1')
+ OR (geo = 'DE22' AND age = 'Y1')
+ OR (geo = 'DE23' AND age = 'Y1')
+ OR (geo = 'DE24' AND age = 'Y1')
+ OR (geo = 'DE25' AND age = 'Y1')
+ OR (geo = 'DE26' AND age = 'Y1')
+ OR (geo = 'DE27' AND age = 'Y1')
+ OR (geo = 'DE3' AND age = 'Y1')
+ OR (geo = 'DE30' AND age = 'Y1')
+ OR (geo = 'DE4' AND age = 'Y1')
+ OR (geo = 'DE40' AND age = 'Y1')
+ OR (geo = 'DE5' AND age = 'Y1')
+ OR (geo = 'DE50' AND age = 'Y1')
+ OR (geo = 'DE6' AND age = 'Y1')
+ OR (geo = 'DE60' AND age = 'Y1')
+ OR (geo = 'DE7' AND age = 'Y1')
+ OR (geo = 'DE71' AND age = 'Y1')
+ OR (geo = 'DE72' AND age = 'Y1')
+ OR (geo = 'DE73' AND age = 'Y1')
+ OR (geo = 'DE8' AND age = 'Y1')
+ OR (geo = 'DE80' AND age = 'Y1')
+ OR (geo = 'DE9' AND age = 'Y1')
+ OR (geo = 'DE91' AND age = 'Y1')
+ OR (geo = 'DE92' AND age = 'Y1')
+ OR (geo = 'DE93' AND age = 'Y1')
+ OR (geo = 'DE94' AND age = 'Y1')
+ OR (geo = 'DEA' AND age = 'Y1')
+ OR (geo = 'DEA1' AND age = 'Y1')
+ OR (geo = 'DEA2' AND age = 'Y1')
+ OR (geo = 'DEA3' AND age = 'Y1')
+ OR (geo = 'DEA4' AND age = 'Y1')
+ OR (geo = 'DEA5' AND age = 'Y1')
+ OR (geo = 'DEB' AND age = 'Y1')
+ OR (geo = 'DEB1' AND age = 'Y1')
+ OR (geo = 'DEB2' AND age = 'Y1')
+ OR (geo = 'DEB3' AND age = 'Y1')
+ OR (geo = 'DEC' AND age = 'Y1')
+ OR (geo = 'DEC0' AND age = 'Y1')
+ OR (geo = 'DED' AND age = 'Y1')
+ OR (geo = 'DED2' AND age = 'Y1')
+ OR (geo = 'DED4' AND age = 'Y1')
+ OR (geo = 'DED5' AND age = 'Y1')
+ OR (geo = 'DEE' AND age = 'Y1')
+ OR (geo = 'DEE0' AND age = 'Y1')
+ OR (geo = 'DEF' AND age = 'Y1')
+ OR (geo = 'DEF0' AND age = 'Y1')
+ OR (geo = 'DEG' AND age = 'Y1')
+ OR (geo = 'DEG0' AND age = 'Y1')
+ OR (geo = 'EE' AND age = 'Y1')
+ OR (geo = 'EE0' AND age = 'Y1')
+ OR (geo = 'EE00' AND age = 'Y1')
+ OR (geo = 'IE' AND age = 'Y1')
+ OR (geo = 'IE0' AND age = 'Y1')
+ OR (geo = 'IE04' AND age = 'Y1')
+ OR (geo = 'IE05' AND age = 'Y1')
+ OR (geo = 'IE06' AND age = 'Y1')
+ OR (geo = 'EL' AND age = 'Y1')
+ OR (geo = 'EL3' AND age = 'Y1')
+ OR (geo = 'EL30' AND age = 'Y1')
+ OR (geo = 'EL4' AND age = 'Y1')
+ OR (geo = 'EL41' AND age = 'Y1')
+ OR (geo = 'EL42' AND age = 'Y1')
+ OR (geo = 'EL43' AND age = 'Y1')
+ OR (geo = 'EL5' AND age = 'Y1')
+ OR (geo = 'EL51' AND age = 'Y1')
+ OR (geo = 'EL52' AND age = 'Y1')
+ OR (geo = 'EL53' AND age = 'Y1')
+ OR (geo = 'EL54' AND age = 'Y1')
+ OR (geo = 'EL6' AND age = 'Y1')
+ OR (geo = 'EL61' AND age = 'Y1')
+ OR (geo = 'EL62' AND age = 'Y1')
+ OR (geo = 'EL63' AND age = 'Y1')
+ OR (geo = 'EL64' AND age = 'Y1')
+ OR (geo = 'EL65' AND age = 'Y1')
+ OR (geo = 'ES' AND age = 'Y1')
+ OR (geo = 'ES1' AND age = 'Y1')
+ OR (geo = 'ES11' AND age = 'Y1')
+ OR (geo = 'ES12' AND age = 'Y1')
+ OR (geo = 'ES13' AND age = 'Y1')
+ OR (geo = 'ES2' AND age = 'Y1')
+ OR (geo = 'ES21' AND age = 'Y1')
+ OR (geo = 'ES22' AND age = 'Y1')
+ OR (geo = 'ES23' AND age = 'Y1')
+ OR (geo = 'ES24' AND age = 'Y1')
+ OR (geo = 'ES3' AND age = 'Y1')
+ OR (geo = 'ES30' AND age = 'Y1')
+ OR (geo = 'ES4' AND age = 'Y1')
+ OR (geo = 'ES41' AND age = 'Y1')
+ OR (geo = 'ES42' AND age = 'Y1')
+ OR (geo = 'ES43' AND age = 'Y1')
+ OR (geo = 'ES5' AND age = 'Y1')
+ OR (geo = 'ES51' AND age = 'Y1')
+ OR (geo = 'ES52' AND age = 'Y1')
+ OR (geo = 'ES53' AND age = 'Y1')
+ OR (geo = 'ES6' AND age = 'Y1')
+ OR (geo = 'ES61' AND age = 'Y1')
+ OR (geo = 'ES62' AND age = 'Y1')
+ OR (geo = 'ES63' AND age = 'Y1')
+ OR (geo = 'ES64' AND age = 'Y1')
+ OR (geo = 'ES7' AND age = 'Y1')
+ OR (geo = 'ES70' AND age = 'Y1')
+ OR (geo = 'FR' AND age = 'Y1')
+ OR (geo = 'FR1' AND age = 'Y1')
+ OR (geo = 'FR10' AND age = 'Y1')
+ OR (geo = 'FRB' AND age = 'Y1')
+ OR (geo = 'FRB0' AND age = 'Y1')
+ OR (geo = 'FRC' AND age = 'Y1')
+ OR (geo = 'FRC1' AND age = 'Y1')
+ OR (geo = 'FRC2' AND age = 'Y1')
+ OR (geo = 'FRD' AND age = 'Y1')
+ OR (geo = 'FRD1' AND age = 'Y1')
+ OR (geo = 'FRD2' AND age = 'Y1')
+ OR (geo = 'FRE' AND age = 'Y1')
+ OR (geo = 'FRE1' AND age = 'Y1')
+ OR (geo = 'FRE2' AND age = 'Y1')
+ OR (geo = 'FRF' AND age = 'Y1')
+ OR (geo = 'FRF1' AND age = 'Y1')
+ OR (geo = 'FRF2' AND age = 'Y1')
+ OR (geo = 'FRF3' AND age = 'Y1')
+ OR (geo = 'FRG' AND age = 'Y1')
+ OR (geo = 'FRG0' AND age = 'Y1')
+ OR (geo = 'FRH' AND age = 'Y1')
+ OR (geo = 'FRH0' AND age = 'Y1')
+ OR (geo = 'FRI' AND age = 'Y1')
+ OR (geo = 'FRI1' AND age = 'Y1')
+ OR (geo = 'FRI2' AND age = 'Y1')
+ OR (geo = 'FRI3' AND age = 'Y1')
+ OR (geo = 'FRJ' AND age = 'Y1')
+ OR (geo = 'FRJ1' AND age = 'Y1')
+ OR (geo = 'FRJ2' AND age = 'Y1')
+ OR (geo = 'FRK' AND age = 'Y1')
+ OR (geo = 'FRK1' AND age = 'Y1')
+ OR (geo = 'FRK2' AND age = 'Y1')
+ OR (geo = 'FRL' AND age = 'Y1')
+ OR (geo = 'FRL0' AND age = 'Y1')
+ OR (geo = 'FRM' AND age = 'Y1')
+ OR (geo = 'FRM0' AND age = 'Y1')
+ OR (geo = 'FRY' AND age = 'Y1')
+ OR (geo = 'FRY1' AND age = 'Y1')
+ OR (geo = 'FRY2' AND age = 'Y1')
+ OR (geo = 'FRY3' AND age = 'Y1')
+ OR (geo = 'FRY4' AND age = 'Y1')
+ OR (geo = 'FRY5' AND age = 'Y1')
+ OR (geo = 'FRX' AND age = 'Y1')
+ OR (geo = 'FRXX' AND age = 'Y1')
+ OR (geo = 'HR' AND age = 'Y1')
+ OR (geo = 'HR0' AND age = 'Y1')
+ OR (geo = 'HR02' AND age = 'Y1')
+ OR (geo = 'HR03' AND age = 'Y1')
+ OR (geo = 'HR04' AND age = 'Y1')
+ OR (geo = 'HR05' AND age = 'Y1')
+ OR (geo = 'HR06' AND age = 'Y1')
+ OR (geo = 'IT' AND age = 'Y1')
+ OR (geo = 'ITC' AND age = 'Y1')
+ OR (geo = 'ITC1' AND age = 'Y1')
+ OR (geo = 'ITC2' AND age = 'Y1')
+ OR (geo = 'ITC3' AND age = 'Y1')
+ OR (geo = 'ITC4' AND age = 'Y1')
+ OR (geo = 'ITF' AND age = 'Y1')
+ OR (geo = 'ITF1' AND age = 'Y1')
+ OR (geo = 'ITF2' AND age = 'Y1')
+ OR (geo = 'ITF3' AND age = 'Y1')
+ OR (geo = 'ITF4' AND age = 'Y1')
+ OR (geo = 'ITF5' AND age = 'Y1')
+ OR (geo = 'ITF6' AND age = 'Y1')
+ OR (geo = 'ITG' AND age = 'Y1')
+ OR (geo = 'ITG1' AND age = 'Y1')
+ OR (geo = 'ITG2' AND age = 'Y1')
+ OR (geo = 'ITH' AND age = 'Y1')
+ OR (geo = 'ITH1' AND age = 'Y1')
+ OR (geo = 'ITH2' AND age = 'Y1')
+ OR (geo = 'ITH3' AND age = 'Y1')
+ OR (geo = 'ITH4' AND age = 'Y1')
+ OR (geo = 'ITH5' AND age = 'Y1')
+ OR (geo = 'ITI' AND age = 'Y1')
+ OR (geo = 'ITI1' AND age = 'Y1')
+ OR (geo = 'ITI2' AND age = 'Y1')
+ OR (geo = 'ITI3' AND age = 'Y1')
+ OR (geo = 'ITI4' AND age = 'Y1')
+ OR (geo = 'CY' AND age = 'Y1')
+ OR (geo = 'CY0' AND age = 'Y1')
+ OR (geo = 'CY00' AND age = 'Y1')
+ OR (geo = 'LV' AND age = 'Y1')
+ OR (geo = 'LV0' AND age = 'Y1')
+ OR (geo = 'LV00' AND age = 'Y1')
+ OR (geo = 'LT' AND age = 'Y1')
+ OR (geo = 'LT0' AND age = 'Y1')
+ OR (geo = 'LT01' AND age = 'Y1')
+ OR (geo = 'LT02' AND age = 'Y1')
+ OR (geo = 'LU' AND age = 'Y1')
+ OR (geo = 'LU0' AND age = 'Y1')
+ OR (geo = 'LU00' AND age = 'Y1')
+ OR (geo = 'HU' AND age = 'Y1')
+ OR (geo = 'HU1' AND age = 'Y1')
+ OR (geo = 'HU11' AND age = 'Y1')
+ OR (geo = 'HU12' AND age = 'Y1')
+ OR (geo = 'HU2' AND age = 'Y1')
+ OR (geo = 'HU21' AND age = 'Y1')
+ OR (geo = 'HU22' AND age = 'Y1')
+ OR (geo = 'HU23' AND age = 'Y1')
+ OR (geo = 'HU3' AND age = 'Y1')
+ OR (geo = 'HU31' AND age = 'Y1')
+ OR (geo = 'HU32' AND age = 'Y1')
+ OR (geo = 'HU33' AND age = 'Y1')
+ OR (geo = 'HUX' AND age = 'Y1')
+ OR (geo = 'HUXX' AND age = 'Y1')
+ OR (geo = 'MT' AND age = 'Y1')
+ OR (geo = 'MT0' AND age = 'Y1')
+ OR (geo = 'MT00' AND age = 'Y1')
+ OR (geo = 'NL' AND age = 'Y1')
+ OR (geo = 'NL1' AND age = 'Y1')
+ OR (geo = 'NL11' AND age = 'Y1')
+ OR (geo = 'NL12' AND age = 'Y1')
+ OR (geo = 'NL13' AND age = 'Y1')
+ OR (geo = 'NL2' AND age = 'Y1')
+ OR (geo = 'NL21' AND age = 'Y1')
+ OR (geo = 'NL22' AND age = 'Y1')
+ OR (geo = 'NL23' AND age = 'Y1')
+ OR (geo = 'NL3' AND age = 'Y1')
+ OR (geo = 'NL31' AND age = 'Y1')
+ OR (geo = 'NL32' AND age = 'Y1')
+ OR (geo = 'NL33' AND age = 'Y1')
+ OR (geo = 'NL34' AND age = 'Y1')
+ OR (geo = 'NL35' AND age = 'Y1')
+ OR (geo = 'NL36' AND age = 'Y1')
+ OR (geo = 'NL4' AND age = 'Y1')
+ OR (geo = 'NL41' AND age = 'Y1')
+ OR (geo = 'NL42' AND age = 'Y1')
+ OR (geo = 'AT' AND age = 'Y1')
+ OR (geo = 'AT1' AND age = 'Y1')
+ OR (geo = 'AT11' AND age = 'Y1')
+ OR (geo = 'AT12' AND age = 'Y1')
+ OR (geo = 'AT13' AND age = 'Y1')
+ OR (geo = 'AT2' AND age = 'Y1')
+ OR (geo = 'AT21' AND age = 'Y1')
+ OR (geo = 'AT22' AND age = 'Y1')
+ OR (geo = 'AT3' AND age = 'Y1')
+ OR (geo = 'AT31' AND age = 'Y1')
+ OR (geo = 'AT32' AND age = 'Y1')
+ OR (geo = 'AT33' AND age = 'Y1')
+ OR (geo = 'AT34' AND age = 'Y1')
+ OR (geo = 'PL' AND age = 'Y1')
+ OR (geo = 'PL2' AND age = 'Y1')
+ OR (geo = 'PL21' AND age = 'Y1')
+ OR (geo = 'PL22' AND age = 'Y1')
+ OR (geo = 'PL4' AND age = 'Y1')
+ OR (geo = 'PL41' AND age = 'Y1')
+ OR (geo = 'PL42' AND age = 'Y1')
+ OR (geo = 'PL43' AND age = 'Y1')
+ OR (geo = 'PL5' AND age = 'Y1')
+ OR (geo = 'PL51' AND age = 'Y1')
+ OR (geo = 'PL52' AND age = 'Y1')
+ OR (geo = 'PL6' AND age = 'Y1')
+ OR (geo = 'PL61' AND age = 'Y1')
+ OR (geo = 'PL62' AND age = 'Y1')
+ OR (geo = 'PL63' AND age = 'Y1')
+ OR (geo = 'PL7' AND age = 'Y1')
+ OR (geo = 'PL71' AND age = 'Y1')
+ OR (geo = 'PL72' AND age = 'Y1')
+ OR (geo = 'PL8' AND age = 'Y1')
+ OR (geo = 'PL81' AND age = 'Y1')
+ OR (geo = 'PL82' AND age = 'Y1')
+ OR (geo = 'PL84' AND age = 'Y1')
+ OR (geo = 'PL9' AND age = 'Y1')
+ OR (geo = 'PL91' AND age = 'Y1')
+ OR (geo = 'PL92' AND age = 'Y1')
+ OR (geo = 'PT' AND age = 'Y1')
+ OR (geo = 'PT1' AND age = 'Y1')
+ OR (geo = 'PT11' AND age = 'Y1')
+ OR (geo = 'PT15' AND age = 'Y1')
+ OR (geo = 'PT16' AND age = 'Y1')
+ OR (geo = 'PT17' AND age = 'Y1')
+ OR (geo = 'PT18' AND age = 'Y1')
+ OR (geo = 'PT19' AND age = 'Y1')
+ OR (geo = 'PT1A' AND age = 'Y1')
+ OR (geo = 'PT1B' AND age = 'Y1')
+ OR (geo = 'PT1C' AND age = 'Y1')
+ OR (geo = 'PT1D' AND age = 'Y1')
+ OR (geo = 'PT2' AND age = 'Y1')
+ OR (geo = 'PT20' AND age = 'Y1')
+ OR (geo = 'PT3' AND age = 'Y1')
+ OR (geo = 'PT30' AND age = 'Y1')
+ OR (geo = 'RO' AND age = 'Y1')
+ OR (geo = 'RO1' AND age = 'Y1')
+ OR (geo = 'RO11' AND age = 'Y1')
+ OR (geo = 'RO12' AND age = 'Y1')
+ OR (geo = 'RO2' AND age = 'Y1')
+ OR (geo = 'RO21' AND age = 'Y1')
+ OR (geo = 'RO22' AND age = 'Y1')
+ OR (geo = 'RO3' AND age = 'Y1')
+ OR (geo = 'RO31' AND age = 'Y1')
+ OR (geo = 'RO32' AND age = 'Y1')
+ OR (geo = 'RO4' AND age = 'Y1')
+ OR (geo = 'RO41' AND age = 'Y1')
+ OR (geo = 'RO42' AND age = 'Y1')
+ OR (geo = 'SI' AND age = 'Y1')
+ OR (geo = 'SI0' AND age = 'Y1')
+ OR (geo = 'SI03' AND age = 'Y1')
+ OR (geo = 'SI04' AND age = 'Y1')
+ OR (geo = 'SK' AND age = 'Y1')
+ OR (geo = 'SK0' AND age = 'Y1')
+ OR (geo = 'SK01' AND age = 'Y1')
+ OR (geo = 'SK02' AND age = 'Y1')
+ OR (geo = 'SK03' AND age = 'Y1')
+ OR (geo = 'SK04' AND age = 'Y1')
+ OR (geo = 'FI' AND age = 'Y1')
+ OR (geo = 'FI1' AND age = 'Y1')
+ OR (geo = 'FI19' AND age = 'Y1')
+ OR (geo = 'FI1B' AND age = 'Y1')
+ OR (geo = 'FI1C' AND age = 'Y1')
+ OR (geo = 'FI1D' AND age = 'Y1')
+ OR (geo = 'FI2' AND age = 'Y1')
+ OR (geo = 'FI20' AND age = 'Y1')
+ OR (geo = 'SE' AND age = 'Y1')
+ OR (geo = 'SE1' AND age = 'Y1')
+ OR (geo = 'SE11' AND age = 'Y1')
+ OR (geo = 'SE12' AND age = 'Y1')
+ OR (geo = 'SE2' AND age = 'Y1')
+ OR (geo = 'SE21' AND age = 'Y1')
+ OR (geo = 'SE22' AND age = 'Y1')
+ OR (geo = 'SE23' AND age = 'Y1')
+ OR (geo = 'SE3' AND age = 'Y1')
+ OR (geo = 'SE31' AND age = 'Y1')
+ OR (geo = 'SE32' AND age = 'Y1')
+ OR (geo = 'SE33' AND age = 'Y1')
+ OR (geo = 'EFTA' AND age = 'Y1')
+ OR (geo = 'IS' AND age = 'Y1')
+ OR (geo = 'IS0' AND age = 'Y1')
+ OR (geo = 'IS00' AND age = 'Y1')
+ OR (geo = 'LI' AND age = 'Y1')
+ OR (geo = 'LI0' AND age = 'Y1')
+ OR (geo = 'LI00' AND age = 'Y1')
+ OR (geo = 'NO' AND age = 'Y1')
+ OR (geo = 'NO0' AND age = 'Y1')
+ OR (geo = 'NO01' AND age = 'Y1')
+ OR (geo = 'NO02' AND age = 'Y1')
+ OR (geo = 'NO03' AND age = 'Y1')
+ OR (geo = 'NO04' AND age = 'Y1')
+ OR (geo = 'NO05' AND age = 'Y1')
+ OR (geo = 'NO06' AND age = 'Y1')
+ OR (geo = 'NO07' AND age = 'Y1')
+ OR (geo = 'NO08' AND age = 'Y1')
+ OR (geo = 'NO09' AND age = 'Y1')
+ OR (geo = 'NO0A' AND age = 'Y1')
+ OR (geo = 'NO0B' AND age = 'Y1')
+ OR (geo = 'CH' AND age = 'Y1')
+ OR (geo = 'CH0' AND age = 'Y1')
+ OR (geo = 'CH01' AND age = 'Y1')
+ OR (geo = 'CH02' AND age = 'Y1')
+ OR (geo = 'CH03' AND age = 'Y1')
+ OR (geo = 'CH04' AND age = 'Y1')
+ OR (geo = 'CH05' AND age = 'Y1')
+ OR (geo = 'CH06' AND age = 'Y1')
+ OR (geo = 'CH07' AND age = 'Y1')
+ OR (geo = 'UK' AND age = 'Y1')
+ OR (geo = 'UKC' AND age = 'Y1')
+ OR (geo = 'UKC1' AND age = 'Y1')
+ OR (geo = 'UKC2' AND age = 'Y1')
+ OR (geo = 'UKD' AND age = 'Y1')
+ OR (geo = 'UKD1' AND age = 'Y1')
+ OR (geo = 'UKD3' AND age = 'Y1')
+ OR (geo = 'UKD4' AND age = 'Y1')
+ OR (geo = 'UKD6' AND age = 'Y1')
+ OR (geo = 'UKD7' AND age = 'Y1')
+ OR (geo = 'UKE' AND age = 'Y1')
+ OR (geo = 'UKE1' AND age = 'Y1')
+ OR (geo = 'UKE2' AND age = 'Y1')
+ OR (geo = 'UKE3' AND age = 'Y1')
+ OR (geo = 'UKE4' AND age = 'Y1')
+ OR (geo = 'UKF' AND age = 'Y1')
+ OR (geo = 'UKF1' AND age = 'Y1')
+ OR (geo = 'UKF2' AND age = 'Y1')
+ OR (geo = 'UKF3' AND age = 'Y1')
+ OR (geo = 'UKG' AND age = 'Y1')
+ OR (geo = 'UKG1' AND age = 'Y1')
+ OR (geo = 'UKG2' AND age = 'Y1')
+ OR (geo = 'UKG3' AND age = 'Y1')
+ OR (geo = 'UKH' AND age = 'Y1')
+ OR (geo = 'UKH1' AND age = 'Y1')
+ OR (geo = 'UKH2' AND age = 'Y1')
+ OR (geo = 'UKH3' AND age = 'Y1')
+ OR (geo = 'UKI' AND age = 'Y1')
+ OR (geo = 'UKI3' AND age = 'Y1')
+ OR (geo = 'UKI4' AND age = 'Y1')
+ OR (geo = 'UKI5' AND age = 'Y1')
+ OR (geo = 'UKI6' AND age = 'Y1')
+ OR (geo = 'UKI7' AND age = 'Y1')
+ OR (geo = 'UKJ' AND age = 'Y1')
+ OR (geo = 'UKJ1' AND age = 'Y1')
+ OR (geo = 'UKJ2' AND age = 'Y1')
+ OR (geo = 'UKJ3' AND age = 'Y1')
+ OR (geo = 'UKJ4' AND age = 'Y1')
+ OR (geo = 'UKK' AND age = 'Y1')
+ OR (geo = 'UKK1' AND age = 'Y1')
+ OR (geo = 'UKK2' AND age = 'Y1')
+ OR (geo = 'UKK3' AND age = 'Y1')
+ OR (geo = 'UKK4' AND age = 'Y1')
+ OR (geo = 'UKL' AND age = 'Y1')
+ OR (geo = 'UKL1' AND age = 'Y1')
+ OR (geo = 'UKL2' AND age = 'Y1')
+ OR (geo = 'UKM' AND age = 'Y1')
+ OR (geo = 'UKM5' AND age = 'Y1')
+ OR (geo = 'UKM6' AND age = 'Y1')
+ OR (geo = 'UKM7' AND age = 'Y1')
+ OR (geo = 'UKM8' AND age = 'Y1')
+ OR (geo = 'UKM9' AND age = 'Y1')
+ OR (geo = 'UKN' AND age = 'Y1')
+ OR (geo = 'UKN0' AND age = 'Y1')
+ OR (geo = 'ME' AND age = 'Y1')
+ OR (geo = 'ME0' AND age = 'Y1')
+ OR (geo = 'ME00' AND age = 'Y1')
+ OR (geo = 'MK' AND age = 'Y1')
+ OR (geo = 'MK0' AND age = 'Y1')
+ OR (geo = 'MK00' AND age = 'Y1')
+ OR (geo = 'MKX' AND age = 'Y1')
+ OR (geo = 'MKXX' AND age = 'Y1')
+ OR (geo = 'AL' AND age = 'Y1')
+ OR (geo = 'AL0' AND age = 'Y1')
+ OR (geo = 'AL01' AND age = 'Y1')
+ OR (geo = 'AL02' AND age = 'Y1')
+ OR (geo = 'AL03' AND age = 'Y1')
+ OR (geo = 'ALX' AND age = 'Y1')
+ OR (geo = 'ALXX' AND age = 'Y1')
+ OR (geo = 'RS' AND age = 'Y1')
+ OR (geo = 'RS1' AND age = 'Y1')
+ OR (geo = 'RS11' AND age = 'Y1')
+ OR (geo = 'RS12' AND age = 'Y1')
+ OR (geo = 'RS2' AND age = 'Y1')
+ OR (geo = 'RS21' AND age = 'Y1')
+ OR (geo = 'RS22' AND age = 'Y1')
+ OR (geo = 'TR' AND age = 'Y1')
+ OR (geo = 'TR1' AND age = 'Y1')
+ OR (geo = 'TR10' AND age = 'Y1')
+ OR (geo = 'TR2' AND age = 'Y1')
+ OR (geo = 'TR21' AND age = 'Y1')
+ OR (geo = 'TR22' AND age = 'Y1')
+ OR (geo = 'TR3' AND age = 'Y1')
+ OR (geo = 'TR31' AND age = 'Y1')
+ OR (geo = 'TR32' AND age = 'Y1')
+ OR (geo = 'TR33' AND age = 'Y1')
+ OR (geo = 'TR4' AND age = 'Y1')
+ OR (geo = 'TR41' AND age = 'Y1')
+ OR (geo = 'TR42' AND age = 'Y1')
+ OR (geo = 'TR5' AND age = 'Y1')
+ OR (geo = 'TR51' AND age = 'Y1')
+ OR (geo = 'TR52' AND age = 'Y1')
+ OR (geo = 'TR6' AND age = 'Y1')
+ OR (geo = 'TR61' AND age = 'Y1')
+ OR (geo = 'TR62' AND age = 'Y1')
+ OR (geo = 'TR63' AND age = 'Y1')
+ OR (geo = 'TR7' AND age = 'Y1')
+ OR (geo = 'TR71' AND age = 'Y1')
+ OR (geo = 'TR72' AND age = 'Y1')
+ OR (geo = 'TR8' AND age = 'Y1')
+ OR (geo = 'TR81' AND age = 'Y1')
+ OR (geo = 'TR82' AND age = 'Y1')
+ OR (geo = 'TR83' AND age = 'Y1')
+ OR (geo = 'TR9' AND age = 'Y1')
+ OR (geo = 'TR90' AND age = 'Y1')
+ OR (geo = 'TRA' AND age = 'Y1')
+ OR (geo = 'TRA1' AND age = 'Y1')
+ OR (geo = 'TRA2' AND age = 'Y1')
+ OR (geo = 'TRB' AND age = 'Y1')
+ OR (geo = 'TRB1' AND age = 'Y1')
+ OR (geo = 'TRB2' AND age = 'Y1')
+ OR (geo = 'TRC' AND age = 'Y1')
+ OR (geo = 'TRC1' AND age = 'Y1')
+ OR (geo = 'TRC2' AND age = 'Y1')
+ OR (geo = 'TRC3' AND age = 'Y1')
+ OR (geo = 'EU27_2020' AND age = 'Y2')
+ OR (geo = 'EU28' AND age = 'Y2')
+ OR (geo = 'EU27_2007' AND age = 'Y2')
+ OR (geo = 'BE' AND age = 'Y2')
+ OR (geo = 'BE1' AND age = 'Y2')
+ OR (geo = 'BE10' AND age = 'Y2')
+ OR (geo = 'BE2' AND age = 'Y2')
+ OR (geo = 'BE21' AND age = 'Y2')
+ OR (geo = 'BE22' AND age = 'Y2')
+ OR (geo = 'BE23' AND age = 'Y2')
+ OR (geo = 'BE24' AND age = 'Y2')
+ OR (geo = 'BE25' AND age = 'Y2')
+ OR (geo = 'BE3' AND age = 'Y2')
+ OR (geo = 'BE31' AND age = 'Y2')
+ OR (geo = 'BE32' AND age = 'Y2')
+ OR (geo = 'BE33' AND age = 'Y2')
+ OR (geo = 'BE34' AND age = 'Y2')
+ OR (geo = 'BE35' AND age = 'Y2')
+ OR (geo = 'BG' AND age = 'Y2')
+ OR (geo = 'BG3' AND age = 'Y2')
+ OR (geo = 'BG31' AND age = 'Y2')
+ OR (geo = 'BG32' AND age = 'Y2')
+ OR (geo = 'BG33' AND age = 'Y2')
+ OR (geo = 'BG34' AND age = 'Y2')
+ OR (geo = 'BG4' AND age = 'Y2')
+ OR (geo = 'BG41' AND age = 'Y2')
+ OR (geo = 'BG42' AND age = 'Y2')
+ OR (geo = 'CZ' AND age = 'Y2')
+ OR (geo = 'CZ0' AND age = 'Y2')
+ OR (geo = 'CZ01' AND age = 'Y2')
+ OR (geo = 'CZ02' AND age = 'Y2')
+ OR (geo = 'CZ03' AND age = 'Y2')
+ OR (geo = 'CZ04' AND age = 'Y2')
+ OR (geo = 'CZ05' AND age = 'Y2')
+ OR (geo = 'CZ06' AND age = 'Y2')
+ OR (geo = 'CZ07' AND age = 'Y2')
+ OR (geo = 'CZ08' AND age = 'Y2')
+ OR (geo = 'DK' AND age = 'Y2')
+ OR (geo = 'DK0' AND age = 'Y2')
+ OR (geo = 'DK01' AND age = 'Y2')
+ OR (geo = 'DK02' AND age = 'Y2')
+ OR (geo = 'DK03' AND age = 'Y2')
+ OR (geo = 'DK04' AND age = 'Y2')
+ OR (geo = 'DK05' AND age = 'Y2')
+ OR (geo = 'DE' AND age = 'Y2')
+ OR (geo = 'DE_TOT' AND age = 'Y2')
+ OR (geo = 'DE1' AND age = 'Y2')
+ OR (geo = 'DE11' AND age = 'Y2')
+ OR (geo = 'DE12' AND age = 'Y2')
+ OR (geo = 'DE13' AND age = 'Y2')
+ OR (geo = 'DE14' AND age = 'Y2')
+ OR (geo = 'DE2' AND age = 'Y2')
+ OR (geo = 'DE21' AND age = 'Y2')
+ OR (geo = 'DE22' AND age = 'Y2')
+ OR (geo = 'DE23' AND age = 'Y2')
+ OR (geo = 'DE24' AND age = 'Y2')
+ OR (geo = 'DE25' AND age = 'Y2')
+ OR (geo = 'DE26' AND age = 'Y2')
+ OR (geo = 'DE27' AND age = 'Y2')
+ OR (geo = 'DE3' AND age = 'Y2')
+ OR (geo = 'DE30' AND age = 'Y2')
+ OR (geo = 'DE4' AND age = 'Y2')
+ OR (geo = 'DE40' AND age = 'Y2')
+ OR (geo = 'DE5' AND age = 'Y2')
+ OR (geo = 'DE50' AND age = 'Y2')
+ OR (geo = 'DE6' AND age = 'Y2')
+ OR (geo = 'DE60' AND age = 'Y2')
+ OR (geo = 'DE7' AND age = 'Y2')
+ OR (geo = 'DE71' AND age = 'Y2')
+ OR (geo = 'DE72' AND age = 'Y2')
+ OR (geo = 'DE73' AND age = 'Y2')
+ OR (geo = 'DE8' AND age = 'Y2')
+ OR (geo = 'DE80' AND age = 'Y2')
+ OR (geo = 'DE9' AND age = 'Y2')
+ OR (geo = 'DE91' AND age = 'Y2')
+ OR (geo = 'DE92' AND age = 'Y2')
+ OR (geo = 'DE93' AND age = 'Y2')
+ OR (geo = 'DE94' AND age = 'Y2')
+ OR (geo = 'DEA' AND age = 'Y2')
+ OR (geo = 'DEA1' AND age = 'Y2')
+ OR (geo = 'DEA2' AND age = 'Y2')
+ OR (geo = 'DEA3' AND age = 'Y2')
+ OR (geo = 'DEA4' AND age = 'Y2')
+ OR (geo = 'DEA5' AND age = 'Y2')
+ OR (geo = 'DEB' AND age = 'Y2')
+ OR (geo = 'DEB1' AND age = 'Y2')
+ OR (geo = 'DEB2' AND age = 'Y2')
+ OR (geo = 'DEB3' AND age = 'Y2')
+ OR (geo = 'DEC' AND age = 'Y2')
+ OR (geo = 'DEC0' AND age = 'Y2')
+ OR (geo = 'DED' AND age = 'Y2')
+ OR (geo = 'DED2' AND age = 'Y2')
+ OR (geo = 'DED4' AND age = 'Y2')
+ OR (geo = 'DED5' AND age = 'Y2')
+ OR (geo = 'DEE' AND age = 'Y2')
+ OR (geo = 'DEE0' AND age = 'Y2')
+ OR (geo = 'DEF' AND age = 'Y2')
+ OR (geo = 'DEF0' AND age = 'Y2')
+ OR (geo = 'DEG' AND age = 'Y2')
+ OR (geo = 'DEG0' AND age = 'Y2')
+ OR (geo = 'EE' AND age = 'Y2')
+ OR (geo = 'EE0' AND age = 'Y2')
+ OR (geo = 'EE00' AND age = 'Y2')
+ OR (geo = 'IE' AND age = 'Y2')
+ OR (geo = 'IE0' AND age = 'Y2')
+ OR (geo = 'IE04' AND age = 'Y2')
+ OR (geo = 'IE05' AND age = 'Y2')
+ OR (geo = 'IE06' AND age = 'Y2')
+ OR (geo = 'EL' AND age = 'Y2')
+ OR (geo = 'EL3' AND age = 'Y2')
+ OR (geo = 'EL30' AND age = 'Y2')
+ OR (geo = 'EL4' AND age = 'Y2')
+ OR (geo = 'EL41' AND age = 'Y2')
+ OR (geo = 'EL42' AND age = 'Y2')
+ OR (geo = 'EL43' AND age = 'Y2')
+ OR (geo = 'EL5' AND age = 'Y2')
+ OR (geo = 'EL51' AND age = 'Y2')
+ OR (geo = 'EL52' AND age = 'Y2')
+ OR (geo = 'EL53' AND age = 'Y2')
+ OR (geo = 'EL54' AND age = 'Y2')
+ OR (geo = 'EL6' AND age = 'Y2')
+ OR (geo = 'EL61' AND age = 'Y2')
+ OR (geo = 'EL62' AND age = 'Y2')
+ OR (geo = 'EL63' AND age = 'Y2')
+ OR (geo = 'EL64' AND age = 'Y2')
+ OR (geo = 'EL65' AND age = 'Y2')
+ OR (geo = 'ES' AND age = 'Y2')
+ OR (geo = 'ES1' AND age = 'Y2')
+ OR (geo = 'ES11' AND age = 'Y2')
+ OR (geo = 'ES12' AND age = 'Y2')
+ OR (geo = 'ES13' AND age = 'Y2')
+ OR (geo = 'ES2' AND age = 'Y2')
+ OR (geo = 'ES21' AND age = 'Y2')
+ OR (geo = 'ES22' AND age = 'Y2')
+ OR (geo = 'ES23' AND age = 'Y2')
+ OR (geo = 'ES24' AND age = 'Y2')
+ OR (geo = 'ES3' AND age = 'Y2')
+ OR (geo = 'ES30' AND age = 'Y2')
+ OR (geo = 'ES4' AND age = 'Y2')
+ OR (geo = 'ES41' AND age = 'Y2')
+ OR (geo = 'ES42' AND age = 'Y2')
+ OR (geo = 'ES43' AND age = 'Y2')
+ OR (geo = 'ES5' AND age = 'Y2')
+ OR (geo = 'ES51' AND age = 'Y2')
+ OR (geo = 'ES52' AND age = 'Y2')
+ OR (geo = 'ES53' AND age = 'Y2')
+ OR (geo = 'ES6' AND age = 'Y2')
+ OR (geo = 'ES61' AND age = 'Y2')
+ OR (geo = 'ES62' AND age = 'Y2')
+ OR (geo = 'ES63' AND age = 'Y2')
+ OR (geo = 'ES64' AND age = 'Y2')
+ OR (geo = 'ES7' AND age = 'Y2')
+ OR (geo = 'ES70' AND age = 'Y2')
+ OR (geo = 'FR' AND age = 'Y2')
+ OR (geo = 'FR1' AND age = 'Y2')
+ OR (geo = 'FR10' AND age = 'Y2')
+ OR (geo = 'FRB' AND age = 'Y2')
+ OR (geo = 'FRB0' AND age = 'Y2')
+ OR (geo = 'FRC' AND age = 'Y2')
+ OR (geo = 'FRC1' AND age = 'Y2')
+ OR (geo = 'FRC2' AND age = 'Y2')
+ OR (geo = 'FRD' AND age = 'Y2')
+ OR (geo = 'FRD1' AND age = 'Y2')
+ OR (geo = 'FRD2' AND age = 'Y2')
+ OR (geo = 'FRE' AND age = 'Y2')
+ OR (geo = 'FRE1' AND age = 'Y2')
+ OR (geo = 'FRE2' AND age = 'Y2')
+ OR (geo = 'FRF' AND age = 'Y2')
+ OR (geo = 'FRF1' AND age = 'Y2')
+ OR (geo = 'FRF2' AND age = 'Y2')
+ OR (geo = 'FRF3' AND age = 'Y2')
+ OR (geo = 'FRG' AND age = 'Y2')
+ OR (geo = 'FRG0' AND age = 'Y2')
+ OR (geo = 'FRH' AND age = 'Y2')
+ OR (geo = 'FRH0' AND age = 'Y2')
+ OR (geo = 'FRI' AND age = 'Y2')
+ OR (geo = 'FRI1' AND age = 'Y2')
+ OR (geo = 'FRI2' AND age = 'Y2')
+ OR (geo = 'FRI3' AND age = 'Y2')
+ OR (geo = 'FRJ' AND age = 'Y2')
+ OR (geo = 'FRJ1' AND age = 'Y2')
+ OR (geo = 'FRJ2' AND age = 'Y2')
+ OR (geo = 'FRK' AND age = 'Y2')
+ OR (geo = 'FRK1' AND age = 'Y2')
+ OR (geo = 'FRK2' AND age = 'Y2')
+ OR (geo = 'FRL' AND age = 'Y2')
+ OR (geo = 'FRL0' AND age = 'Y2')
+ OR (geo = 'FRM' AND age = 'Y2')
+ OR (geo = 'FRM0' AND age = 'Y2')
+ OR (geo = 'FRY' AND age = 'Y2')
+ OR (geo = 'FRY1' AND age = 'Y2')
+ OR (geo = 'FRY2' AND age = 'Y2')
+ OR (geo = 'FRY3' AND age = 'Y2')
+ OR (geo = 'FRY4' AND age = 'Y2')
+ OR (geo = 'FRY5' AND age = 'Y2')
+ OR (geo = 'FRX' AND age = 'Y2')
+ OR (geo = 'FRXX' AND age = 'Y2')
+ OR (geo = 'HR' AND age = 'Y2')
+ OR (geo = 'HR0' AND age = 'Y2')
+ OR (geo = 'HR02' AND age = 'Y2')
+ OR (geo = 'HR03' AND age = 'Y2')
+ OR (geo = 'HR04' AND age = 'Y2')
+ OR (geo = 'HR05' AND age = 'Y2')
+ OR (geo = 'HR06' AND age = 'Y2')
+ OR (geo = 'IT' AND age = 'Y2')
+ OR (geo = 'ITC' AND age = 'Y2')
+ OR (geo = 'ITC1' AND age = 'Y2')
+ OR (geo = 'ITC2' AND age = 'Y2')
+ OR (geo = 'ITC3' AND age = 'Y2')
+ OR (geo = 'ITC4' AND age = 'Y2')
+ OR (geo = 'ITF' AND age = 'Y2')
+ OR (geo = 'ITF1' AND age = 'Y2')
+ OR (geo = 'ITF2' AND age = 'Y2')
+ OR (geo = 'ITF3' AND age = 'Y2')
+ OR (geo = 'ITF4' AND age = 'Y2')
+ OR (geo = 'ITF5' AND age = 'Y2')
+ OR (geo = 'ITF6' AND age = 'Y2')
+ OR (geo = 'ITG' AND age = 'Y2')
+ OR (geo = 'ITG1' AND age = 'Y2')
+ OR (geo = 'ITG2' AND age = 'Y2')
+ OR (geo = 'ITH' AND age = 'Y2')
+ OR (geo = 'ITH1' AND age = 'Y2')
+ OR (geo = 'ITH2' AND age = 'Y2')
+ OR (geo = 'ITH3' AND age = 'Y2')
+ OR (geo = 'ITH4' AND age = 'Y2')
+ OR (geo = 'ITH5' AND age = 'Y2')
+ OR (geo = 'ITI' AND age = 'Y2')
+ OR (geo = 'ITI1' AND age = 'Y2')
+ OR (geo = 'ITI2' AND age = 'Y2')
+ OR (geo = 'ITI3' AND age = 'Y2')
+ OR (geo = 'ITI4' AND age = 'Y2')
+ OR (geo = 'CY' AND age = 'Y2')
+ OR (geo = 'CY0' AND age = 'Y2')
+ OR (geo = 'CY00' AND age = 'Y2')
+ OR (geo = 'LV' AND age = 'Y2')
+ OR (geo = 'LV0' AND age = 'Y2')
+ OR (geo = 'LV00' AND age = 'Y2')
+ OR (geo = 'LT' AND age = 'Y2')
+ OR (geo = 'LT0' AND age = 'Y2')
+ OR (geo = 'LT01' AND age = 'Y2')
+ OR (geo = 'LT02' AND age = 'Y2')
+ OR (geo = 'LU' AND age = 'Y2')
+ OR (geo = 'LU0' AND age = 'Y2')
+ OR (geo = 'LU00' AND age = 'Y2')
+ OR (geo = 'HU' AND age = 'Y2')
+ OR (geo = 'HU1' AND age = 'Y2')
+ OR (geo = 'HU11' AND age = 'Y2')
+ OR (geo = 'HU12' AND age = 'Y2')
+ OR (geo = 'HU2' AND age = 'Y2')
+ OR (geo = 'HU21' AND age = 'Y2')
+ OR (geo = 'HU22' AND age = 'Y2')
+ OR (geo = 'HU23' AND age = 'Y2')
+ OR (geo = 'HU3' AND age = 'Y2')
+ OR (geo = 'HU31' AND age = 'Y2')
+ OR (geo = 'HU32' AND age = 'Y2')
+ OR (geo = 'HU33' AND age = 'Y2')
+ OR (geo = 'HUX' AND age = 'Y2')
+ OR (geo = 'HUXX' AND age = 'Y2')
+ OR (geo = 'MT' AND age = 'Y2')
+ OR (geo = 'MT0' AND age = 'Y2')
+ OR (geo = 'MT00' AND age = 'Y2')
+ OR (geo = 'NL' AND age = 'Y2')
+ OR (geo = 'NL1' AND age = 'Y2')
+ OR (geo = 'NL11' AND age = 'Y2')
+ OR (geo = 'NL12' AND age = 'Y2')
+ OR (geo = 'NL13' AND age = 'Y2')
+ OR (geo = 'NL2' AND age = 'Y2')
+ OR (geo = 'NL21' AND age = 'Y2')
+ OR (geo = 'NL22' AND age = 'Y2')
+ OR (geo = 'NL23' AND age = 'Y2')
+ OR (geo = 'NL3' AND age = 'Y2')
+ OR (geo = 'NL31' AND age = 'Y2')
+ OR (geo = 'NL32' AND age = 'Y2')
+ OR (geo = 'NL33' AND age = 'Y2')
+ OR (geo = 'NL34' AND age = 'Y2')
+ OR (geo = 'NL35' AND age = 'Y2')
+ OR (geo = 'NL36' AND age = 'Y2')
+ OR (geo = 'NL4' AND age = 'Y2')
+ OR (geo = 'NL41' AND age = 'Y2')
+ OR (geo = 'NL42' AND age = 'Y2')
+ OR (geo = 'AT' AND age = 'Y2')
+ OR (geo = 'AT1' AND age = 'Y2')
+ OR (geo = 'AT11' AND age = 'Y2')
+ OR (geo = 'AT12' AND age = 'Y2')
+ OR (geo = 'AT13' AND age = 'Y2')
+ OR (geo = 'AT2' AND age = 'Y2')
+ OR (geo = 'AT21' AND age = 'Y2')
+ OR (geo = 'AT22' AND age = 'Y2')
+ OR (geo = 'AT3' AND age = 'Y2')
+ OR (geo = 'AT31' AND age = 'Y2')
+ OR (geo = 'AT32' AND age = 'Y2')
+ OR (geo = 'AT33' AND age = 'Y2')
+ OR (geo = 'AT34' AND age = 'Y2')
+ OR (geo = 'PL' AND age = 'Y2')
+ OR (geo = 'PL2' AND age = 'Y2')
+ OR (geo = 'PL21' AND age = 'Y2')
+ OR (geo = 'PL22' AND age = 'Y2')
+ OR (geo = 'PL4' AND age = 'Y2')
+ OR (geo = 'PL41' AND age = 'Y2')
+ OR (geo = 'PL42' AND age = 'Y2')
+ OR (geo = 'PL43' AND age = 'Y2')
+ OR (geo = 'PL5' AND age = 'Y2')
+ OR (geo = 'PL51' AND age = 'Y2')
+ OR (geo = 'PL52' AND age = 'Y2')
+ OR (geo = 'PL6' AND age = 'Y2')
+ OR (geo = 'PL61' AND age = 'Y2')
+ OR (geo = 'PL62' AND age = 'Y2')
+ OR (geo = 'PL63' AND age = 'Y2')
+ OR (geo = 'PL7' AND age = 'Y2')
+ OR (geo = 'PL71' AND age = 'Y2')
+ OR (geo = 'PL72' AND age = 'Y2')
+ OR (geo = 'PL8' AND age = 'Y2')
+ OR (geo = 'PL81' AND age = 'Y2')
+ OR (geo = 'PL82' AND age = 'Y2')
+ OR (geo = 'PL84' AND age = 'Y2')
+ OR (geo = 'PL9' AND age = 'Y2')
+ OR (geo = 'PL91' AND age = 'Y2')
+ OR (geo = 'PL92' AND age = 'Y2')
+ OR (geo = 'PT' AND age = 'Y2')
+ OR (geo = 'PT1' AND age = 'Y2')
+ OR (geo = 'PT11' AND age = 'Y2')
+ OR (geo = 'PT15' AND age = 'Y2')
+ OR (geo = 'PT16' AND age = 'Y2')
+ OR (geo = 'PT17' AND age = 'Y2')
+ OR (geo = 'PT18' AND age = 'Y2')
+ OR (geo = 'PT19' AND age = 'Y2')
+ OR (geo = 'PT1A' AND age = 'Y2')
+ OR (geo = 'PT1B' AND age = 'Y2')
+ OR (geo = 'PT1C' AND age = 'Y2')
+ OR (geo = 'PT1D' AND age = 'Y2')
+ OR (geo = 'PT2' AND age = 'Y2')
+ OR (geo = 'PT20' AND age = 'Y2')
+ OR (geo = 'PT3' AND age = 'Y2')
+ OR (geo = 'PT30' AND age = 'Y2')
+ OR (geo = 'RO' AND age = 'Y2')
+ OR (geo = 'RO1' AND age = 'Y2')
+ OR (geo = 'RO11' AND age = 'Y2')
+ OR (geo = 'RO12' AND age = 'Y2')
+ OR (geo = 'RO2' AND age = 'Y2')
+ OR (geo = 'RO21' AND age = 'Y2')
+ OR (geo = 'RO22' AND age = 'Y2')
+ OR (geo = 'RO3' AND age = 'Y2')
+ OR (geo = 'RO31' AND age = 'Y2')
+ OR (geo = 'RO32' AND age = 'Y2')
+ OR (geo = 'RO4' AND age = 'Y2')
+ OR (geo = 'RO41' AND age = 'Y2')
+ OR (geo = 'RO42' AND age = 'Y2')
+ OR (geo = 'SI' AND age = 'Y2')
+ OR (geo = 'SI0' AND age = 'Y2')
+ OR (geo = 'SI03' AND age = 'Y2')
+ OR (geo = 'SI04' AND age = 'Y2')
+ OR (geo = 'SK' AND age = 'Y2')
+ OR (geo = 'SK0' AND age = 'Y2')
+ OR (geo = 'SK01' AND age = 'Y2')
+ OR (geo = 'SK02' AND age = 'Y2')
+ OR (geo = 'SK03' AND age = 'Y2')
+ OR (geo = 'SK04' AND age = 'Y2')
+ OR (geo = 'FI' AND age = 'Y2')
+ OR (geo = 'FI1' AND age = 'Y2')
+ OR (geo = 'FI19' AND age = 'Y2')
+ OR (geo = 'FI1B' AND age = 'Y2')
+ OR (geo = 'FI1C' AND age = 'Y2')
+ OR (geo = 'FI1D' AND age = 'Y2')
+ OR (geo = 'FI2' AND age = 'Y2')
+ OR (geo = 'FI20' AND age = 'Y2')
+ OR (geo = 'SE' AND age = 'Y2')
+ OR (geo = 'SE1' AND age = 'Y2')
+ OR (geo = 'SE11' AND age = 'Y2')
+ OR (geo = 'SE12' AND age = 'Y2')
+ OR (geo = 'SE2' AND age = 'Y2')
+ OR (geo = 'SE21' AND age = 'Y2')
+ OR (geo = 'SE22' AND age = 'Y2')
+ OR (geo = 'SE23' AND age = 'Y2')
+ OR (geo = 'SE3' AND age = 'Y2')
+ OR (geo = 'SE31' AND age = 'Y2')
+ OR (geo = 'SE32' AND age = 'Y2')
+ OR (geo = 'SE33' AND age = 'Y2')
+ OR (geo = 'EFTA' AND age = 'Y2')
+ OR (geo = 'IS' AND age = 'Y2')
+ OR (geo = 'IS0' AND age = 'Y2')
+ OR (geo = 'IS00' AND age = 'Y2')
+ OR (geo = 'LI' AND age = 'Y2')
+ OR (geo = 'LI0' AND age = 'Y2')
+ OR (geo = 'LI00' AND age = 'Y2')
+ OR (geo = 'NO' AND age = 'Y2')
+ OR (geo = 'NO0' AND age = 'Y2')
+ OR (geo = 'NO01' AND age = 'Y2')
+ OR (geo = 'NO02' AND age = 'Y2')
+ OR (geo = 'NO03' AND age = 'Y2')
+ OR (geo = 'NO04' AND age = 'Y2')
+ OR (geo = 'NO05' AND age = 'Y2')
+ OR (geo = 'NO06' AND age = 'Y2')
+ OR (geo = 'NO07' AND age = 'Y2')
+ OR (geo = 'NO08' AND age = 'Y2')
+ OR (geo = 'NO09' AND age = 'Y2')
+ OR (geo = 'NO0A' AND age = 'Y2')
+ OR (geo = 'NO0B' AND age = 'Y2')
+ OR (geo = 'CH' AND age = 'Y2')
+ OR (geo = 'CH0' AND age = 'Y2')
+ OR (geo = 'CH01' AND age = 'Y2')
+ OR (geo = 'CH02' AND age = 'Y2')
+ OR (geo = 'CH03' AND age = 'Y2')
+ OR (geo = 'CH04' AND age = 'Y2')
+ OR (geo = 'CH05' AND age = 'Y2')
+ OR (geo = 'CH06' AND age = 'Y2')
+ OR (geo = 'CH07' AND age = 'Y2')
+ OR (geo = 'UK' AND age = 'Y2')
+ OR (geo = 'UKC' AND age = 'Y2')
+ OR (geo = 'UKC1' AND age = 'Y2')
+ OR (geo = 'UKC2' AND age = 'Y2')
+ OR (geo = 'UKD' AND age = 'Y2')
+ OR (geo = 'UKD1' AND age = 'Y2')
+ OR (geo = 'UKD3' AND age = 'Y2')
+ OR (geo = 'UKD4' AND age = 'Y2')
+ OR (geo = 'UKD6' AND age = 'Y2')
+ OR (geo = 'UKD7' AND age = 'Y2')
+ OR (geo = 'UKE' AND age = 'Y2')
+ OR (geo = 'UKE1' AND age = 'Y2')
+ OR (geo = 'UKE2' AND age = 'Y2')
+ OR (geo = 'UKE3' AND age = 'Y2')
+ OR (geo = 'UKE4' AND age = 'Y2')
+ OR (geo = 'UKF' AND age = 'Y2')
+ OR (geo = 'UKF1' AND age = 'Y2')
+ OR (geo = 'UKF2' AND age = 'Y2')
+ OR (geo = 'UKF3' AND age = 'Y2')
+ OR (geo = 'UKG' AND age = 'Y2')
+ OR (geo = 'UKG1' AND age = 'Y2')
+ OR (geo = 'UKG2' AND age = 'Y2')
+ OR (geo = 'UKG3' AND age = 'Y2')
+ OR (geo = 'UKH' AND age = 'Y2')
+ OR (geo = 'UKH1' AND age = 'Y2')
+ OR (geo = 'UKH2' AND age = 'Y2')
+ OR (geo = 'UKH3' AND age = 'Y2')
+ OR (geo = 'UKI' AND age = 'Y2')
+ OR (geo = 'UKI3' AND age = 'Y2')
+ OR (geo = 'UKI4' AND age = 'Y2')
+ OR (geo = 'UKI5' AND age = 'Y2')
+ OR (geo = 'UKI6' AND age = 'Y2')
+ OR (geo = 'UKI7' AND age = 'Y2')
+ OR (geo = 'UKJ' AND age = 'Y2')
+ OR (geo = 'UKJ1' AND age = 'Y2')
+ OR (geo = 'UKJ2' AND age = 'Y2')
+ OR (geo = 'UKJ3' AND age = 'Y2')
+ OR (geo = 'UKJ4' AND age = 'Y2')
+ OR (geo = 'UKK' AND age = 'Y2')
+ OR (geo = 'UKK1' AND age = 'Y2')
+ OR (geo = 'UKK2' AND age = 'Y2')
+ OR (geo = 'UKK3' AND age = 'Y2')
+ OR (geo = 'UKK4' AND age = 'Y2')
+ OR (geo = 'UKL' AND age = 'Y2')
+ OR (geo = 'UKL1' AND age = 'Y2')
+ OR (geo = 'UKL2' AND age = 'Y2')
+ OR (geo = 'UKM' AND age = 'Y2')
+ OR (geo = 'UKM5' AND age = 'Y2')
+ OR (geo = 'UKM6' AND age = 'Y2')
+ OR (geo = 'UKM7' AND age = 'Y2')
+ OR (geo = 'UKM8' AND age = 'Y2')
+ OR (geo = 'UKM9' AND age = 'Y2')
+ OR (geo = 'UKN' AND age = 'Y2')
+ OR (geo = 'UKN0' AND age = 'Y2')
+ OR (geo = 'ME' AND age = 'Y2')
+ OR (geo = 'ME0' AND age = 'Y2')
+ OR (geo = 'ME00' AND age = 'Y2')
+ OR (geo = 'MK' AND age = 'Y2')
+ OR (geo = 'MK0' AND age = 'Y2')
+ OR (geo = 'MK00' AND age = 'Y2')
+ OR (geo = 'MKX' AND age = 'Y2')
+ OR (geo = 'MKXX' AND age = 'Y2')
+ OR (geo = 'AL' AND age = 'Y2')
+ OR (geo = 'AL0' AND age = 'Y2')
+ OR (geo = 'AL01' AND age = 'Y2')
+ OR (geo = 'AL02' AND age = 'Y2')
+ OR (geo = 'AL03' AND age = 'Y2')
+ OR (geo = 'ALX' AND age = 'Y2')
+ OR (geo = 'ALXX' AND age = 'Y2')
+ OR (geo = 'RS' AND age = 'Y2')
+ OR (geo = 'RS1' AND age = 'Y2')
+ OR (geo = 'RS11' AND age = 'Y2')
+ OR (geo = 'RS12' AND age = 'Y2')
+ OR (geo = 'RS2' AND age = 'Y2')
+ OR (geo = 'RS21' AND age = 'Y2')
+ OR (geo = 'RS22' AND age = 'Y2')
+ OR (geo = 'TR' AND age = 'Y2')
+ OR (geo = 'TR1' AND age = 'Y2')
+ OR (geo = 'TR10' AND age = 'Y2')
+ OR (geo = 'TR2' AND age = 'Y2')
+ OR (geo = 'TR21' AND age = 'Y2')
+ OR (geo = 'TR22' AND age = 'Y2')
+ OR (geo = 'TR3' AND age = 'Y2')
+ OR (geo = 'TR31' AND age = 'Y2')
+ OR (geo = 'TR32' AND age = 'Y2')
+ OR (geo = 'TR33' AND age = 'Y2')
+ OR (geo = 'TR4' AND age = 'Y2')
+ OR (geo = 'TR41' AND age = 'Y2')
+ OR (geo = 'TR42' AND age = 'Y2')
+ OR (geo = 'TR5' AND age = 'Y2')
+ OR (geo = 'TR51' AND age = 'Y2')
+ OR (geo = 'TR52' AND age = 'Y2')
+ OR (geo = 'TR6' AND age = 'Y2')
+ OR (geo = 'TR61' AND age = 'Y2')
+ OR (geo = 'TR62' AND age = 'Y2')
+ OR (geo = 'TR63' AND age = 'Y2')
+ OR (geo = 'TR7' AND age = 'Y2')
+ OR (geo = 'TR71' AND age = 'Y2')
+ OR (geo = 'TR72' AND age = 'Y2')
+ OR (geo = 'TR8' AND age = 'Y2')
+ OR (geo = 'TR81' AND age = 'Y2')
+ OR (geo = 'TR82' AND age = 'Y2')
+ OR (geo = 'TR83' AND age = 'Y2')
+ OR (geo = 'TR9' AND age = 'Y2')
+ OR (geo = 'TR90' AND age = 'Y2')
+ OR (geo = 'TRA' AND age = 'Y2')
+ OR (geo = 'TRA1' AND age = 'Y2')
+ OR (geo = 'TRA2' AND age = 'Y2')
+ OR (geo = 'TRB' AND age = 'Y2')
+ OR (geo = 'TRB1' AND age = 'Y2')
+ OR (geo = 'TRB2' AND age = 'Y2')
+ OR (geo = 'TRC' AND age = 'Y2')
+ OR (geo = 'TRC1' AND age = 'Y2')
+ OR (geo = 'TRC2' AND age = 'Y2')
+ OR (geo = 'TRC3' AND age = 'Y2')
+ OR (geo = 'EU27_2020' AND age = 'Y3')
+ OR (geo = 'EU28' AND age = 'Y3')
+ OR (geo = 'EU27_2007' AND age = 'Y3')
+ OR (geo = 'BE' AND age = 'Y3')
+ OR (geo = 'BE1' AND age = 'Y3')
+ OR (geo = 'BE10' AND age = 'Y3')
+ OR (geo = 'BE2' AND age = 'Y3')
+ OR (geo = 'BE21' AND age = 'Y3')
+ OR (geo = 'BE22' AND age = 'Y3')
+ OR (geo = 'BE23' AND age = 'Y3')
+ OR (geo = 'BE24' AND age = 'Y3')
+ OR (geo = 'BE25' AND age = 'Y3')
+ OR (geo = 'BE3' AND age = 'Y3')
+ OR (geo = 'BE31' AND age = 'Y3')
+ OR (geo = 'BE32' AND age = 'Y3')
+ OR (geo = 'BE33' AND age = 'Y3')
+ OR (geo = 'BE34' AND age = 'Y3')
+ OR (geo = 'BE35' AND age = 'Y3')
+ OR (geo = 'BG' AND age = 'Y3')
+ OR (geo = 'BG3' AND age = 'Y3')
+ OR (geo = 'BG31' AND age = 'Y3')
+ OR (geo = 'BG32' AND age = 'Y3')
+ OR (geo = 'BG33' AND age = 'Y3')
+ OR (geo = 'BG34' AND age = 'Y3')
+ OR (geo = 'BG4' AND age = 'Y3')
+ OR (geo = 'BG41' AND age = 'Y3')
+ OR (geo = 'BG42' AND age = 'Y3')
+ OR (geo = 'CZ' AND age = 'Y3')
+ OR (geo = 'CZ0' AND age = 'Y3')
+ OR (geo = 'CZ01' AND age = 'Y3')
+ OR (geo = 'CZ02' AND age = 'Y3')
+ OR (geo = 'CZ03' AND age = 'Y3')
+ OR (geo = 'CZ04' AND age = 'Y3')
+ OR (geo = 'CZ05' AND age = 'Y3')
+ OR (geo = 'CZ06' AND age = 'Y3')
+ OR (geo = 'CZ07' AND age = 'Y3')
+ OR (geo = 'CZ08' AND age = 'Y3')
+ OR (geo = 'DK' AND age = 'Y3')
+ OR (geo = 'DK0' AND age = 'Y3')
+ OR (geo = 'DK01' AND age = 'Y3')
+ OR (geo = 'DK02' AND age = 'Y3')
+ OR (geo = 'DK03' AND age = 'Y3')
+ OR (geo = 'DK04' AND age = 'Y3')
+ OR (geo = 'DK05' AND age = 'Y3')
+ OR (geo = 'DE' AND age = 'Y3')
+ OR (geo = 'DE_TOT' AND age = 'Y3')
+ OR (geo = 'DE1' AND age = 'Y3')
+ OR (geo = 'DE11' AND age = 'Y3')
+ OR (geo = 'DE12' AND age = 'Y3')
+ OR (geo = 'DE13' AND age = 'Y3')
+ OR (geo = 'DE14' AND age = 'Y3')
+ OR (geo = 'DE2' AND age = 'Y3')
+ OR (geo = 'DE21' AND age = 'Y3')
+ OR (geo = 'DE22' AND age = 'Y3')
+ OR (geo = 'DE23' AND age = 'Y3')
+ OR (geo = 'DE24' AND age = 'Y3')
+ OR (geo = 'DE25' AND age = 'Y3')
+ OR (geo = 'DE26' AND age = 'Y3')
+ OR (geo = 'DE27' AND age = 'Y3')
+ OR (geo = 'DE3' AND age = 'Y3')
+ OR (geo = 'DE30' AND age = 'Y3')
+ OR (geo = 'DE4' AND age = 'Y3')
+ OR (geo = 'DE40' AND age = 'Y3')
+ OR (geo = 'DE5' AND age = 'Y3')
+ OR (geo = 'DE50' AND age = 'Y3')
+ OR (geo = 'DE6' AND age = 'Y3')
+ OR (geo = 'DE60' AND age = 'Y3')
+ OR (geo = 'DE7' AND age = 'Y3')
+ OR (geo = 'DE71' AND age = 'Y3')
+ OR (geo = 'DE72' AND age = 'Y3')
+ OR (geo = 'DE73' AND age = 'Y3')
+ OR (geo = 'DE8' AND age = 'Y3')
+ OR (geo = 'DE80' AND age = 'Y3')
+ OR (geo = 'DE9' AND age = 'Y3')
+ OR (geo = 'DE91' AND age = 'Y3')
+ OR (geo = 'DE92' AND age = 'Y3')
+ OR (geo = 'DE93' AND age = 'Y3')
+ OR (geo = 'DE94' AND age = 'Y3')
+ OR (geo = 'DEA' AND age = 'Y3')
+ OR (geo = 'DEA1' AND age = 'Y3')
+ OR (geo = 'DEA2' AND age = 'Y3')
+ OR (geo = 'DEA3' AND age = 'Y3')
+ OR (geo = 'DEA4' AND age = 'Y3')
+ OR (geo = 'DEA5' AND age = 'Y3')
+ OR (geo = 'DEB' AND age = 'Y3')
+ OR (geo = 'DEB1' AND age = 'Y3')
+ OR (geo = 'DEB2' AND age = 'Y3')
+ OR (geo = 'DEB3' AND age = 'Y3')
+ OR (geo = 'DEC' AND age = 'Y3')
+ OR (geo = 'DEC0' AND age = 'Y3')
+ OR (geo = 'DED' AND age = 'Y3')
+ OR (geo = 'DED2' AND age = 'Y3')
+ OR (geo = 'DED4' AND age = 'Y3')
+ OR (geo = 'DED5' AND age = 'Y3')
+ OR (geo = 'DEE' AND age = 'Y3')
+ OR (geo = 'DEE0' AND age = 'Y3')
+ OR (geo = 'DEF' AND age = 'Y3')
+ OR (geo = 'DEF0' AND age = 'Y3')
+ OR (geo = 'DEG' AND age = 'Y3')
+ OR (geo = 'DEG0' AND age = 'Y3')
+ OR (geo = 'EE' AND age = 'Y3')
+ OR (geo = 'EE0' AND age = 'Y3')
+ OR (geo = 'EE00' AND age = 'Y3')
+ OR (geo = 'IE' AND age = 'Y3')
+ OR (geo = 'IE0' AND age = 'Y3')
+ OR (geo = 'IE04' AND age = 'Y3')
+ OR (geo = 'IE05' AND age = 'Y3')
+ OR (geo = 'IE06' AND age = 'Y3')
+ OR (geo = 'EL' AND age = 'Y3')
+ OR (geo = 'EL3' AND age = 'Y3')
+ OR (geo = 'EL30' AND age = 'Y3')
+ OR (geo = 'EL4' AND age = 'Y3')
+ OR (geo = 'EL41' AND age = 'Y3')
+ OR (geo = 'EL42' AND age = 'Y3')
+ OR (geo = 'EL43' AND age = 'Y3')
+ OR (geo = 'EL5' AND age = 'Y3')
+ OR (geo = 'EL51' AND age = 'Y3')
+ OR (geo = 'EL52' AND age = 'Y3')
+ OR (geo = 'EL53' AND age = 'Y3')
+ OR (geo = 'EL54' AND age = 'Y3')
+ OR (geo = 'EL6' AND age = 'Y3')
+ OR (geo = 'EL61' AND age = 'Y3')
+ OR (geo = 'EL62' AND age = 'Y3')
+ OR (geo = 'EL63' AND age = 'Y3')
+ OR (geo = 'EL64' AND age = 'Y3')
+ OR (geo = 'EL65' AND age = 'Y3')
+ OR (geo = 'ES' AND age = 'Y3')
+ OR (geo = 'ES1' AND age = 'Y3')
+ OR (geo = 'ES11' AND age = 'Y3')
+ OR (geo = 'ES12' AND age = 'Y3')
+ OR (geo = 'ES13' AND age = 'Y3')
+ OR (geo = 'ES2' AND age = 'Y3')
+ OR (geo = 'ES21' AND age = 'Y3')
+ OR (geo = 'ES22' AND age = 'Y3')
+ OR (geo = 'ES23' AND age = 'Y3')
+ OR (geo = 'ES24' AND age = 'Y3')
+ OR (geo = 'ES3' AND age = 'Y3')
+ OR (geo = 'ES30' AND age = 'Y3')
+ OR (geo = 'ES4' AND age = 'Y3')
+ OR (geo = 'ES41' AND age = 'Y3')
+ OR (geo = 'ES42' AND age = 'Y3')
+ OR (geo = 'ES43' AND age = 'Y3')
+ OR (geo = 'ES5' AND age = 'Y3')
+ OR (geo = 'ES51' AND age = 'Y3')
+ OR (geo = 'ES52' AND age = 'Y3')
+ OR (geo = 'ES53' AND age = 'Y3')
+ OR (geo = 'ES6' AND age = 'Y3')
+ OR (geo = 'ES61' AND age = 'Y3')
+ OR (geo = 'ES62' AND age = 'Y3')
+ OR (geo = 'ES63' AND age = 'Y3')
+ OR (geo = 'ES64' AND age = 'Y3')
+ OR (geo = 'ES7' AND age = 'Y3')
+ OR (geo = 'ES70' AND age = 'Y3')
+ OR (geo = 'FR' AND age = 'Y3')
+ OR (geo = 'FR1' AND age = 'Y3')
+ OR (geo = 'FR10' AND age = 'Y3')
+ OR (geo = 'FRB' AND age = 'Y3')
+ OR (geo = 'FRB0' AND age = 'Y3')
+ OR (geo = 'FRC' AND age = 'Y3')
+ OR (geo = 'FRC1' AND age = 'Y3')
+ OR (geo = 'FRC2' AND age = 'Y3')
+ OR (geo = 'FRD' AND age = 'Y3')
+ OR (geo = 'FRD1' AND age = 'Y3')
+ OR (geo = 'FRD2' AND age = 'Y3')
+ OR (geo = 'FRE' AND age = 'Y3')
+ OR (geo = 'FRE1' AND age = 'Y3')
+ OR (geo = 'FRE2' AND age = 'Y3')
+ OR (geo = 'FRF' AND age = 'Y3')
+ OR (geo = 'FRF1' AND age = 'Y3')
+ OR (geo = 'FRF2' AND age = 'Y3')
+ OR (geo = 'FRF3' AND age = 'Y3')
+ OR (geo = 'FRG' AND age = 'Y3')
+ OR (geo = 'FRG0' AND age = 'Y3')
+ OR (geo = 'FRH' AND age = 'Y3')
+ OR (geo = 'FRH0' AND age = 'Y3')
+ OR (geo = 'FRI' AND age = 'Y3')
+ OR (geo = 'FRI1' AND age = 'Y3')
+ OR (geo = 'FRI2' AND age = 'Y3')
+ OR (geo = 'FRI3' AND age = 'Y3')
+ OR (geo = 'FRJ' AND age = 'Y3')
+ OR (geo = 'FRJ1' AND age = 'Y3')
+ OR (geo = 'FRJ2' AND age = 'Y3')
+ OR (geo = 'FRK' AND age = 'Y3')
+ OR (geo = 'FRK1' AND age = 'Y3')
+ OR (geo = 'FRK2' AND age = 'Y3')
+ OR (geo = 'FRL' AND age = 'Y3')
+ OR (geo = 'FRL0' AND age = 'Y3')
+ OR (geo = 'FRM' AND age = 'Y3')
+ OR (geo = 'FRM0' AND age = 'Y3')
+ OR (geo = 'FRY' AND age = 'Y3')
+ OR (geo = 'FRY1' AND age = 'Y3')
+ OR (geo = 'FRY2' AND age = 'Y3')
+ OR (geo = 'FRY3' AND age = 'Y3')
+ OR (geo = 'FRY4' AND age = 'Y3')
+ OR (geo = 'FRY5' AND age = 'Y3')
+ OR (geo = 'FRX' AND age = 'Y3')
+ OR (geo = 'FRXX' AND age = 'Y3')
+ OR (geo = 'HR' AND age = 'Y3')
+ OR (geo = 'HR0' AND age = 'Y3')
+ OR (geo = 'HR02' AND age = 'Y3')
+ OR (geo = 'HR03' AND age = 'Y3')
+ OR (geo = 'HR04' AND age = 'Y3')
+ OR (geo = 'HR05' AND age = 'Y3')
+ OR (geo = 'HR06' AND age = 'Y3')
+ OR (geo = 'IT' AND age = 'Y3')
+ OR (geo = 'ITC' AND age = 'Y3')
+ OR (geo = 'ITC1' AND age = 'Y3')
+ OR (geo = 'ITC2' AND age = 'Y3')
+ OR (geo = 'ITC3' AND age = 'Y3')
+ OR (geo = 'ITC4' AND age = 'Y3')
+ OR (geo = 'ITF' AND age = 'Y3')
+ OR (geo = 'ITF1' AND age = 'Y3')
+ OR (geo = 'ITF2' AND age = 'Y3')
+ OR (geo = 'ITF3' AND age = 'Y3')
+ OR (geo = 'ITF4' AND age = 'Y3')
+ OR (geo = 'ITF5' AND age = 'Y3')
+ OR (geo = 'ITF6' AND age = 'Y3')
+ OR (geo = 'ITG' AND age = 'Y3')
+ OR (geo = 'ITG1' AND age = 'Y3')
+ OR (geo = 'ITG2' AND age = 'Y3')
+ OR (geo = 'ITH' AND age = 'Y3')
+ OR (geo = 'ITH1' AND age = 'Y3')
+ OR (geo = 'ITH2' AND age = 'Y3')
+ OR (geo = 'ITH3' AND age = 'Y3')
+ OR (geo = 'ITH4' AND age = 'Y3')
+ OR (geo = 'ITH5' AND age = 'Y3')
+ OR (geo = 'ITI' AND age = 'Y3')
+ OR (geo = 'ITI1' AND age = 'Y3')
+ OR (geo = 'ITI2' AND age = 'Y3')
+ OR (geo = 'ITI3' AND age = 'Y3')
+ OR (geo = 'ITI4' AND age = 'Y3')
+ OR (geo = 'CY' AND age = 'Y3')
+ OR (geo = 'CY0' AND age = 'Y3')
+ OR (geo = 'CY00' AND age = 'Y3')
+ OR (geo = 'LV' AND age = 'Y3')
+ OR (geo = 'LV0' AND age = 'Y3')
+ OR (geo = 'LV00' AND age = 'Y3')
+ OR (geo = 'LT' AND age = 'Y3')
+ OR (geo = 'LT0' AND age = 'Y3')
+ OR (geo = 'LT01' AND age = 'Y3')
+ OR (geo = 'LT02' AND age = 'Y3')
+ OR (geo = 'LU' AND age = 'Y3')
+ OR (geo = 'LU0' AND age = 'Y3')
+ OR (geo = 'LU00' AND age = 'Y3')
+ OR (geo = 'HU' AND age = 'Y3')
+ OR (geo = 'HU1' AND age = 'Y3')
+ OR (geo = 'HU11' AND age = 'Y3')
+ OR (geo = 'HU12' AND age = 'Y3')
+ OR (geo = 'HU2' AND age = 'Y3')
+ OR (geo = 'HU21' AND age = 'Y3')
+ OR (geo = 'HU22' AND age = 'Y3')
+ OR (geo = 'HU23' AND age = 'Y3')
+ OR (geo = 'HU3' AND age = 'Y3')
+ OR (geo = 'HU31' AND age = 'Y3')
+ OR (geo = 'HU32' AND age = 'Y3')
+ OR (geo = 'HU33' AND age = 'Y3')
+ OR (geo = 'HUX' AND age = 'Y3')
+ OR (geo = 'HUXX' AND age = 'Y3')
+ OR (geo = 'MT' AND age = 'Y3')
+ OR (geo = 'MT0' AND age = 'Y3')
+ OR (geo = 'MT00' AND age = 'Y3')
+ OR (geo = 'NL' AND age = 'Y3')
+ OR (geo = 'NL1' AND age = 'Y3')
+ OR (geo = 'NL11' AND age = 'Y3')
+ OR (geo = 'NL12' AND age = 'Y3')
+ OR (geo = 'NL13' AND age = 'Y3')
+ OR (geo = 'NL2' AND age = 'Y3')
+ OR (geo = 'NL21' AND age = 'Y3')
+ OR (geo = 'NL22' AND age = 'Y3')
+ OR (geo = 'NL23' AND age = 'Y3')
+ OR (geo = 'NL3' AND age = 'Y3')
+ OR (geo = 'NL31' AND age = 'Y3')
+ OR (geo = 'NL32' AND age = 'Y3')
+ OR (geo = 'NL33' AND age = 'Y3')
+ OR (geo = 'NL34' AND age = 'Y3')
+ OR (geo = 'NL35' AND age = 'Y3')
+ OR (geo = 'NL36' AND age = 'Y3')
+ OR (geo = 'NL4' AND age = 'Y3')
+ OR (geo = 'NL41' AND age = 'Y3')
+ OR (geo = 'NL42' AND age = 'Y3')
+ OR (geo = 'AT' AND age = 'Y3')
+ OR (geo = 'AT1' AND age = 'Y3')
+ OR (geo = 'AT11' AND age = 'Y3')
+ OR (geo = 'AT12' AND age = 'Y3')
+ OR (geo = 'AT13' AND age = 'Y3')
+ OR (geo = 'AT2' AND age = 'Y3')
+ OR (geo = 'AT21' AND age = 'Y3')
+ OR (geo = 'AT22' AND age = 'Y3')
+ OR (geo = 'AT3' AND age = 'Y3')
+ OR (geo = 'AT31' AND age = 'Y3')
+ OR (geo = 'AT32' AND age = 'Y3')
+ OR (geo = 'AT33' AND age = 'Y3')
+ OR (geo = 'AT34' AND age = 'Y3')
+ OR (geo = 'PL' AND age = 'Y3')
+ OR (geo = 'PL2' AND age = 'Y3')
+ OR (geo = 'PL21' AND age = 'Y3')
+ OR (geo = 'PL22' AND age = 'Y3')
+ OR (geo = 'PL4' AND age = 'Y3')
+ OR (geo = 'PL41' AND age = 'Y3')
+ OR (geo = 'PL42' AND age = 'Y3')
+ OR (geo = 'PL43' AND age = 'Y3')
+ OR (geo = 'PL5' AND age = 'Y3')
+ OR (geo = 'PL51' AND age = 'Y3')
+ OR (geo = 'PL52' AND age = 'Y3')
+ OR (geo = 'PL6' AND age = 'Y3')
+ OR (geo = 'PL61' AND age = 'Y3')
+ OR (geo = 'PL62' AND age = 'Y3')
+ OR (geo = 'PL63' AND age = 'Y3')
+ OR (geo = 'PL7' AND age = 'Y3')
+ OR (geo = 'PL71' AND age = 'Y3')
+ OR (geo = 'PL72' AND age = 'Y3')
+ OR (geo = 'PL8' AND age = 'Y3')
+ OR (geo = 'PL81' AND age = 'Y3')
+ OR (geo = 'PL82' AND age = 'Y3')
+ OR (geo = 'PL84' AND age = 'Y3')
+ OR (geo = 'PL9' AND age = 'Y3')
+ OR (geo = 'PL91' AND age = 'Y3')
+ OR (geo = 'PL92' AND age = 'Y3')
+ OR (geo = 'PT' AND age = 'Y3')
+ OR (geo = 'PT1' AND age = 'Y3')
+ OR (geo = 'PT11' AND age = 'Y3')
+ OR (geo = 'PT15' AND age = 'Y3')
+ OR (geo = 'PT16' AND age = 'Y3')
+ OR (geo = 'PT17' AND age = 'Y3')
+ OR (geo = 'PT18' AND age = 'Y3')
+ OR (geo = 'PT19' AND age = 'Y3')
+ OR (geo = 'PT1A' AND age = 'Y3')
+ OR (geo = 'PT1B' AND age = 'Y3')
+ OR (geo = 'PT1C' AND age = 'Y3')
+ OR (geo = 'PT1D' AND age = 'Y3')
+ OR (geo = 'PT2' AND age = 'Y3')
+ OR (geo = 'PT20' AND age = 'Y3')
+ OR (geo = 'PT3' AND age = 'Y3')
+ OR (geo = 'PT30' AND age = 'Y3')
+ OR (geo = 'RO' AND age = 'Y3')
+ OR (geo = 'RO1' AND age = 'Y3')
+ OR (geo = 'RO11' AND age = 'Y3')
+ OR (geo = 'RO12' AND age = 'Y3')
+ OR (geo = 'RO2' AND age = 'Y3')
+ OR (geo = 'RO21' AND age = 'Y3')
+ OR (geo = 'RO22' AND age = 'Y3')
+ OR (geo = 'RO3' AND age = 'Y3')
+ OR (geo = 'RO31' AND age = 'Y3')
+ OR (geo = 'RO32' AND age = 'Y3')
+ OR (geo = 'RO4' AND age = 'Y3')
+ OR (geo = 'RO41' AND age = 'Y3')
+ OR (geo = 'RO42' AND age = 'Y3')
+ OR (geo = 'SI' AND age = 'Y3')
+ OR (geo = 'SI0' AND age = 'Y3')
+ OR (geo = 'SI03' AND age = 'Y3')
+ OR (geo = 'SI04' AND age = 'Y3')
+ OR (geo = 'SK' AND age = 'Y3')
+ OR (geo = 'SK0' AND age = 'Y3')
+ OR (geo = 'SK01' AND age = 'Y3')
+ OR (geo = 'SK02' AND age = 'Y3')
+ OR (geo = 'SK03' AND age = 'Y3')
+ OR (geo = 'SK04' AND age = 'Y3')
+ OR (geo = 'FI' AND age = 'Y3')
+ OR (geo = 'FI1' AND age = 'Y3')
+ OR (geo = 'FI19' AND age = 'Y3')
+ OR (geo = 'FI1B' AND age = 'Y3')
+ OR (geo = 'FI1C' AND age = 'Y3')
+ OR (geo = 'FI1D' AND age = 'Y3')
+ OR (geo = 'FI2' AND age = 'Y3')
+ OR (geo = 'FI20' AND age = 'Y3')
+ OR (geo = 'SE' AND age = 'Y3')
+ OR (geo = 'SE1' AND age = 'Y3')
+ OR (geo = 'SE11' AND age = 'Y3')
+ OR (geo = 'SE12' AND age = 'Y3')
+ OR (geo = 'SE2' AND age = 'Y3')
+ OR (geo = 'SE21' AND age = 'Y3')
+ OR (geo = 'SE22' AND age = 'Y3')
+ OR (geo = 'SE23' AND age = 'Y3')
+ OR (geo = 'SE3' AND age = 'Y3')
+ OR (geo = 'SE31' AND age = 'Y3')
+ OR (geo = 'SE32' AND age = 'Y3')
+ OR (geo = 'SE33' AND age = 'Y3')
+ OR (geo = 'EFTA' AND age = 'Y3')
+ OR (geo = 'IS' AND age = 'Y3')
+ OR (geo = 'IS0' AND age = 'Y3')
+ OR (geo = 'IS00' AND age = 'Y3')
+ OR (geo = 'LI' AND age = 'Y3')
+ OR (geo = 'LI0' AND age = 'Y3')
+ OR (geo = 'LI00' AND age = 'Y3')
+ OR (geo = 'NO' AND age = 'Y3')
+ OR (geo = 'NO0' AND age = 'Y3')
+ OR (geo = 'NO01' AND age = 'Y3')
+ OR (geo = 'NO02' AND age = 'Y3')
+ OR (geo = 'NO03' AND age = 'Y3')
+ OR (geo = 'NO04' AND age = 'Y3')
+ OR (geo = 'NO05' AND age = 'Y3')
+ OR (geo = 'NO06' AND age = 'Y3')
+ OR (geo = 'NO07' AND age = 'Y3')
+ OR (geo = 'NO08' AND age = 'Y3')
+ OR (geo = 'NO09' AND age = 'Y3')
+ OR (geo = 'NO0A' AND age = 'Y3')
+ OR (geo = 'NO0B' AND age = 'Y3')
+ OR (geo = 'CH' AND age = 'Y3')
+ OR (geo = 'CH0' AND age = 'Y3')
+ OR (geo = 'CH01' AND age = 'Y3')
+ OR (geo = 'CH02' AND age = 'Y3')
+ OR (geo = 'CH03' AND age = 'Y3')
+ OR (geo = 'CH04' AND age = 'Y3')
+ OR (geo = 'CH05' AND age = 'Y3')
+ OR (geo = 'CH06' AND age = 'Y3')
+ OR (geo = 'CH07' AND age = 'Y3')
+ OR (geo = 'UK' AND age = 'Y3')
+ OR (geo = 'UKC' AND age = 'Y3')
+ OR (geo = 'UKC1' AND age = 'Y3')
+ OR (geo = 'UKC2' AND age = 'Y3')
+ OR (geo = 'UKD' AND age = 'Y3')
+ OR (geo = 'UKD1' AND age = 'Y3')
+ OR (geo = 'UKD3' AND age = 'Y3')
+ OR (geo = 'UKD4' AND age = 'Y3')
+ OR (geo = 'UKD6' AND age = 'Y3')
+ OR (geo = 'UKD7' AND age = 'Y3')
+ OR (geo = 'UKE' AND age = 'Y3')
+ OR (geo = 'UKE1' AND age = 'Y3')
+ OR (geo = 'UKE2' AND age = 'Y3')
+ OR (geo = 'UKE3' AND age = 'Y3')
+ OR (geo = 'UKE4' AND age = 'Y3')
+ OR (geo = 'UKF' AND age = 'Y3')
+ OR (geo = 'UKF1' AND age = 'Y3')
+ OR (geo = 'UKF2' AND age = 'Y3')
+ OR (geo = 'UKF3' AND age = 'Y3')
+ OR (geo = 'UKG' AND age = 'Y3')
+ OR (geo = 'UKG1' AND age = 'Y3')
+ OR (geo = 'UKG2' AND age = 'Y3')
+ OR (geo = 'UKG3' AND age = 'Y3')
+ OR (geo = 'UKH' AND age = 'Y3')
+ OR (geo = 'UKH1' AND age = 'Y3')
+ OR (geo = 'UKH2' AND age = 'Y3')
+ OR (geo = 'UKH3' AND age = 'Y3')
+ OR (geo = 'UKI' AND age = 'Y3')
+ OR (geo = 'UKI3' AND age = 'Y3')
+ OR (geo = 'UKI4' AND age = 'Y3')
+ OR (geo = 'UKI5' AND age = 'Y3')
+ OR (geo = 'UKI6' AND age = 'Y3')
+ OR (geo = 'UKI7' AND age = 'Y3')
+ OR (geo = 'UKJ' AND age = 'Y3')
+ OR (geo = 'UKJ1' AND age = 'Y3')
+ OR (geo = 'UKJ2' AND age = 'Y3')
+ OR (geo = 'UKJ3' AND age = 'Y3')
+ OR (geo = 'UKJ4' AND age = 'Y3')
+ OR (geo = 'UKK' AND age = 'Y3')
+ OR (geo = 'UKK1' AND age = 'Y3')
+ OR (geo = 'UKK2' AND age = 'Y3')
+ OR (geo = 'UKK3' AND age = 'Y3')
+ OR (geo = 'UKK4' AND age = 'Y3')
+ OR (geo = 'UKL' AND age = 'Y3')
+ OR (geo = 'UKL1' AND age = 'Y3')
+ OR (geo = 'UKL2' AND age = 'Y3')
+ OR (geo = 'UKM' AND age = 'Y3')
+ OR (geo = 'UKM5' AND age = 'Y3')
+ OR (geo = 'UKM6' AND age = 'Y3')
+ OR (geo = 'UKM7' AND age = 'Y3')
+ OR (geo = 'UKM8' AND age = 'Y3')
+ OR (geo = 'UKM9' AND age = 'Y3')
+ OR (geo = 'UKN' AND age = 'Y3')
+ OR (geo = 'UKN0' AND age = 'Y3')
+ OR (geo = 'ME' AND age = 'Y3')
+ OR (geo = 'ME0' AND age = 'Y3')
+ OR (geo = 'ME00' AND age = 'Y3')
+ OR (geo = 'MK' AND age = 'Y3')
+ OR (geo = 'MK0' AND age = 'Y3')
+ OR (geo = 'MK00' AND age = 'Y3')
+ OR (geo = 'MKX' AND age = 'Y3')
+ OR (geo = 'MKXX' AND age = 'Y3')
+ OR (geo = 'AL' AND age = 'Y3')
+ OR (geo = 'AL0' AND age = 'Y3')
+ OR (geo = 'AL01' AND age = 'Y3')
+ OR (geo = 'AL02' AND age = 'Y3')
+ OR (geo = 'AL03' AND age = 'Y3')
+ OR (geo = 'ALX' AND age = 'Y3')
+ OR (geo = 'ALXX' AND age = 'Y3')
+ OR (geo = 'RS' AND age = 'Y3')
+ OR (geo = 'RS1' AND age = 'Y3')
+ OR (geo = 'RS11' AND age = 'Y3')
+ OR (geo = 'RS12' AND age = 'Y3')
+ OR (geo = 'RS2' AND age = 'Y3')
+ OR (geo = 'RS21' AND age = 'Y3')
+ OR (geo = 'RS22' AND age = 'Y3')
+ OR (geo = 'TR' AND age = 'Y3')
+ OR (geo = 'TR1' AND age = 'Y3')
+ OR (geo = 'TR10' AND age = 'Y3')
+ OR (geo = 'TR2' AND age = 'Y3')
+ OR (geo = 'TR21' AND age = 'Y3')
+ OR (geo = 'TR22' AND age = 'Y3')
+ OR (geo = 'TR3' AND age = 'Y3')
+ OR (geo = 'TR31' AND age = 'Y3')
+ OR (geo = 'TR32' AND age = 'Y3')
+ OR (geo = 'TR33' AND age = 'Y3')
+ OR (geo = 'TR4' AND age = 'Y3')
+ OR (geo = 'TR41' AND age = 'Y3')
+ OR (geo = 'TR42' AND age = 'Y3')
+ OR (geo = 'TR5' AND age = 'Y3')
+ OR (geo = 'TR51' AND age = 'Y3')
+ OR (geo = 'TR52' AND age = 'Y3')
+ OR (geo = 'TR6' AND age = 'Y3')
+ OR (geo = 'TR61' AND age = 'Y3')
+ OR (geo = 'TR62' AND age = 'Y3')
+ OR (geo = 'TR63' AND age = 'Y3')
+ OR (geo = 'TR7' AND age = 'Y3')
+ OR (geo = 'TR71' AND age = 'Y3')
+ OR (geo = 'TR72' AND age = 'Y3')
+ OR (geo = 'TR8' AND age = 'Y3')
+ OR (geo = 'TR81' AND age = 'Y3')
+ OR (geo = 'TR82' AND age = 'Y3')
+ OR (geo = 'TR83' AND age = 'Y3')
+ OR (geo = 'TR9' AND age = 'Y3')
+ OR (geo = 'TR90' AND age = 'Y3')
+ OR (geo = 'TRA' AND age = 'Y3')
+ OR (geo = 'TRA1' AND age = 'Y3')
+ OR (geo = 'TRA2' AND age = 'Y3')
+ OR (geo = 'TRB' AND age = 'Y3')
+ OR (geo = 'TRB1' AND age = 'Y3')
+ OR (geo = 'TRB2' AND age = 'Y3')
+ OR (geo = 'TRC' AND age = 'Y3')
+ OR (geo = 'TRC1' AND age = 'Y3')
+ OR (geo = 'TRC2' AND age = 'Y3')
+ OR (geo = 'TRC3' AND age = 'Y3')
+ OR (geo = 'EU27_2020' AND age = 'Y4')
+ OR (geo = 'EU28' AND age = 'Y4')
+ OR (geo = 'EU27_2007' AND age = 'Y4')
+ OR (geo = 'BE' AND age = 'Y4')
+ OR (geo = 'BE1' AND age = 'Y4')
+ OR (geo = 'BE10' AND age = 'Y4')
+ OR (geo = 'BE2' AND age = 'Y4')
+ OR (geo = 'BE21' AND age = 'Y4')
+ OR (geo = 'BE22' AND age = 'Y4')
+ OR (geo = 'BE23' AND age = 'Y4')
+ OR (geo = 'BE24' AND age = 'Y4')
+ OR (geo = 'BE25' AND age = 'Y4')
+ OR (geo = 'BE3' AND age = 'Y4')
+ OR (geo = 'BE31' AND age = 'Y4')
+ OR (geo = 'BE32' AND age = 'Y4')
+ OR (geo = 'BE33' AND age = 'Y4')
+ OR (geo = 'BE34' AND age = 'Y4')
+ OR (geo = 'BE35' AND age = 'Y4')
+ OR (geo = 'BG' AND age = 'Y4')
+ OR (geo = 'BG3' AND age = 'Y4')
+ OR (geo = 'BG31' AND age = 'Y4')
+ OR (geo = 'BG32' AND age = 'Y4')
+ OR (geo = 'BG33' AND age = 'Y4')
+ OR (geo = 'BG34' AND age = 'Y4')
+ OR (geo = 'BG4' AND age = 'Y4')
+ OR (geo = 'BG41' AND age = 'Y4')
+ OR (geo = 'BG42' AND age = 'Y4')
+ OR (geo = 'CZ' AND age = 'Y4')
+ OR (geo = 'CZ0' AND age = 'Y4')
+ OR (geo = 'CZ01' AND age = 'Y4')
+ OR (geo = 'CZ02' AND age = 'Y4')
+ OR (geo = 'CZ03' AND age = 'Y4')
+ OR (geo = 'CZ04' AND age = 'Y4')
+ OR (geo = 'CZ05' AND age = 'Y4')
+ OR (geo = 'CZ06' AND age = 'Y4')
+ OR (geo = 'CZ07' AND age = 'Y4')
+ OR (geo = 'CZ08' AND age = 'Y4')
+ OR (geo = 'DK' AND age = 'Y4')
+ OR (geo = 'DK0' AND age = 'Y4')
+ OR (geo = 'DK01' AND age = 'Y4')
+ OR (geo = 'DK02' AND age = 'Y4')
+ OR (geo = 'DK03' AND age = 'Y4')
+ OR (geo = 'DK04' AND age = 'Y4')
+ OR (geo = 'DK05' AND age = 'Y4')
+ OR (geo = 'DE' AND age = 'Y4')
+ OR (geo = 'DE_TOT' AND age = 'Y4')
+ OR (geo = 'DE1' AND age = 'Y4')
+ OR (geo = 'DE11' AND age = 'Y4')
+ OR (geo = 'DE12' AND age = 'Y4')
+ OR (geo = 'DE13' AND age = 'Y4')
+ OR (geo = 'DE14' AND age = 'Y4')
+ OR (geo = 'DE2' AND age = 'Y4')
+ OR (geo = 'DE21' AND age = 'Y4')
+ OR (geo = 'DE22' AND age = 'Y4')
+ OR (geo = 'DE23' AND age = 'Y4')
+ OR (geo = 'DE24' AND age = 'Y4')
+ OR (geo = 'DE25' AND age = 'Y4')
+ OR (geo = 'DE26' AND age = 'Y4')
+ OR (geo = 'DE27' AND age = 'Y4')
+ OR (geo = 'DE3' AND age = 'Y4')
+ OR (geo = 'DE30' AND age = 'Y4')
+ OR (geo = 'DE4' AND age = 'Y4')
+ OR (geo = 'DE40' AND age = 'Y4')
+ OR (geo = 'DE5' AND age = 'Y4')
+ OR (geo = 'DE50' AND age = 'Y4')
+ OR (geo = 'DE6' AND age = 'Y4')
+ OR (geo = 'DE60' AND age = 'Y4')
+ OR (geo = 'DE7' AND age = 'Y4')
+ OR (geo = 'DE71' AND age = 'Y4')
+ OR (geo = 'DE72' AND age = 'Y4')
+ OR (geo = 'DE73' AND age = 'Y4')
+ OR (geo = 'DE8' AND age = 'Y4')
+ OR (geo = 'DE80' AND age = 'Y4')
+ OR (geo = 'DE9' AND age = 'Y4')
+ OR (geo = 'DE91' AND age = 'Y4')
+ OR (geo = 'DE92' AND age = 'Y4')
+ OR (geo = 'DE93' AND age = 'Y4')
+ OR (geo = 'DE94' AND age = 'Y4')
+ OR (geo = 'DEA' AND age = 'Y4')
+ OR (geo = 'DEA1' AND age = 'Y4')
+ OR (geo = 'DEA2' AND age = 'Y4')
+ OR (geo = 'DEA3' AND age = 'Y4')
+ OR (geo = 'DEA4' AND age = 'Y4')
+ OR (geo = 'DEA5' AND age = 'Y4')
+ OR (geo = 'DEB' AND age = 'Y4')
+ OR (geo = 'DEB1' AND age = 'Y4')
+ OR (geo = 'DEB2' AND age = 'Y4')
+ OR (geo = 'DEB3' AND age = 'Y4')
+ OR (geo = 'DEC' AND age = 'Y4')
+ OR (geo = 'DEC0' AND age = 'Y4')
+ OR (geo = 'DED' AND age = 'Y4')
+ OR (geo = 'DED2' AND age = 'Y4')
+ OR (geo = 'DED4' AND age = 'Y4')
+ OR (geo = 'DED5' AND age = 'Y4')
+ OR (geo = 'DEE' AND age = 'Y4')
+ OR (geo = 'DEE0' AND age = 'Y4')
+ OR (geo = 'DEF' AND age = 'Y4')
+ OR (geo = 'DEF0' AND age = 'Y4')
+ OR (geo = 'DEG' AND age = 'Y4')
+ OR (geo = 'DEG0' AND age = 'Y4')
+ OR (geo = 'EE' AND age = 'Y4')
+ OR (geo = 'EE0' AND age = 'Y4')
+ OR (geo = 'EE00' AND age = 'Y4')
+ OR (geo = 'IE' AND age = 'Y4')
+ OR (geo = 'IE0' AND age = 'Y4')
+ OR (geo = 'IE04' AND age = 'Y4')
+ OR (geo = 'IE05' AND age = 'Y4')
+ OR (geo = 'IE06' AND age = 'Y4')
+ OR (geo = 'EL' AND age = 'Y4')
+ OR (geo = 'EL3' AND age = 'Y4')
+ OR (geo = 'EL30' AND age = 'Y4')
+ OR (geo = 'EL4' AND age = 'Y4')
+ OR (geo = 'EL41' AND age = 'Y4')
+ OR (geo = 'EL42' AND age = 'Y4')
+ OR (geo = 'EL43' AND age = 'Y4')
+ OR (geo = 'EL5' AND age = 'Y4')
+ OR (geo = 'EL51' AND age = 'Y4')
+ OR (geo = 'EL52' AND age = 'Y4')
+ OR (geo = 'EL53' AND age = 'Y4')
+ OR (geo = 'EL54' AND age = 'Y4')
+ OR (geo = 'EL6' AND age = 'Y4')
+ OR (geo = 'EL61' AND age = 'Y4')
+ OR (geo = 'EL62' AND age = 'Y4')
+ OR (geo = 'EL63' AND age = 'Y4')
+ OR (geo = 'EL64' AND age = 'Y4')
+ OR (geo = 'EL65' AND age = 'Y4')
+ OR (geo = 'ES' AND age = 'Y4')
+ OR (geo = 'ES1' AND age = 'Y4')
+ OR (geo = 'ES11' AND age = 'Y4')
+ OR (geo = 'ES12' AND age = 'Y4')
+ OR (geo = 'ES13' AND age = 'Y4')
+ OR (geo = 'ES2' AND age = 'Y4')
+ OR (geo = 'ES21' AND age = 'Y4')
+ OR (geo = 'ES22' AND age = 'Y4')
+ OR (geo = 'ES23' AND age = 'Y4')
+ OR (geo = 'ES24' AND age = 'Y4')
+ OR (geo = 'ES3' AND age = 'Y4')
+ OR (geo = 'ES30' AND age = 'Y4')
+ OR (geo = 'ES4' AND age = 'Y4')
+ OR (geo = 'ES41' AND age = 'Y4')
+ OR (geo = 'ES42' AND age = 'Y4')
+ OR (geo = 'ES43' AND age = 'Y4')
+ OR (geo = 'ES5' AND age = 'Y4')
+ OR (geo = 'ES51' AND age = 'Y4')
+ OR (geo = 'ES52' AND age = 'Y4')
+ OR (geo = 'ES53' AND age = 'Y4')
+ OR (geo = 'ES6' AND age = 'Y4')
+ OR (geo = 'ES61' AND age = 'Y4')
+ OR (geo = 'ES62' AND age = 'Y4')
+ OR (geo = 'ES63' AND age = 'Y4')
+ OR (geo = 'ES64' AND age = 'Y4')
+ OR (geo = 'ES7' AND age = 'Y4')
+ OR (geo = 'ES70' AND age = 'Y4')
+ OR (geo = 'FR' AND age = 'Y4')
+ OR (geo = 'FR1' AND age = 'Y4')
+ OR (geo = 'FR10' AND age = 'Y4')
+ OR (geo = 'FRB' AND age = 'Y4')
+ OR (geo = 'FRB0' AND age = 'Y4')
+ OR (geo = 'FRC' AND age = 'Y4')
+ OR (geo = 'FRC1' AND age = 'Y4')
+ OR (geo = 'FRC2' AND age = 'Y4')
+ OR (geo = 'FRD' AND age = 'Y4')
+ OR (geo = 'FRD1' AND age = 'Y4')
+ OR (geo = 'FRD2' AND age = 'Y4')
+ OR (geo = 'FRE' AND age = 'Y4')
+ OR (geo = 'FRE1' AND age = 'Y4')
+ OR (geo = 'FRE2' AND age = 'Y4')
+ OR (geo = 'FRF' AND age = 'Y4')
+ OR (geo = 'FRF1' AND age = 'Y4')
+ OR (geo = 'FRF2' AND age = 'Y4')
+ OR (geo = 'FRF3' AND age = 'Y4')
+ OR (geo = 'FRG' AND age = 'Y4')
+ OR (geo = 'FRG0' AND age = 'Y4')
+ OR (geo = 'FRH' AND age = 'Y4')
+ OR (geo = 'FRH0' AND age = 'Y4')
+ OR (geo = 'FRI' AND age = 'Y4')
+ OR (geo = 'FRI1' AND age = 'Y4')
+ OR (geo = 'FRI2' AND age = 'Y4')
+ OR (geo = 'FRI3' AND age = 'Y4')
+ OR (geo = 'FRJ' AND age = 'Y4')
+ OR (geo = 'FRJ1' AND age = 'Y4')
+ OR (geo = 'FRJ2' AND age = 'Y4')
+ OR (geo = 'FRK' AND age = 'Y4')
+ OR (geo = 'FRK1' AND age = 'Y4')
+ OR (geo = 'FRK2' AND age = 'Y4')
+ OR (geo = 'FRL' AND age = 'Y4')
+ OR (geo = 'FRL0' AND age = 'Y4')
+ OR (geo = 'FRM' AND age = 'Y4')
+ OR (geo = 'FRM0' AND age = 'Y4')
+ OR (geo = 'FRY' AND age = 'Y4')
+ OR (geo = 'FRY1' AND age = 'Y4')
+ OR (geo = 'FRY2' AND age = 'Y4')
+ OR (geo = 'FRY3' AND age = 'Y4')
+ OR (geo = 'FRY4' AND age = 'Y4')
+ OR (geo = 'FRY5' AND age = 'Y4')
+ OR (geo = 'FRX' AND age = 'Y4')
+ OR (geo = 'FRXX' AND age = 'Y4')
+ OR (geo = 'HR' AND age = 'Y4')
+ OR (geo = 'HR0' AND age = 'Y4')
+ OR (geo = 'HR02' AND age = 'Y4')
+ OR (geo = 'HR03' AND age = 'Y4')
+ OR (geo = 'HR04' AND age = 'Y4')
+ OR (geo = 'HR05' AND age = 'Y4')
+ OR (geo = 'HR06' AND age = 'Y4')
+ OR (geo = 'IT' AND age = 'Y4')
+ OR (geo = 'ITC' AND age = 'Y4')
+ OR (geo = 'ITC1' AND age = 'Y4')
+ OR (geo = 'ITC2' AND age = 'Y4')
+ OR (geo = 'ITC3' AND age = 'Y4')
+ OR (geo = 'ITC4' AND age = 'Y4')
+ OR (geo = 'ITF' AND age = 'Y4')
+ OR (geo = 'ITF1' AND age = 'Y4')
+ OR (geo = 'ITF2' AND age = 'Y4')
+ OR (geo = 'ITF3' AND age = 'Y4')
+ OR (geo = 'ITF4' AND age = 'Y4')
+ OR (geo = 'ITF5' AND age = 'Y4')
+ OR (geo = 'ITF6' AND age = 'Y4')
+ OR (geo = 'ITG' AND age = 'Y4')
+ OR (geo = 'ITG1' AND age = 'Y4')
+ OR (geo = 'ITG2' AND age = 'Y4')
+ OR (geo = 'ITH' AND age = 'Y4')
+ OR (geo = 'ITH1' AND age = 'Y4')
+ OR (geo = 'ITH2' AND age = 'Y4')
+ OR (geo = 'ITH3' AND age = 'Y4')
+ OR (geo = 'ITH4' AND age = 'Y4')
+ OR (geo = 'ITH5' AND age = 'Y4')
+ OR (geo = 'ITI' AND age = 'Y4')
+ OR (geo = 'ITI1' AND age = 'Y4')
+ OR (geo = 'ITI2' AND age = 'Y4')
+ OR (geo = 'ITI3' AND age = 'Y4')
+ OR (geo = 'ITI4' AND age = 'Y4')
+ OR (geo = 'CY' AND age = 'Y4')
+ OR (geo = 'CY0' AND age = 'Y4')
+ OR (geo = 'CY00' AND age = 'Y4')
+ OR (geo = 'LV' AND age = 'Y4')
+ OR (geo = 'LV0' AND age = 'Y4')
+ OR (geo = 'LV00' AND age = 'Y4')
+ OR (geo = 'LT' AND age = 'Y4')
+ OR (geo = 'LT0' AND age = 'Y4')
+ OR (geo = 'LT01' AND age = 'Y4')
+ OR (geo = 'LT02' AND age = 'Y4')
+ OR (geo = 'LU' AND age = 'Y4')
+ OR (geo = 'LU0' AND age = 'Y4')
+ OR (geo = 'LU00' AND age = 'Y4')
+ OR (geo = 'HU' AND age = 'Y4')
+ OR (geo = 'HU1' AND age = 'Y4')
+ OR (geo = 'HU11' AND age = 'Y4')
+ OR (geo = 'HU12' AND age = 'Y4')
+ OR (geo = 'HU2' AND age = 'Y4')
+ OR (geo = 'HU21' AND age = 'Y4')
+ OR (geo = 'HU22' AND age = 'Y4')
+ OR (geo = 'HU23' AND age = 'Y4')
+ OR (geo = 'HU3' AND age = 'Y4')
+ OR (geo = 'HU31' AND age = 'Y4')
+ OR (geo = 'HU32' AND age = 'Y4')
+ OR (geo = 'HU33' AND age = 'Y4')
+ OR (geo = 'HUX' AND age = 'Y4')
+ OR (geo = 'HUXX' AND age = 'Y4')
+ OR (geo = 'MT' AND age = 'Y4')
+ OR (geo = 'MT0' AND age = 'Y4')
+ OR (geo = 'MT00' AND age = 'Y4')
+ OR (geo = 'NL' AND age = 'Y4')
+ OR (geo = 'NL1' AND age = 'Y4')
+ OR (geo = 'NL11' AND age = 'Y4')
+ OR (geo = 'NL12' AND age = 'Y4')
+ OR (geo = 'NL13' AND age = 'Y4')
+ OR (geo = 'NL2' AND age = 'Y4')
+ OR (geo = 'NL21' AND age = 'Y4')
+ OR (geo = 'NL22' AND age = 'Y4')
+ OR (geo = 'NL23' AND age = 'Y4')
+ OR (geo = 'NL3' AND age = 'Y4')
+ OR (geo = 'NL31' AND age = 'Y4')
+ OR (geo = 'NL32' AND age = 'Y4')
+ OR (geo = 'NL33' AND age = 'Y4')
+ OR (geo = 'NL34' AND age = 'Y4')
+ OR (geo = 'NL35' AND age = 'Y4')
+ OR (geo = 'NL36' AND age = 'Y4')
+ OR (geo = 'NL4' AND age = 'Y4')
+ OR (geo = 'NL41' AND age = 'Y4')
+ OR (geo = 'NL42' AND age = 'Y4')
+ OR (geo = 'AT' AND age = 'Y4')
+ OR (geo = 'AT1' AND age = 'Y4')
+ OR (geo = 'AT11' AND age = 'Y4')
+ OR (geo = 'AT12' AND age = 'Y4')
+ OR (geo = 'AT13' AND age = 'Y4')
+ OR (geo = 'AT2' AND age = 'Y4')
+ OR (geo = 'AT21' AND age = 'Y4')
+ OR (geo = 'AT22' AND age = 'Y4')
+ OR (geo = 'AT3' AND age = 'Y4')
+ OR (geo = 'AT31' AND age = 'Y4')
+ OR (geo = 'AT32' AND age = 'Y4')
+ OR (geo = 'AT33' AND age = 'Y4')
+ OR (geo = 'AT34' AND age = 'Y4')
+ OR (geo = 'PL' AND age = 'Y4')
+ OR (geo = 'PL2' AND age = 'Y4')
+ OR (geo = 'PL21' AND age = 'Y4')
+ OR (geo = 'PL22' AND age = 'Y4')
+ OR (geo = 'PL4' AND age = 'Y4')
+ OR (geo = 'PL41' AND age = 'Y4')
+ OR (geo = 'PL42' AND age = 'Y4')
+ OR (geo = 'PL43' AND age = 'Y4')
+ OR (geo = 'PL5' AND age = 'Y4')
+ OR (geo = 'PL51' AND age = 'Y4')
+ OR (geo = 'PL52' AND age = 'Y4')
+ OR (geo = 'PL6' AND age = 'Y4')
+ OR (geo = 'PL61' AND age = 'Y4')
+ OR (geo = 'PL62' AND age = 'Y4')
+ OR (geo = 'PL63' AND age = 'Y4')
+ OR (geo = 'PL7' AND age = 'Y4')
+ OR (geo = 'PL71' AND age = 'Y4')
+ OR (geo = 'PL72' AND age = 'Y4')
+ OR (geo = 'PL8' AND age = 'Y4')
+ OR (geo = 'PL81' AND age = 'Y4')
+ OR (geo = 'PL82' AND age = 'Y4')
+ OR (geo = 'PL84' AND age = 'Y4')
+ OR (geo = 'PL9' AND age = 'Y4')
+ OR (geo = 'PL91' AND age = 'Y4')
+ OR (geo = 'PL92' AND age = 'Y4')
+ OR (geo = 'PT' AND age = 'Y4')
+ OR (geo = 'PT1' AND age = 'Y4')
+ OR (geo = 'PT11' AND age = 'Y4')
+ OR (geo = 'PT15' AND age = 'Y4')
+ OR (geo = 'PT16' AND age = 'Y4')
+ OR (geo = 'PT17' AND age = 'Y4')
+ OR (geo = 'PT18' AND age = 'Y4')
+ OR (geo = 'PT19' AND age = 'Y4')
+ OR (geo = 'PT1A' AND age = 'Y4')
+ OR (geo = 'PT1B' AND age = 'Y4')
+ OR (geo = 'PT1C' AND age = 'Y4')
+ OR (geo = 'PT1D' AND age = 'Y4')
+ OR (geo = 'PT2' AND age = 'Y4')
+ OR (geo = 'PT20' AND age = 'Y4')
+ OR (geo = 'PT3' AND age = 'Y4')
+ OR (geo = 'PT30' AND age = 'Y4')
+ OR (geo = 'RO' AND age = 'Y4')
+ OR (geo = 'RO1' AND age = 'Y4')
+ OR (geo = 'RO11' AND age = 'Y4')
+ OR (geo = 'RO12' AND age = 'Y4')
+ OR (geo = 'RO2' AND age = 'Y4')
+ OR (geo = 'RO21' AND age = 'Y4')
+ OR (geo = 'RO22' AND age = 'Y4')
+ OR (geo = 'RO3' AND age = 'Y4')
+ OR (geo = 'RO31' AND age = 'Y4')
+ OR (geo = 'RO32' AND age = 'Y4')
+ OR (geo = 'RO4' AND age = 'Y4')
+ OR (geo = 'RO41' AND age = 'Y4')
+ OR (geo = 'RO42' AND age = 'Y4')
+ OR (geo = 'SI' AND age = 'Y4')
+ OR (geo = 'SI0' AND age = 'Y4')
+ OR (geo = 'SI03' AND age = 'Y4')
+ OR (geo = 'SI04' AND age = 'Y4')
+ OR (geo = 'SK' AND age = 'Y4')
+ OR (geo = 'SK0' AND age = 'Y4')
+ OR (geo = 'SK01' AND age = 'Y4')
+ OR (geo = 'SK02' AND age = 'Y4')
+ OR (geo = 'SK03' AND age = 'Y4')
+ OR (geo = 'SK04' AND age = 'Y4')
+ OR (geo = 'FI' AND age = 'Y4')
+ OR (geo = 'FI1' AND age = 'Y4')
+ OR (geo = 'FI19' AND age = 'Y4')
+ OR (geo = 'FI1B' AND age = 'Y4')
+ OR (geo = 'FI1C' AND age = 'Y4')
+ OR (geo = 'FI1D' AND age = 'Y4')
+ OR (geo = 'FI2' AND age = 'Y4')
+ OR (geo = 'FI20' AND age = 'Y4')
+ OR (geo = 'SE' AND age = 'Y4')
+ OR (geo = 'SE1' AND age = 'Y4')
+ OR (geo = 'SE11' AND age = 'Y4')
+ OR (geo = 'SE12' AND age = 'Y4')
+ OR (geo = 'SE2' AND age = 'Y4')
+ OR (geo = 'SE21' AND age = 'Y4')
+ OR (geo = 'SE22' AND age = 'Y4')
+ OR (geo = 'SE23' AND age = 'Y4')
+ OR (geo = 'SE3' AND age = 'Y4')
+ OR (geo = 'SE31' AND age = 'Y4')
+ OR (geo = 'SE32' AND age = 'Y4')
+ OR (geo = 'SE33' AND age = 'Y4')
+ OR (geo = 'EFTA' AND age = 'Y4')
+ OR (geo = 'IS' AND age = 'Y4')
+ OR (geo = 'IS0' AND age = 'Y4')
+ OR (geo = 'IS00' AND age = 'Y4')
+ OR (geo = 'LI' AND age = 'Y4')
+ OR (geo = 'LI0' AND age = 'Y4')
+ OR (geo = 'LI00' AND age = 'Y4')
+ OR (geo = 'NO' AND age = 'Y4')
+ OR (geo = 'NO0' AND age = 'Y4')
+ OR (geo = 'NO01' AND age = 'Y4')
+ OR (geo = 'NO02' AND age = 'Y4')
+ OR (geo = 'NO03' AND age = 'Y4')
+ OR (geo = 'NO04' AND age = 'Y4')
+ OR (geo = 'NO05' AND age = 'Y4')
+ OR (geo = 'NO06' AND age = 'Y4')
+ OR (geo = 'NO07' AND age = 'Y4')
+ OR (geo = 'NO08' AND age = 'Y4')
+ OR (geo = 'NO09' AND age = 'Y4')
+ OR (geo = 'NO0A' AND age = 'Y4')
+ OR (geo = 'NO0B' AND age = 'Y4')
+ OR (geo = 'CH' AND age = 'Y4')
+ OR (geo = 'CH0' AND age = 'Y4')
+ OR (geo = 'CH01' AND age = 'Y4')
+ OR (geo = 'CH02' AND age = 'Y4')
+ OR (geo = 'CH03' AND age = 'Y4')
+ OR (geo = 'CH04' AND age = 'Y4')
+ OR (geo = 'CH05' AND age = 'Y4')
+ OR (geo = 'CH06' AND age = 'Y4')
+ OR (geo = 'CH07' AND age = 'Y4')
+ OR (geo = 'UK' AND age = 'Y4')
+ OR (geo = 'UKC' AND age = 'Y4')
+ OR (geo = 'UKC1' AND age = 'Y4')
+ OR (geo = 'UKC2' AND age = 'Y4')
+ OR (geo = 'UKD' AND age = 'Y4')
+ OR (geo = 'UKD1' AND age = 'Y4')
+ OR (geo = 'UKD3' AND age = 'Y4')
+ OR (geo = 'UKD4' AND age = 'Y4')
+ OR (geo = 'UKD6' AND age = 'Y4')
+ OR (geo = 'UKD7' AND age = 'Y4')
+ OR (geo = 'UKE' AND age = 'Y4')
+ OR (geo = 'UKE1' AND age = 'Y4')
+ OR (geo = 'UKE2' AND age = 'Y4')
+ OR (geo = 'UKE3' AND age = 'Y4')
+ OR (geo = 'UKE4' AND age = 'Y4')
+ OR (geo = 'UKF' AND age = 'Y4')
+ OR (geo = 'UKF1' AND age = 'Y4')
+ OR (geo = 'UKF2' AND age = 'Y4')
+ OR (geo = 'UKF3' AND age = 'Y4')
+ OR (geo = 'UKG' AND age = 'Y4')
+ OR (geo = 'UKG1' AND age = 'Y4')
+ OR (geo = 'UKG2' AND age = 'Y4')
+ OR (geo = 'UKG3' AND age = 'Y4')
+ OR (geo = 'UKH' AND age = 'Y4')
+ OR (geo = 'UKH1' AND age = 'Y4')
+ OR (geo = 'UKH2' AND age = 'Y4')
+ OR (geo = 'UKH3' AND age = 'Y4')
+ OR (geo = 'UKI' AND age = 'Y4')
+ OR (geo = 'UKI3' AND age = 'Y4')
+ OR (geo = 'UKI4' AND age = 'Y4')
+ OR (geo = 'UKI5' AND age = 'Y4')
+ OR (geo = 'UKI6' AND age = 'Y4')
+ OR (geo = 'UKI7' AND age = 'Y4')
+ OR (geo = 'UKJ' AND age = 'Y4')
+ OR (geo = 'UKJ1' AND age = 'Y4')
+ OR (geo = 'UKJ2' AND age = 'Y4')
+ OR (geo = 'UKJ3' AND age = 'Y4')
+ OR (geo = 'UKJ4' AND age = 'Y4')
+ OR (geo = 'UKK' AND age = 'Y4')
+ OR (geo = 'UKK1' AND age = 'Y4')
+ OR (geo = 'UKK2' AND age = 'Y4')
+ OR (geo = 'UKK3' AND age = 'Y4')
+ OR (geo = 'UKK4' AND age = 'Y4')
+ OR (geo = 'UKL' AND age = 'Y4')
+ OR (geo = 'UKL1' AND age = 'Y4')
+ OR (geo = 'UKL2' AND age = 'Y4')
+ OR (geo = 'UKM' AND age = 'Y4')
+ OR (geo = 'UKM5' AND age = 'Y4')
+ OR (geo = 'UKM6' AND age = 'Y4')
+ OR (geo = 'UKM7' AND age = 'Y4')
+ OR (geo = 'UKM8' AND age = 'Y4')
+ OR (geo = 'UKM9' AND age = 'Y4')
+ OR (geo = 'UKN' AND age = 'Y4')
+ OR (geo = 'UKN0' AND age = 'Y4')
+ OR (geo = 'ME' AND age = 'Y4')
+ OR (geo = 'ME0' AND age = 'Y4')
+ OR (geo = 'ME00' AND age = 'Y4')
+ OR (geo = 'MK' AND age = 'Y4')
+ OR (geo = 'MK0' AND age = 'Y4')
+ OR (geo = 'MK00' AND age = 'Y4')
+ OR (geo = 'MKX' AND age = 'Y4')
+ OR (geo = 'MKXX' AND age = 'Y4')
+ OR (geo = 'AL' AND age = 'Y4')
+ OR (geo = 'AL0' AND age = 'Y4')
+ OR (geo = 'AL01' AND age = 'Y4')
+ OR (geo = 'AL02' AND age = 'Y4')
+ OR (geo = 'AL03' AND age = 'Y4')
+ OR (geo = 'ALX' AND age = 'Y4')
+ OR (geo = 'ALXX' AND age = 'Y4')
+ OR (geo = 'RS' AND age = 'Y4')
+ OR (geo = 'RS1' AND age = 'Y4')
+ OR (geo = 'RS11' AND age = 'Y4')
+ OR (geo = 'RS12' AND age = 'Y4')
+ OR (geo = 'RS2' AND age = 'Y4')
+ OR (geo = 'RS21' AND age = 'Y4')
+ OR (geo = 'RS22' AND age = 'Y4')
+ OR (geo = 'TR' AND age = 'Y4')
+ OR (geo = 'TR1' AND age = 'Y4')
+ OR (geo = 'TR10' AND age = 'Y4')
+ OR (geo = 'TR2' AND age = 'Y4')
+ OR (geo = 'TR21' AND age = 'Y4')
+ OR (geo = 'TR22' AND age = 'Y4')
+ OR (geo = 'TR3' AND age = 'Y4')
+ OR (geo = 'TR31' AND age = 'Y4')
+ OR (geo = 'TR32' AND age = 'Y4')
+ OR (geo = 'TR33' AND age = 'Y4')
+ OR (geo = 'TR4' AND age = 'Y4')
+ OR (geo = 'TR41' AND age = 'Y4')
+ OR (geo = 'TR42' AND age = 'Y4')
+ OR (geo = 'TR5' AND age = 'Y4')
+ OR (geo = 'TR51' AND age = 'Y4')
+ OR (geo = 'TR52' AND age = 'Y4')
+ OR (geo = 'TR6' AND age = 'Y4')
+ OR (geo = 'TR61' AND age = 'Y4')
+ OR (geo = 'TR62' AND age = 'Y4')
+ OR (geo = 'TR63' AND age = 'Y4')
+ OR (geo = 'TR7' AND age = 'Y4')
+ OR (geo = 'TR71' AND age = 'Y4')
+ OR (geo = 'TR72' AND age = 'Y4')
+ OR (geo = 'TR8' AND age = 'Y4')
+ OR (geo = 'TR81' AND age = 'Y4')
+ OR (geo = 'TR82' AND age = 'Y4')
+ OR (geo = 'TR83' AND age = 'Y4')
+ OR (geo = 'TR9' AND age = 'Y4')
+ OR (geo = 'TR90' AND age = 'Y4')
+ OR (geo = 'TRA' AND age = 'Y4')
+ OR (geo = 'TRA1' AND age = 'Y4')
+ OR (geo = 'TRA2' AND age = 'Y4')
+ OR (geo = 'TRB' AND age = 'Y4')
+ OR (geo = 'TRB1' AND age = 'Y4')
+ OR (geo = 'TRB2' AND age = 'Y4')
+ OR (geo = 'TRC' AND age = 'Y4')
+ OR (geo = 'TRC1' AND age = 'Y4')
+ OR (geo = 'TRC2' AND age = 'Y4')
+ OR (geo = 'TRC3' AND age = 'Y4')
+ OR (geo = 'EU27_2020' AND age = 'Y5')
+ OR (geo = 'EU28' AND age = 'Y5')
+ OR (geo = 'EU27_2007' AND age = 'Y5')
+ OR (geo = 'BE' AND age = 'Y5')
+ OR (geo = 'BE1' AND age = 'Y5')
+ OR (geo = 'BE10' AND age = 'Y5')
+ OR (geo = 'BE2' AND age = 'Y5')
+ OR (geo = 'BE21' AND age = 'Y5')
+ OR (geo = 'BE22' AND age = 'Y5')
+ OR (geo = 'BE23' AND age = 'Y5')
+ OR (geo = 'BE24' AND age = 'Y5')
+ OR (geo = 'BE25' AND age = 'Y5')
+ OR (geo = 'BE3' AND age = 'Y5')
+ OR (geo = 'BE31' AND age = 'Y5')
+ OR (geo = 'BE32' AND age = 'Y5')
+ OR (geo = 'BE33' AND age = 'Y5')
+ OR (geo = 'BE34' AND age = 'Y5')
+ OR (geo = 'BE35' AND age = 'Y5')
+ OR (geo = 'BG' AND age = 'Y5')
+ OR (geo = 'BG3' AND age = 'Y5')
+ OR (geo = 'BG31' AND age = 'Y5')
+ OR (geo = 'BG32' AND age = 'Y5')
+ OR (geo = 'BG33' AND age = 'Y5')
+ OR (geo = 'BG34' AND age = 'Y5')
+ OR (geo = 'BG4' AND age = 'Y5')
+ OR (geo = 'BG41' AND age = 'Y5')
+ OR (geo = 'BG42' AND age = 'Y5')
+ OR (geo = 'CZ' AND age = 'Y5')
+ OR (geo = 'CZ0' AND age = 'Y5')
+ OR (geo = 'CZ01' AND age = 'Y5')
+ OR (geo = 'CZ02' AND age = 'Y5')
+ OR (geo = 'CZ03' AND age = 'Y5')
+ OR (geo = 'CZ04' AND age = 'Y5')
+ OR (geo = 'CZ05' AND age = 'Y5')
+ OR (geo = 'CZ06' AND age = 'Y5')
+ OR (geo = 'CZ07' AND age = 'Y5')
+ OR (geo = 'CZ08' AND age = 'Y5')
+ OR (geo = 'DK' AND age = 'Y5')
+ OR (geo = 'DK0' AND age = 'Y5')
+ OR (geo = 'DK01' AND age = 'Y5')
+ OR (geo = 'DK02' AND age = 'Y5')
+ OR (geo = 'DK03' AND age = 'Y5')
+ OR (geo = 'DK04' AND age = 'Y5')
+ OR (geo = 'DK05' AND age = 'Y5')
+ OR (geo = 'DE' AND age = 'Y5')
+ OR (geo = 'DE_TOT' AND age = 'Y5')
+ OR (geo = 'DE1' AND age = 'Y5')
+ OR (geo = 'DE11' AND age = 'Y5')
+ OR (geo = 'DE12' AND age = 'Y5')
+ OR (geo = 'DE13' AND age = 'Y5')
+ OR (geo = 'DE14' AND age = 'Y5')
+ OR (geo = 'DE2' AND age = 'Y5')
+ OR (geo = 'DE21' AND age = 'Y5')
+ OR (geo = 'DE22' AND age = 'Y5')
+ OR (geo = 'DE23' AND age = 'Y5')
+ OR (geo = 'DE24' AND age = 'Y5')
+ OR (geo = 'DE25' AND age = 'Y5')
+ OR (geo = 'DE26' AND age = 'Y5')
+ OR (geo = 'DE27' AND age = 'Y5')
+ OR (geo = 'DE3' AND age = 'Y5')
+ OR (geo = 'DE30' AND age = 'Y5')
+ OR (geo = 'DE4' AND age = 'Y5')
+ OR (geo = 'DE40' AND age = 'Y5')
+ OR (geo = 'DE5' AND age = 'Y5')
+ OR (geo = 'DE50' AND age = 'Y5')
+ OR (geo = 'DE6' AND age = 'Y5')
+ OR (geo = 'DE60' AND age = 'Y5')
+ OR (geo = 'DE7' AND age = 'Y5')
+ OR (geo = 'DE71' AND age = 'Y5')
+ OR (geo = 'DE72' AND age = 'Y5')
+ OR (geo = 'DE73' AND age = 'Y5')
+ OR (geo = 'DE8' AND age = 'Y5')
+ OR (geo = 'DE80' AND age = 'Y5')
+ OR (geo = 'DE9' AND age = 'Y5')
+ OR (geo = 'DE91' AND age = 'Y5')
+ OR (geo = 'DE92' AND age = 'Y5')
+ OR (geo = 'DE93' AND age = 'Y5')
+ OR (geo = 'DE94' AND age = 'Y5')
+ OR (geo = 'DEA' AND age = 'Y5')
+ OR (geo = 'DEA1' AND age = 'Y5')
+ OR (geo = 'DEA2' AND age = 'Y5')
+ OR (geo = 'DEA3' AND age = 'Y5')
+ OR (geo = 'DEA4' AND age = 'Y5')
+ OR (geo = 'DEA5' AND age = 'Y5')
+ OR (geo = 'DEB' AND age = 'Y5')
+ OR (geo = 'DEB1' AND age = 'Y5')
+ OR (geo = 'DEB2' AND age = 'Y5')
+ OR (geo = 'DEB3' AND age = 'Y5')
+ OR (geo = 'DEC' AND age = 'Y5')
+ OR (geo = 'DEC0' AND age = 'Y5')
+ OR (geo = 'DED' AND age = 'Y5')
+ OR (geo = 'DED2' AND age = 'Y5')
+ OR (geo = 'DED4' AND age = 'Y5')
+ OR (geo = 'DED5' AND age = 'Y5')
+ OR (geo = 'DEE' AND age = 'Y5')
+ OR (geo = 'DEE0' AND age = 'Y5')
+ OR (geo = 'DEF' AND age = 'Y5')
+ OR (geo = 'DEF0' AND age = 'Y5')
+ OR (geo = 'DEG' AND age = 'Y5')
+ OR (geo = 'DEG0' AND age = 'Y5')
+ OR (geo = 'EE' AND age = 'Y5')
+ OR (geo = 'EE0' AND age = 'Y5')
+ OR (geo = 'EE00' AND age = 'Y5')
+ OR (geo = 'IE' AND age = 'Y5')
+ OR (geo = 'IE0' AND age = 'Y5')
+ OR (geo = 'IE04' AND age = 'Y5')
+ OR (geo = 'IE05' AND age = 'Y5')
+ OR (geo = 'IE06' AND age = 'Y5')
+ OR (geo = 'EL' AND age = 'Y5')
+ OR (geo = 'EL3' AND age = 'Y5')
+ OR (geo = 'EL30' AND age = 'Y5')
+ OR (geo = 'EL4' AND age = 'Y5')
+ OR (geo = 'EL41' AND age = 'Y5')
+ OR (geo = 'EL42' AND age = 'Y5')
+ OR (geo = 'EL43' AND age = 'Y5')
+ OR (geo = 'EL5' AND age = 'Y5')
+ OR (geo = 'EL51' AND age = 'Y5')
+ OR (geo = 'EL52' AND age = 'Y5')
+ OR (geo = 'EL53' AND age = 'Y5')
+ OR (geo = 'EL54' AND age = 'Y5')
+ OR (geo = 'EL6' AND age = 'Y5')
+ OR (geo = 'EL61' AND age = 'Y5')
+ OR (geo = 'EL62' AND age = 'Y5')
+ OR (geo = 'EL63' AND age = 'Y5')
+ OR (geo = 'EL64' AND age = 'Y5')
+ OR (geo = 'EL65' AND age = 'Y5')
+ OR (geo = 'ES' AND age = 'Y5')
+ OR (geo = 'ES1' AND age = 'Y5')
+ OR (geo = 'ES11' AND age = 'Y5')
+ OR (geo = 'ES12' AND age = 'Y5')
+ OR (geo = 'ES13' AND age = 'Y5')
+ OR (geo = 'ES2' AND age = 'Y5')
+ OR (geo = 'ES21' AND age = 'Y5')
+ OR (geo = 'ES22' AND age = 'Y5')
+ OR (geo = 'ES23' AND age = 'Y5')
+ OR (geo = 'ES24' AND age = 'Y5')
+ OR (geo = 'ES3' AND age = 'Y5')
+ OR (geo = 'ES30' AND age = 'Y5')
+ OR (geo = 'ES4' AND age = 'Y5')
+ OR (geo = 'ES41' AND age = 'Y5')
+ OR (geo = 'ES42' AND age = 'Y5')
+ OR (geo = 'ES43' AND age = 'Y5')
+ OR (geo = 'ES5' AND age = 'Y5')
+ OR (geo = 'ES51' AND age = 'Y5')
+ OR (geo = 'ES52' AND age = 'Y5')
+ OR (geo = 'ES53' AND age = 'Y5')
+ OR (geo = 'ES6' AND age = 'Y5')
+ OR (geo = 'ES61' AND age = 'Y5')
+ OR (geo = 'ES62' AND age = 'Y5')
+ OR (geo = 'ES63' AND age = 'Y5')
+ OR (geo = 'ES64' AND age = 'Y5')
+ OR (geo = 'ES7' AND age = 'Y5')
+ OR (geo = 'ES70' AND age = 'Y5')
+ OR (geo = 'FR' AND age = 'Y5')
+ OR (geo = 'FR1' AND age = 'Y5')
+ OR (geo = 'FR10' AND age = 'Y5')
+ OR (geo = 'FRB' AND age = 'Y5')
+ OR (geo = 'FRB0' AND age = 'Y5')
+ OR (geo = 'FRC' AND age = 'Y5')
+ OR (geo = 'FRC1' AND age = 'Y5')
+ OR (geo = 'FRC2' AND age = 'Y5')
+ OR (geo = 'FRD' AND age = 'Y5')
+ OR (geo = 'FRD1' AND age = 'Y5')
+ OR (geo = 'FRD2' AND age = 'Y5')
+ OR (geo = 'FRE' AND age = 'Y5')
+ OR (geo = 'FRE1' AND age = 'Y5')
+ OR (geo = 'FRE2' AND age = 'Y5')
+ OR (geo = 'FRF' AND age = 'Y5')
+ OR (geo = 'FRF1' AND age = 'Y5')
+ OR (geo = 'FRF2' AND age = 'Y5')
+ OR (geo = 'FRF3' AND age = 'Y5')
+ OR (geo = 'FRG' AND age = 'Y5')
+ OR (geo = 'FRG0' AND age = 'Y5')
+ OR (geo = 'FRH' AND age = 'Y5')
+ OR (geo = 'FRH0' AND age = 'Y5')
+ OR (geo = 'FRI' AND age = 'Y5')
+ OR (geo = 'FRI1' AND age = 'Y5')
+ OR (geo = 'FRI2' AND age = 'Y5')
+ OR (geo = 'FRI3' AND age = 'Y5')
+ OR (geo = 'FRJ' AND age = 'Y5')
+ OR (geo = 'FRJ1' AND age = 'Y5')
+ OR (geo = 'FRJ2' AND age = 'Y5')
+ OR (geo = 'FRK' AND age = 'Y5')
+ OR (geo = 'FRK1' AND age = 'Y5')
+ OR (geo = 'FRK2' AND age = 'Y5')
+ OR (geo = 'FRL' AND age = 'Y5')
+ OR (geo = 'FRL0' AND age = 'Y5')
+ OR (geo = 'FRM' AND age = 'Y5')
+ OR (geo = 'FRM0' AND age = 'Y5')
+ OR (geo = 'FRY' AND age = 'Y5')
+ OR (geo = 'FRY1' AND age = 'Y5')
+ OR (geo = 'FRY2' AND age = 'Y5')
+ OR (geo = 'FRY3' AND age = 'Y5')
+ OR (geo = 'FRY4' AND age = 'Y5')
+ OR (geo = 'FRY5' AND age = 'Y5')
+ OR (geo = 'FRX' AND age = 'Y5')
+ OR (geo = 'FRXX' AND age = 'Y5')
+ OR (geo = 'HR' AND age = 'Y5')
+ OR (geo = 'HR0' AND age = 'Y5')
+ OR (geo = 'HR02' AND age = 'Y5')
+ OR (geo = 'HR03' AND age = 'Y5')
+ OR (geo = 'HR04' AND age = 'Y5')
+ OR (geo = 'HR05' AND age = 'Y5')
+ OR (geo = 'HR06' AND age = 'Y5')
+ OR (geo = 'IT' AND age = 'Y5')
+ OR (geo = 'ITC' AND age = 'Y5')
+ OR (geo = 'ITC1' AND age = 'Y5')
+ OR (geo = 'ITC2' AND age = 'Y5')
+ OR (geo = 'ITC3' AND age = 'Y5')
+ OR (geo = 'ITC4' AND age = 'Y5')
+ OR (geo = 'ITF' AND age = 'Y5')
+ OR (geo = 'ITF1' AND age = 'Y5')
+ OR (geo = 'ITF2' AND age = 'Y5')
+ OR (geo = 'ITF3' AND age = 'Y5')
+ OR (geo = 'ITF4' AND age = 'Y5')
+ OR (geo = 'ITF5' AND age = 'Y5')
+ OR (geo = 'ITF6' AND age = 'Y5')
+ OR (geo = 'ITG' AND age = 'Y5')
+ OR (geo = 'ITG1' AND age = 'Y5')
+ OR (geo = 'ITG2' AND age = 'Y5')
+ OR (geo = 'ITH' AND age = 'Y5')
+ OR (geo = 'ITH1' AND age = 'Y5')
+ OR (geo = 'ITH2' AND age = 'Y5')
+ OR (geo = 'ITH3' AND age = 'Y5')
+ OR (geo = 'ITH4' AND age = 'Y5')
+ OR (geo = 'ITH5' AND age = 'Y5')
+ OR (geo = 'ITI' AND age = 'Y5')
+ OR (geo = 'ITI1' AND age = 'Y5')
+ OR (geo = 'ITI2' AND age = 'Y5')
+ OR (geo = 'ITI3' AND age = 'Y5')
+ OR (geo = 'ITI4' AND age = 'Y5')
+ OR (geo = 'CY' AND age = 'Y5')
+ OR (geo = 'CY0' AND age = 'Y5')
+ OR (geo = 'CY00' AND age = 'Y5')
+ OR (geo = 'LV' AND age = 'Y5')
+ OR (geo = 'LV0' AND age = 'Y5')
+ OR (geo = 'LV00' AND age = 'Y5')
+ OR (geo = 'LT' AND age = 'Y5')
+ OR (geo = 'LT0' AND age = 'Y5')
+ OR (geo = 'LT01' AND age = 'Y5')
+ OR (geo = 'LT02' AND age = 'Y5')
+ OR (geo = 'LU' AND age = 'Y5')
+ OR (geo = 'LU0' AND age = 'Y5')
+ OR (geo = 'LU00' AND age = 'Y5')
+ OR (geo = 'HU' AND age = 'Y5')
+ OR (geo = 'HU1' AND age = 'Y5')
+ OR (geo = 'HU11' AND age = 'Y5')
+ OR (geo = 'HU12' AND age = 'Y5')
+ OR (geo = 'HU2' AND age = 'Y5')
+ OR (geo = 'HU21' AND age = 'Y5')
+ OR (geo = 'HU22' AND age = 'Y5')
+ OR (geo = 'HU23' AND age = 'Y5')
+ OR (geo = 'HU3' AND age = 'Y5')
+ OR (geo = 'HU31' AND age = 'Y5')
+ OR (geo = 'HU32' AND age = 'Y5')
+ OR (geo = 'HU33' AND age = 'Y5')
+ OR (geo = 'HUX' AND age = 'Y5')
+ OR (geo = 'HUXX' AND age = 'Y5')
+ OR (geo = 'MT' AND age = 'Y5')
+ OR (geo = 'MT0' AND age = 'Y5')
+ OR (geo = 'MT00' AND age = 'Y5')
+ OR (geo = 'NL' AND age = 'Y5')
+ OR (geo = 'NL1' AND age = 'Y5')
+ OR (geo = 'NL11' AND age = 'Y5')
+ OR (geo = 'NL12' AND age = 'Y5')
+ OR (geo = 'NL13' AND age = 'Y5')
+ OR (geo = 'NL2' AND age = 'Y5')
+ OR (geo = 'NL21' AND age = 'Y5')
+ OR (geo = 'NL22' AND age = 'Y5')
+ OR (geo = 'NL23' AND age = 'Y5')
+ OR (geo = 'NL3' AND age = 'Y5')
+ OR (geo = 'NL31' AND age = 'Y5')
+ OR (geo = 'NL32' AND age = 'Y5')
+ OR (geo = 'NL33' AND age = 'Y5')
+ OR (geo = 'NL34' AND age = 'Y5')
+ OR (geo = 'NL35' AND age = 'Y5')
+ OR (geo = 'NL36' AND age = 'Y5')
+ OR (geo = 'NL4' AND age = 'Y5')
+ OR (geo = 'NL41' AND age = 'Y5')
+ OR (geo = 'NL42' AND age = 'Y5')
+ OR (geo = 'AT' AND age = 'Y5')
+ OR (geo = 'AT1' AND age = 'Y5')
+ OR (geo = 'AT11' AND age = 'Y5')
+ OR (geo = 'AT12' AND age = 'Y5')
+ OR (geo = 'AT13' AND age = 'Y5')
+ OR (geo = 'AT2' AND age = 'Y5')
+ OR (geo = 'AT21' AND age = 'Y5')
+ OR (geo = 'AT22' AND age = 'Y5')
+ OR (geo = 'AT3' AND age = 'Y5')
+ OR (geo = 'AT31' AND age = 'Y5')
+ OR (geo = 'AT32' AND age = 'Y5')
+ OR (geo = 'AT33' AND age = 'Y5')
+ OR (geo = 'AT34' AND age = 'Y5')
+ OR (geo = 'PL' AND age = 'Y5')
+ OR (geo = 'PL2' AND age = 'Y5')
+ OR (geo = 'PL21' AND age = 'Y5')
+ OR (geo = 'PL22' AND age = 'Y5')
+ OR (geo = 'PL4' AND age = 'Y5')
+ OR (geo = 'PL41' AND age = 'Y5')
+ OR (geo = 'PL42' AND age = 'Y5')
+ OR (geo = 'PL43' AND age = 'Y5')
+ OR (geo = 'PL5' AND age = 'Y5')
+ OR (geo = 'PL51' AND age = 'Y5')
+ OR (geo = 'PL52' AND age = 'Y5')
+ OR (geo = 'PL6' AND age = 'Y5')
+ OR (geo = 'PL61' AND age = 'Y5')
+ OR (geo = 'PL62' AND age = 'Y5')
+ OR (geo = 'PL63' AND age = 'Y5')
+ OR (geo = 'PL7' AND age = 'Y5')
+ OR (geo = 'PL71' AND age = 'Y5')
+ OR (geo = 'PL72' AND age = 'Y5')
+ OR (geo = 'PL8' AND age = 'Y5')
+ OR (geo = 'PL81' AND age = 'Y5')
+ OR (geo = 'PL82' AND age = 'Y5')
+ OR (geo = 'PL84' AND age = 'Y5')
+ OR (geo = 'PL9' AND age = 'Y5')
+ OR (geo = 'PL91' AND age = 'Y5')
+ OR (geo = 'PL92' AND age = 'Y5')
+ OR (geo = 'PT' AND age = 'Y5')
+ OR (geo = 'PT1' AND age = 'Y5')
+ OR (geo = 'PT11' AND age = 'Y5')
+ OR (geo = 'PT15' AND age = 'Y5')
+ OR (geo = 'PT16' AND age = 'Y5')
+ OR (geo = 'PT17' AND age = 'Y5')
+ OR (geo = 'PT18' AND age = 'Y5')
+ OR (geo = 'PT19' AND age = 'Y5')
+ OR (geo = 'PT1A' AND age = 'Y5')
+ OR (geo = 'PT1B' AND age = 'Y5')
+ OR (geo = 'PT1C' AND age = 'Y5')
+ OR (geo = 'PT1D' AND age = 'Y5')
+ OR (geo = 'PT2' AND age = 'Y5')
+ OR (geo = 'PT20' AND age = 'Y5')
+ OR (geo = 'PT3' AND age = 'Y5')
+ OR (geo = 'PT30' AND age = 'Y5')
+ OR (geo = 'RO' AND age = 'Y5')
+ OR (geo = 'RO1' AND age = 'Y5')
+ OR (geo = 'RO11' AND age = 'Y5')
+ OR (geo = 'RO12' AND age = 'Y5')
+ OR (geo = 'RO2' AND age = 'Y5')
+ OR (geo = 'RO21' AND age = 'Y5')
+ OR (geo = 'RO22' AND age = 'Y5')
+ OR (geo = 'RO3' AND age = 'Y5')
+ OR (geo = 'RO31' AND age = 'Y5')
+ OR (geo = 'RO32' AND age = 'Y5')
+ OR (geo = 'RO4' AND age = 'Y5')
+ OR (geo = 'RO41' AND age = 'Y5')
+ OR (geo = 'RO42' AND age = 'Y5')
+ OR (geo = 'SI' AND age = 'Y5')
+ OR (geo = 'SI0' AND age = 'Y5')
+ OR (geo = 'SI03' AND age = 'Y5')
+ OR (geo = 'SI04' AND age = 'Y5')
+ OR (geo = 'SK' AND age = 'Y5')
+ OR (geo = 'SK0' AND age = 'Y5')
+ OR (geo = 'SK01' AND age = 'Y5')
+ OR (geo = 'SK02' AND age = 'Y5')
+ OR (geo = 'SK03' AND age = 'Y5')
+ OR (geo = 'SK04' AND age = 'Y5')
+ OR (geo = 'FI' AND age = 'Y5')
+ OR (geo = 'FI1' AND age = 'Y5')
+ OR (geo = 'FI19' AND age = 'Y5')
+ OR (geo = 'FI1B' AND age = 'Y5')
+ OR (geo = 'FI1C' AND age = 'Y5')
+ OR (geo = 'FI1D' AND age = 'Y5')
+ OR (geo = 'FI2' AND age = 'Y5')
+ OR (geo = 'FI20' AND age = 'Y5')
+ OR (geo = 'SE' AND age = 'Y5')
+ OR (geo = 'SE1' AND age = 'Y5')
+ OR (geo = 'SE11' AND age = 'Y5')
+ OR (geo = 'SE12' AND age = 'Y5')
+ OR (geo = 'SE2' AND age = 'Y5')
+ OR (geo = 'SE21' AND age = 'Y5')
+ OR (geo = 'SE22' AND age = 'Y5')
+ OR (geo = 'SE23' AND age = 'Y5')
+ OR (geo = 'SE3' AND age = 'Y5')
+ OR (geo = 'SE31' AND age = 'Y5')
+ OR (geo = 'SE32' AND age = 'Y5')
+ OR (geo = 'SE33' AND age = 'Y5')
+ OR (geo = 'EFTA' AND age = 'Y5')
+ OR (geo = 'IS' AND age = 'Y5')
+ OR (geo = 'IS0' AND age = 'Y5')
+ OR (geo = 'IS00' AND age = 'Y5')
+ OR (geo = 'LI' AND age = 'Y5')
+ OR (geo = 'LI0' AND age = 'Y5')
+ OR (geo = 'LI00' AND age = 'Y5')
+ OR (geo = 'NO' AND age = 'Y5')
+ OR (geo = 'NO0' AND age = 'Y5')
+ OR (geo = 'NO01' AND age = 'Y5')
+ OR (geo = 'NO02' AND age = 'Y5')
+ OR (geo = 'NO03' AND age = 'Y5')
+ OR (geo = 'NO04' AND age = 'Y5')
+ OR (geo = 'NO05' AND age = 'Y5')
+ OR (geo = 'NO06' AND age = 'Y5')
+ OR (geo = 'NO07' AND age = 'Y5')
+ OR (geo = 'NO08' AND age = 'Y5')
+ OR (geo = 'NO09' AND age = 'Y5')
+ OR (geo = 'NO0A' AND age = 'Y5')
+ OR (geo = 'NO0B' AND age = 'Y5')
+ OR (geo = 'CH' AND age = 'Y5')
+ OR (geo = 'CH0' AND age = 'Y5')
+ OR (geo = 'CH01' AND age = 'Y5')
+ OR (geo = 'CH02' AND age = 'Y5')
+ OR (geo = 'CH03' AND age = 'Y5')
+ OR (geo = 'CH04' AND age = 'Y5')
+ OR (geo = 'CH05' AND age = 'Y5')
+ OR (geo = 'CH06' AND age = 'Y5')
+ OR (geo = 'CH07' AND age = 'Y5')
+ OR (geo = 'UK' AND age = 'Y5')
+ OR (geo = 'UKC' AND age = 'Y5')
+ OR (geo = 'UKC1' AND age = 'Y5')
+ OR (geo = 'UKC2' AND age = 'Y5')
+ OR (geo = 'UKD' AND age = 'Y5')
+ OR (geo = 'UKD1' AND age = 'Y5')
+ OR (geo = 'UKD3' AND age = 'Y5')
+ OR (geo = 'UKD4' AND age = 'Y5')
+ OR (geo = 'UKD6' AND age = 'Y5')
+ OR (geo = 'UKD7' AND age = 'Y5')
+ OR (geo = 'UKE' AND age = 'Y5')
+ OR (geo = 'UKE1' AND age = 'Y5')
+ OR (geo = 'UKE2' AND age = 'Y5')
+ OR (geo = 'UKE3' AND age = 'Y5')
+ OR (geo = 'UKE4' AND age = 'Y5')
+ OR (geo = 'UKF' AND age = 'Y5')
+ OR (geo = 'UKF1' AND age = 'Y5')
+ OR (geo = 'UKF2' AND age = 'Y5')
+ OR (geo = 'UKF3' AND age = 'Y5')
+ OR (geo = 'UKG' AND age = 'Y5')
+ OR (geo = 'UKG1' AND age = 'Y5')
+ OR (geo = 'UKG2' AND age = 'Y5')
+ OR (geo = 'UKG3' AND age = 'Y5')
+ OR (geo = 'UKH' AND age = 'Y5')
+ OR (geo = 'UKH1' AND age = 'Y5')
+ OR (geo = 'UKH2' AND age = 'Y5')
+ OR (geo = 'UKH3' AND age = 'Y5')
+ OR (geo = 'UKI' AND age = 'Y5')
+ OR (geo = 'UKI3' AND age = 'Y5')
+ OR (geo = 'UKI4' AND age = 'Y5')
+ OR (geo = 'UKI5' AND age = 'Y5')
+ OR (geo = 'UKI6' AND age = 'Y5')
+ OR (geo = 'UKI7' AND age = 'Y5')
+ OR (geo = 'UKJ' AND age = 'Y5')
+ OR (geo = 'UKJ1' AND age = 'Y5')
+ OR (geo = 'UKJ2' AND age = 'Y5')
+ OR (geo = 'UKJ3' AND age = 'Y5')
+ OR (geo = 'UKJ4' AND age = 'Y5')
+ OR (geo = 'UKK' AND age = 'Y5')
+ OR (geo = 'UKK1' AND age = 'Y5')
+ OR (geo = 'UKK2' AND age = 'Y5')
+ OR (geo = 'UKK3' AND age = 'Y5')
+ OR (geo = 'UKK4' AND age = 'Y5')
+ OR (geo = 'UKL' AND age = 'Y5')
+ OR (geo = 'UKL1' AND age = 'Y5')
+ OR (geo = 'UKL2' AND age = 'Y5')
+ OR (geo = 'UKM' AND age = 'Y5')
+ OR (geo = 'UKM5' AND age = 'Y5')
+ OR (geo = 'UKM6' AND age = 'Y5')
+ OR (geo = 'UKM7' AND age = 'Y5')
+ OR (geo = 'UKM8' AND age = 'Y5')
+ OR (geo = 'UKM9' AND age = 'Y5')
+ OR (geo = 'UKN' AND age = 'Y5')
+ OR (geo = 'UKN0' AND age = 'Y5')
+ OR (geo = 'ME' AND age = 'Y5')
+ OR (geo = 'ME0' AND age = 'Y5')
+ OR (geo = 'ME00' AND age = 'Y5')
+ OR (geo = 'MK' AND age = 'Y5')
+ OR (geo = 'MK0' AND age = 'Y5')
+ OR (geo = 'MK00' AND age = 'Y5')
+ OR (geo = 'MKX' AND age = 'Y5')
+ OR (geo = 'MKXX' AND age = 'Y5')
+ OR (geo = 'AL' AND age = 'Y5')
+ OR (geo = 'AL0' AND age = 'Y5')
+ OR (geo = 'AL01' AND age = 'Y5')
+ OR (geo = 'AL02' AND age = 'Y5')
+ OR (geo = 'AL03' AND age = 'Y5')
+ OR (geo = 'ALX' AND age = 'Y5')
+ OR (geo = 'ALXX' AND age = 'Y5')
+ OR (geo = 'RS' AND age = 'Y5')
+ OR (geo = 'RS1' AND age = 'Y5')
+ OR (geo = 'RS11' AND age = 'Y5')
+ OR (geo = 'RS12' AND age = 'Y5')
+ OR (geo = 'RS2' AND age = 'Y5')
+ OR (geo = 'RS21' AND age = 'Y5')
+ OR (geo = 'RS22' AND age = 'Y5')
+ OR (geo = 'TR' AND age = 'Y5')
+ OR (geo = 'TR1' AND age = 'Y5')
+ OR (geo = 'TR10' AND age = 'Y5')
+ OR (geo = 'TR2' AND age = 'Y5')
+ OR (geo = 'TR21' AND age = 'Y5')
+ OR (geo = 'TR22' AND age = 'Y5')
+ OR (geo = 'TR3' AND age = 'Y5')
+ OR (geo = 'TR31' AND age = 'Y5')
+ OR (geo = 'TR32' AND age = 'Y5')
+ OR (geo = 'TR33' AND age = 'Y5')
+ OR (geo = 'TR4' AND age = 'Y5')
+ OR (geo = 'TR41' AND age = 'Y5')
+ OR (geo = 'TR42' AND age = 'Y5')
+ OR (geo = 'TR5' AND age = 'Y5')
+ OR (geo = 'TR51' AND age = 'Y5')
+ OR (geo = 'TR52' AND age = 'Y5')
+ OR (geo = 'TR6' AND age = 'Y5')
+ OR (geo = 'TR61' AND age = 'Y5')
+ OR (geo = 'TR62' AND age = 'Y5')
+ OR (geo = 'TR63' AND age = 'Y5')
+ OR (geo = 'TR7' AND age = 'Y5')
+ OR (geo = 'TR71' AND age = 'Y5')
+ OR (geo = 'TR72' AND age = 'Y5')
+ OR (geo = 'TR8' AND age = 'Y5')
+ OR (geo = 'TR81' AND age = 'Y5')
+ OR (geo = 'TR82' AND age = 'Y5')
+ OR (geo = 'TR83' AND age = 'Y5')
+ OR (geo = 'TR9' AND age = 'Y5')
+ OR (geo = 'TR90' AND age = 'Y5')
+ OR (geo = 'TRA' AND age = 'Y5')
+ OR (geo = 'TRA1' AND age = 'Y5')
+ OR (geo = 'TRA2' AND age = 'Y5')
+ OR (geo = 'TRB' AND age = 'Y5')
+ OR (geo = 'TRB1' AND age = 'Y5')
+ OR (geo = 'TRB2' AND age = 'Y5')
+ OR (geo = 'TRC' AND age = 'Y5')
+ OR (geo = 'TRC1' AND age = 'Y5')
+ OR (geo = 'TRC2' AND age = 'Y5')
+ OR (geo = 'TRC3' AND age = 'Y5')
+ OR (geo = 'EU27_2020' AND age = 'Y6')
+ OR (geo = 'EU28' AND age = 'Y6')
+ OR (geo = 'EU27_2007' AND age = 'Y6')
+ OR (geo = 'BE' AND age = 'Y6')
+ OR (geo = 'BE1' AND age = 'Y6')
+ OR (geo = 'BE10' AND age = 'Y6')
+ OR (geo = 'BE2' AND age = 'Y6')
+ OR (geo = 'BE21' AND age = 'Y6')
+ OR (geo = 'BE22' AND age = 'Y6')
+ OR (geo = 'BE23' AND age = 'Y6')
+ OR (geo = 'BE24' AND age = 'Y6')
+ OR (geo = 'BE25' AND age = 'Y6')
+ OR (geo = 'BE3' AND age = 'Y6')
+ OR (geo = 'BE31' AND age = 'Y6')
+ OR (geo = 'BE32' AND age = 'Y6')
+ OR (geo = 'BE33' AND age = 'Y6')
+ OR (geo = 'BE34' AND age = 'Y6')
+ OR (geo = 'BE35' AND age = 'Y6')
+ OR (geo = 'BG' AND age = 'Y6')
+ OR (geo = 'BG3' AND age = 'Y6')
+ OR (geo = 'BG31' AND age = 'Y6')
+ OR (geo = 'BG32' AND age = 'Y6')
+ OR (geo = 'BG33' AND age = 'Y6')
+ OR (geo = 'BG34' AND age = 'Y6')
+ OR (geo = 'BG4' AND age = 'Y6')
+ OR (geo = 'BG41' AND age = 'Y6')
+ OR (geo = 'BG42' AND age = 'Y6')
+ OR (geo = 'CZ' AND age = 'Y6')
+ OR (geo = 'CZ0' AND age = 'Y6')
+ OR (geo = 'CZ01' AND age = 'Y6')
+ OR (geo = 'CZ02' AND age = 'Y6')
+ OR (geo = 'CZ03' AND age = 'Y6')
+ OR (geo = 'CZ04' AND age = 'Y6')
+ OR (geo = 'CZ05' AND age = 'Y6')
+ OR (geo = 'CZ06' AND age = 'Y6')
+ OR (geo = 'CZ07' AND age = 'Y6')
+ OR (geo = 'CZ08' AND age = 'Y6')
+ OR (geo = 'DK' AND age = 'Y6')
+ OR (geo = 'DK0' AND age = 'Y6')
+ OR (geo = 'DK01' AND age = 'Y6')
+ OR (geo = 'DK02' AND age = 'Y6')
+ OR (geo = 'DK03' AND age = 'Y6')
+ OR (geo = 'DK04' AND age = 'Y6')
+ OR (geo = 'DK05' AND age = 'Y6')
+ OR (geo = 'DE' AND age = 'Y6')
+ OR (geo = 'DE_TOT' AND age = 'Y6')
+ OR (geo = 'DE1' AND age = 'Y6')
+ OR (geo = 'DE11' AND age = 'Y6')
+ OR (geo = 'DE12' AND age = 'Y6')
+ OR (geo = 'DE13' AND age = 'Y6')
+ OR (geo = 'DE14' AND age = 'Y6')
+ OR (geo = 'DE2' AND age = 'Y6')
+ OR (geo = 'DE21' AND age = 'Y6')
+ OR (geo = 'DE22' AND age = 'Y6')
+ OR (geo = 'DE23' AND age = 'Y6')
+ OR (geo = 'DE24' AND age = 'Y6')
+ OR (geo = 'DE25' AND age = 'Y6')
+ OR (geo = 'DE26' AND age = 'Y6')
+ OR (geo = 'DE27' AND age = 'Y6')
+ OR (geo = 'DE3' AND age = 'Y6')
+ OR (geo = 'DE30' AND age = 'Y6')
+ OR (geo = 'DE4' AND age = 'Y6')
+ OR (geo = 'DE40' AND age = 'Y6')
+ OR (geo = 'DE5' AND age = 'Y6')
+ OR (geo = 'DE50' AND age = 'Y6')
+ OR (geo = 'DE6' AND age = 'Y6')
+ OR (geo = 'DE60' AND age = 'Y6')
+ OR (geo = 'DE7' AND age = 'Y6')
+ OR (geo = 'DE71' AND age = 'Y6')
+ OR (geo = 'DE72' AND age = 'Y6')
+ OR (geo = 'DE73' AND age = 'Y6')
+ OR (geo = 'DE8' AND age = 'Y6')
+ OR (geo = 'DE80' AND age = 'Y6')
+ OR (geo = 'DE9' AND age = 'Y6')
+ OR (geo = 'DE91' AND age = 'Y6')
+ OR (geo = 'DE92' AND age = 'Y6')
+ OR (geo = 'DE93' AND age = 'Y6')
+ OR (geo = 'DE94' AND age = 'Y6')
+ OR (geo = 'DEA' AND age = 'Y6')
+ OR (geo = 'DEA1' AND age = 'Y6')
+ OR (geo = 'DEA2' AND age = 'Y6')
+ OR (geo = 'DEA3' AND age = 'Y6')
+ OR (geo = 'DEA4' AND age = 'Y6')
+ OR (geo = 'DEA5' AND age = 'Y6')
+ OR (geo = 'DEB' AND age = 'Y6')
+ OR (geo = 'DEB1' AND age = 'Y6')
+ OR (geo = 'DEB2' AND age = 'Y6')
+ OR (geo = 'DEB3' AND age = 'Y6')
+ OR (geo = 'DEC' AND age = 'Y6')
+ OR (geo = 'DEC0' AND age = 'Y6')
+ OR (geo = 'DED' AND age = 'Y6')
+ OR (geo = 'DED2' AND age = 'Y6')
+ OR (geo = 'DED4' AND age = 'Y6')
+ OR (geo = 'DED5' AND age = 'Y6')
+ OR (geo = 'DEE' AND age = 'Y6')
+ OR (geo = 'DEE0' AND age = 'Y6')
+ OR (geo = 'DEF' AND age = 'Y6')
+ OR (geo = 'DEF0' AND age = 'Y6')
+ OR (geo = 'DEG' AND age = 'Y6')
+ OR (geo = 'DEG0' AND age = 'Y6')
+ OR (geo = 'EE' AND age = 'Y6')
+ OR (geo = 'EE0' AND age = 'Y6')
+ OR (geo = 'EE00' AND age = 'Y6')
+ OR (geo = 'IE' AND age = 'Y6')
+ OR (geo = 'IE0' AND age = 'Y6')
+ OR (geo = 'IE04' AND age = 'Y6')
+ OR (geo = 'IE05' AND age = 'Y6')
+ OR (geo = 'IE06' AND age = 'Y6')
+ OR (geo = 'EL' AND age = 'Y6')
+ OR (geo = 'EL3' AND age = 'Y6')
+ OR (geo = 'EL30' AND age = 'Y6')
+ OR (geo = 'EL4' AND age = 'Y6')
+ OR (geo = 'EL41' AND age = 'Y6')
+ OR (geo = 'EL42' AND age = 'Y6')
+ OR (geo = 'EL43' AND age = 'Y6')
+ OR (geo = 'EL5' AND age = 'Y6')
+ OR (geo = 'EL51' AND age = 'Y6')
+ OR (geo = 'EL52' AND age = 'Y6')
+ OR (geo = 'EL53' AND age = 'Y6')
+ OR (geo = 'EL54' AND age = 'Y6')
+ OR (geo = 'EL6' AND age = 'Y6')
+ OR (geo = 'EL61' AND age = 'Y6')
+ OR (geo = 'EL62' AND age = 'Y6')
+ OR (geo = 'EL63' AND age = 'Y6')
+ OR (geo = 'EL64' AND age = 'Y6')
+ OR (geo = 'EL65' AND age = 'Y6')
+ OR (geo = 'ES' AND age = 'Y6')
+ OR (geo = 'ES1' AND age = 'Y6')
+ OR (geo = 'ES11' AND age = 'Y6')
+ OR (geo = 'ES12' AND age = 'Y6')
+ OR (geo = 'ES13' AND age = 'Y6')
+ OR (geo = 'ES2' AND age = 'Y6')
+ OR (geo = 'ES21' AND age = 'Y6')
+ OR (geo = 'ES22' AND age = 'Y6')
+ OR (geo = 'ES23' AND age = 'Y6')
+ OR (geo = 'ES24' AND age = 'Y6')
+ OR (geo = 'ES3' AND age = 'Y6')
+ OR (geo = 'ES30' AND age = 'Y6')
+ OR (geo = 'ES4' AND age = 'Y6')
+ OR (geo = 'ES41' AND age = 'Y6')
+ OR (geo = 'ES42' AND age = 'Y6')
+ OR (geo = 'ES43' AND age = 'Y6')
+ OR (geo = 'ES5' AND age = 'Y6')
+ OR (geo = 'ES51' AND age = 'Y6')
+ OR (geo = 'ES52' AND age = 'Y6')
+ OR (geo = 'ES53' AND age = 'Y6')
+ OR (geo = 'ES6' AND age = 'Y6')
+ OR (geo = 'ES61' AND age = 'Y6')
+ OR (geo = 'ES62' AND age = 'Y6')
+ OR (geo = 'ES63' AND age = 'Y6')
+ OR (geo = 'ES64' AND age = 'Y6')
+ OR (geo = 'ES7' AND age = 'Y6')
+ OR (geo = 'ES70' AND age = 'Y6')
+ OR (geo = 'FR' AND age = 'Y6')
+ OR (geo = 'FR1' AND age = 'Y6')
+ OR (geo = 'FR10' AND age = 'Y6')
+ OR (geo = 'FRB' AND age = 'Y6')
+ OR (geo = 'FRB0' AND age = 'Y6')
+ OR (geo = 'FRC' AND age = 'Y6')
+ OR (geo = 'FRC1' AND age = 'Y6')
+ OR (geo = 'FRC2' AND age = 'Y6')
+ OR (geo = 'FRD' AND age = 'Y6')
+ OR (geo = 'FRD1' AND age = 'Y6')
+ OR (geo = 'FRD2' AND age = 'Y6')
+ OR (geo = 'FRE' AND age = 'Y6')
+ OR (geo = 'FRE1' AND age = 'Y6')
+ OR (geo = 'FRE2' AND age = 'Y6')
+ OR (geo = 'FRF' AND age = 'Y6')
+ OR (geo = 'FRF1' AND age = 'Y6')
+ OR (geo = 'FRF2' AND age = 'Y6')
+ OR (geo = 'FRF3' AND age = 'Y6')
+ OR (geo = 'FRG' AND age = 'Y6')
+ OR (geo = 'FRG0' AND age = 'Y6')
+ OR (geo = 'FRH' AND age = 'Y6')
+ OR (geo = 'FRH0' AND age = 'Y6')
+ OR (geo = 'FRI' AND age = 'Y6')
+ OR (geo = 'FRI1' AND age = 'Y6')
+ OR (geo = 'FRI2' AND age = 'Y6')
+ OR (geo = 'FRI3' AND age = 'Y6')
+ OR (geo = 'FRJ' AND age = 'Y6')
+ OR (geo = 'FRJ1' AND age = 'Y6')
+ OR (geo = 'FRJ2' AND age = 'Y6')
+ OR (geo = 'FRK' AND age = 'Y6')
+ OR (geo = 'FRK1' AND age = 'Y6')
+ OR (geo = 'FRK2' AND age = 'Y6')
+ OR (geo = 'FRL' AND age = 'Y6')
+ OR (geo = 'FRL0' AND age = 'Y6')
+ OR (geo = 'FRM' AND age = 'Y6')
+ OR (geo = 'FRM0' AND age = 'Y6')
+ OR (geo = 'FRY' AND age = 'Y6')
+ OR (geo = 'FRY1' AND age = 'Y6')
+ OR (geo = 'FRY2' AND age = 'Y6')
+ OR (geo = 'FRY3' AND age = 'Y6')
+ OR (geo = 'FRY4' AND age = 'Y6')
+ OR (geo = 'FRY5' AND age = 'Y6')
+ OR (geo = 'FRX' AND age = 'Y6')
+ OR (geo = 'FRXX' AND age = 'Y6')
+ OR (geo = 'HR' AND age = 'Y6')
+ OR (geo = 'HR0' AND age = 'Y6')
+ OR (geo = 'HR02' AND age = 'Y6')
+ OR (geo = 'HR03' AND age = 'Y6')
+ OR (geo = 'HR04' AND age = 'Y6')
+ OR (geo = 'HR05' AND age = 'Y6')
+ OR (geo = 'HR06' AND age = 'Y6')
+ OR (geo = 'IT' AND age = 'Y6')
+ OR (geo = 'ITC' AND age = 'Y6')
+ OR (geo = 'ITC1' AND age = 'Y6')
+ OR (geo = 'ITC2' AND age = 'Y6')
+ OR (geo = 'ITC3' AND age = 'Y6')
+ OR (geo = 'ITC4' AND age = 'Y6')
+ OR (geo = 'ITF' AND age = 'Y6')
+ OR (geo = 'ITF1' AND age = 'Y6')
+ OR (geo = 'ITF2' AND age = 'Y6')
+ OR (geo = 'ITF3' AND age = 'Y6')
+ OR (geo = 'ITF4' AND age = 'Y6')
+ OR (geo = 'ITF5' AND age = 'Y6')
+ OR (geo = 'ITF6' AND age = 'Y6')
+ OR (geo = 'ITG' AND age = 'Y6')
+ OR (geo = 'ITG1' AND age = 'Y6')
+ OR (geo = 'ITG2' AND age = 'Y6')
+ OR (geo = 'ITH' AND age = 'Y6')
+ OR (geo = 'ITH1' AND age = 'Y6')
+ OR (geo = 'ITH2' AND age = 'Y6')
+ OR (geo = 'ITH3' AND age = 'Y6')
+ OR (geo = 'ITH4' AND age = 'Y6')
+ OR (geo = 'ITH5' AND age = 'Y6')
+ OR (geo = 'ITI' AND age = 'Y6')
+ OR (geo = 'ITI1' AND age = 'Y6')
+ OR (geo = 'ITI2' AND age = 'Y6')
+ OR (geo = 'ITI3' AND age = 'Y6')
+ OR (geo = 'ITI4' AND age = 'Y6')
+ OR (geo = 'CY' AND age = 'Y6')
+ OR (geo = 'CY0' AND age = 'Y6')
+ OR (geo = 'CY00' AND age = 'Y6')
+ OR (geo = 'LV' AND age = 'Y6')
+ OR (geo = 'LV0' AND age = 'Y6')
+ OR (geo = 'LV00' AND age = 'Y6')
+ OR (geo = 'LT' AND age = 'Y6')
+ OR (geo = 'LT0' AND age = 'Y6')
+ OR (geo = 'LT01' AND age = 'Y6')
+ OR (geo = 'LT02' AND age = 'Y6')
+ OR (geo = 'LU' AND age = 'Y6')
+ OR (geo = 'LU0' AND age = 'Y6')
+ OR (geo = 'LU00' AND age = 'Y6')
+ OR (geo = 'HU' AND age = 'Y6')
+ OR (geo = 'HU1' AND age = 'Y6')
+ OR (geo = 'HU11' AND age = 'Y6')
+ OR (geo = 'HU12' AND age = 'Y6')
+ OR (geo = 'HU2' AND age = 'Y6')
+ OR (geo = 'HU21' AND age = 'Y6')
+ OR (geo = 'HU22' AND age = 'Y6')
+ OR (geo = 'HU23' AND age = 'Y6')
+ OR (geo = 'HU3' AND age = 'Y6')
+ OR (geo = 'HU31' AND age = 'Y6')
+ OR (geo = 'HU32' AND age = 'Y6')
+ OR (geo = 'HU33' AND age = 'Y6')
+ OR (geo = 'HUX' AND age = 'Y6')
+ OR (geo = 'HUXX' AND age = 'Y6')
+ OR (geo = 'MT' AND age = 'Y6')
+ OR (geo = 'MT0' AND age = 'Y6')
+ OR (geo = 'MT00' AND age = 'Y6')
+ OR (geo = 'NL' AND age = 'Y6')
+ OR (geo = 'NL1' AND age = 'Y6')
+ OR (geo = 'NL11' AND age = 'Y6')
+ OR (geo = 'NL12' AND age = 'Y6')
+ OR (geo = 'NL13' AND age = 'Y6')
+ OR (geo = 'NL2' AND age = 'Y6')
+ OR (geo = 'NL21' AND age = 'Y6')
+ OR (geo = 'NL22' AND age = 'Y6')
+ OR (geo = 'NL23' AND age = 'Y6')
+ OR (geo = 'NL3' AND age = 'Y6')
+ OR (geo = 'NL31' AND age = 'Y6')
+ OR (geo = 'NL32' AND age = 'Y6')
+ OR (geo = 'NL33' AND age = 'Y6')
+ OR (geo = 'NL34' AND age = 'Y6')
+ OR (geo = 'NL35' AND age = 'Y6')
+ OR (geo = 'NL36' AND age = 'Y6')
+ OR (geo = 'NL4' AND age = 'Y6')
+ OR (geo = 'NL41' AND age = 'Y6')
+ OR (geo = 'NL42' AND age = 'Y6')
+ OR (geo = 'AT' AND age = 'Y6')
+ OR (geo = 'AT1' AND age = 'Y6')
+ OR (geo = 'AT11' AND age = 'Y6')
+ OR (geo = 'AT12' AND age = 'Y6')
+ OR (geo = 'AT13' AND age = 'Y6')
+ OR (geo = 'AT2' AND age = 'Y6')
+ OR (geo = 'AT21' AND age = 'Y6')
+ OR (geo = 'AT22' AND age = 'Y6')
+ OR (geo = 'AT3' AND age = 'Y6')
+ OR (geo = 'AT31' AND age = 'Y6')
+ OR (geo = 'AT32' AND age = 'Y6')
+ OR (geo = 'AT33' AND age = 'Y6')
+ OR (geo = 'AT34' AND age = 'Y6')
+ OR (geo = 'PL' AND age = 'Y6')
+ OR (geo = 'PL2' AND age = 'Y6')
+ OR (geo = 'PL21' AND age = 'Y6')
+ OR (geo = 'PL22' AND age = 'Y6')
+ OR (geo = 'PL4' AND age = 'Y6')
+ OR (geo = 'PL41' AND age = 'Y6')
+ OR (geo = 'PL42' AND age = 'Y6')
+ OR (geo = 'PL43' AND age = 'Y6')
+ OR (geo = 'PL5' AND age = 'Y6')
+ OR (geo = 'PL51' AND age = 'Y6')
+ OR (geo = 'PL52' AND age = 'Y6')
+ OR (geo = 'PL6' AND age = 'Y6')
+ OR (geo = 'PL61' AND age = 'Y6')
+ OR (geo = 'PL62' AND age = 'Y6')
+ OR (geo = 'PL63' AND age = 'Y6')
+ OR (geo = 'PL7' AND age = 'Y6')
+ OR (geo = 'PL71' AND age = 'Y6')
+ OR (geo = 'PL72' AND age = 'Y6')
+ OR (geo = 'PL8' AND age = 'Y6')
+ OR (geo = 'PL81' AND age = 'Y6')
+ OR (geo = 'PL82' AND age = 'Y6')
+ OR (geo = 'PL84' AND age = 'Y6')
+ OR (geo = 'PL9' AND age = 'Y6')
+ OR (geo = 'PL91' AND age = 'Y6')
+ OR (geo = 'PL92' AND age = 'Y6')
+ OR (geo = 'PT' AND age = 'Y6')
+ OR (geo = 'PT1' AND age = 'Y6')
+ OR (geo = 'PT11' AND age = 'Y6')
+ OR (geo = 'PT15' AND age = 'Y6')
+ OR (geo = 'PT16' AND age = 'Y6')
+ OR (geo = 'PT17' AND age = 'Y6')
+ OR (geo = 'PT18' AND age = 'Y6')
+ OR (geo = 'PT19' AND age = 'Y6')
+ OR (geo = 'PT1A' AND age = 'Y6')
+ OR (geo = 'PT1B' AND age = 'Y6')
+ OR (geo = 'PT1C' AND age = 'Y6')
+ OR (geo = 'PT1D' AND age = 'Y6')
+ OR (geo = 'PT2' AND age = 'Y6')
+ OR (geo = 'PT20' AND age = 'Y6')
+ OR (geo = 'PT3' AND age = 'Y6')
+ OR (geo = 'PT30' AND age = 'Y6')
+ OR (geo = 'RO' AND age = 'Y6')
+ OR (geo = 'RO1' AND age = 'Y6')
+ OR (geo = 'RO11' AND age = 'Y6')
+ OR (geo = 'RO12' AND age = 'Y6')
+ OR (geo = 'RO2' AND age = 'Y6')
+ OR (geo = 'RO21' AND age = 'Y6')
+ OR (geo = 'RO22' AND age = 'Y6')
+ OR (geo = 'RO3' AND age = 'Y6')
+ OR (geo = 'RO31' AND age = 'Y6')
+ OR (geo = 'RO32' AND age = 'Y6')
+ OR (geo = 'RO4' AND age = 'Y6')
+ OR (geo = 'RO41' AND age = 'Y6')
+ OR (geo = 'RO42' AND age = 'Y6')
+ OR (geo = 'SI' AND age = 'Y6')
+ OR (geo = 'SI0' AND age = 'Y6')
+ OR (geo = 'SI03' AND age = 'Y6')
+ OR (geo = 'SI04' AND age = 'Y6')
+ OR (geo = 'SK' AND age = 'Y6')
+ OR (geo = 'SK0' AND age = 'Y6')
+ OR (geo = 'SK01' AND age = 'Y6')
+ OR (geo = 'SK02' AND age = 'Y6')
+ OR (geo = 'SK03' AND age = 'Y6')
+ OR (geo = 'SK04' AND age = 'Y6')
+ OR (geo = 'FI' AND age = 'Y6')
+ OR (geo = 'FI1' AND age = 'Y6')
+ OR (geo = 'FI19' AND age = 'Y6')
+ OR (geo = 'FI1B' AND age = 'Y6')
+ OR (geo = 'FI1C' AND age = 'Y6')
+ OR (geo = 'FI1D' AND age = 'Y6')
+ OR (geo = 'FI2' AND age = 'Y6')
+ OR (geo = 'FI20' AND age = 'Y6')
+ OR (geo = 'SE' AND age = 'Y6')
+ OR (geo = 'SE1' AND age = 'Y6')
+ OR (geo = 'SE11' AND age = 'Y6')
+ OR (geo = 'SE12' AND age = 'Y6')
+ OR (geo = 'SE2' AND age = 'Y6')
+ OR (geo = 'SE21' AND age = 'Y6')
+ OR (geo = 'SE22' AND age = 'Y6')
+ OR (geo = 'SE23' AND age = 'Y6')
+ OR (geo = 'SE3' AND age = 'Y6')
+ OR (geo = 'SE31' AND age = 'Y6')
+ OR (geo = 'SE32' AND age = 'Y6')
+ OR (geo = 'SE33' AND age = 'Y6')
+ OR (geo = 'EFTA' AND age = 'Y6')
+ OR (geo = 'IS' AND age = 'Y6')
+ OR (geo = 'IS0' AND age = 'Y6')
+ OR (geo = 'IS00' AND age = 'Y6')
+ OR (geo = 'LI' AND age = 'Y6')
+ OR (geo = 'LI0' AND age = 'Y6')
+ OR (geo = 'LI00' AND age = 'Y6')
+ OR (geo = 'NO' AND age = 'Y6')
+ OR (geo = 'NO0' AND age = 'Y6')
+ OR (geo = 'NO01' AND age = 'Y6')
+ OR (geo = 'NO02' AND age = 'Y6')
+ OR (geo = 'NO03' AND age = 'Y6')
+ OR (geo = 'NO04' AND age = 'Y6')
+ OR (geo = 'NO05' AND age = 'Y6')
+ OR (geo = 'NO06' AND age = 'Y6')
+ OR (geo = 'NO07' AND age = 'Y6')
+ OR (geo = 'NO08' AND age = 'Y6')
+ OR (geo = 'NO09' AND age = 'Y6')
+ OR (geo = 'NO0A' AND age = 'Y6')
+ OR (geo = 'NO0B' AND age = 'Y6')
+ OR (geo = 'CH' AND age = 'Y6')
+ OR (geo = 'CH0' AND age = 'Y6')
+ OR (geo = 'CH01' AND age = 'Y6')
+ OR (geo = 'CH02' AND age = 'Y6')
+ OR (geo = 'CH03' AND age = 'Y6')
+ OR (geo = 'CH04' AND age = 'Y6')
+ OR (geo = 'CH05' AND age = 'Y6')
+ OR (geo = 'CH06' AND age = 'Y6')
+ OR (geo = 'CH07' AND age = 'Y6')
+ OR (geo = 'UK' AND age = 'Y6')
+ OR (geo = 'UKC' AND age = 'Y6')
+ OR (geo = 'UKC1' AND age = 'Y6')
+ OR (geo = 'UKC2' AND age = 'Y6')
+ OR (geo = 'UKD' AND age = 'Y6')
+ OR (geo = 'UKD1' AND age = 'Y6')
+ OR (geo = 'UKD3' AND age = 'Y6')
+ OR (geo = 'UKD4' AND age = 'Y6')
+ OR (geo = 'UKD6' AND age = 'Y6')
+ OR (geo = 'UKD7' AND age = 'Y6')
+ OR (geo = 'UKE' AND age = 'Y6')
+ OR (geo = 'UKE1' AND age = 'Y6')
+ OR (geo = 'UKE2' AND age = 'Y6')
+ OR (geo = 'UKE3' AND age = 'Y6')
+ OR (geo = 'UKE4' AND age = 'Y6')
+ OR (geo = 'UKF' AND age = 'Y6')
+ OR (geo = 'UKF1' AND age = 'Y6')
+ OR (geo = 'UKF2' AND age = 'Y6')
+ OR (geo = 'UKF3' AND age = 'Y6')
+ OR (geo = 'UKG' AND age = 'Y6')
+ OR (geo = 'UKG1' AND age = 'Y6')
+ OR (geo = 'UKG2' AND age = 'Y6')
+ OR (geo = 'UKG3' AND age = 'Y6')
+ OR (geo = 'UKH' AND age = 'Y6')
+ OR (geo = 'UKH1' AND age = 'Y6')
+ OR (geo = 'UKH2' AND age = 'Y6')
+ OR (geo = 'UKH3' AND age = 'Y6')
+ OR (geo = 'UKI' AND age = 'Y6')
+ OR (geo = 'UKI3' AND age = 'Y6')
+ OR (geo = 'UKI4' AND age = 'Y6')
+ OR (geo = 'UKI5' AND age = 'Y6')
+ OR (geo = 'UKI6' AND age = 'Y6')
+ OR (geo = 'UKI7' AND age = 'Y6')
+ OR (geo = 'UKJ' AND age = 'Y6')
+ OR (geo = 'UKJ1' AND age = 'Y6')
+ OR (geo = 'UKJ2' AND age = 'Y6')
+ OR (geo = 'UKJ3' AND age = 'Y6')
+ OR (geo = 'UKJ4' AND age = 'Y6')
+ OR (geo = 'UKK' AND age = 'Y6')
+ OR (geo = 'UKK1' AND age = 'Y6')
+ OR (geo = 'UKK2' AND age = 'Y6')
+ OR (geo = 'UKK3' AND age = 'Y6')
+ OR (geo = 'UKK4' AND age = 'Y6')
+ OR (geo = 'UKL' AND age = 'Y6')
+ OR (geo = 'UKL1' AND age = 'Y6')
+ OR (geo = 'UKL2' AND age = 'Y6')
+ OR (geo = 'UKM' AND age = 'Y6')
+ OR (geo = 'UKM5' AND age = 'Y6')
+ OR (geo = 'UKM6' AND age = 'Y6')
+ OR (geo = 'UKM7' AND age = 'Y6')
+ OR (geo = 'UKM8' AND age = 'Y6')
+ OR (geo = 'UKM9' AND age = 'Y6')
+ OR (geo = 'UKN' AND age = 'Y6')
+ OR (geo = 'UKN0' AND age = 'Y6')
+ OR (geo = 'ME' AND age = 'Y6')
+ OR (geo = 'ME0' AND age = 'Y6')
+ OR (geo = 'ME00' AND age = 'Y6')
+ OR (geo = 'MK' AND age = 'Y6')
+ OR (geo = 'MK0' AND age = 'Y6')
+ OR (geo = 'MK00' AND age = 'Y6')
+ OR (geo = 'MKX' AND age = 'Y6')
+ OR (geo = 'MKXX' AND age = 'Y6')
+ OR (geo = 'AL' AND age = 'Y6')
+ OR (geo = 'AL0' AND age = 'Y6')
+ OR (geo = 'AL01' AND age = 'Y6')
+ OR (geo = 'AL02' AND age = 'Y6')
+ OR (geo = 'AL03' AND age = 'Y6')
+ OR (geo = 'ALX' AND age = 'Y6')
+ OR (geo = 'ALXX' AND age = 'Y6')
+ OR (geo = 'RS' AND age = 'Y6')
+ OR (geo = 'RS1' AND age = 'Y6')
+ OR (geo = 'RS11' AND age = 'Y6')
+ OR (geo = 'RS12' AND age = 'Y6')
+ OR (geo = 'RS2' AND age = 'Y6')
+ OR (geo = 'RS21' AND age = 'Y6')
+ OR (geo = 'RS22' AND age = 'Y6')
+ OR (geo = 'TR' AND age = 'Y6')
+ OR (geo = 'TR1' AND age = 'Y6')
+ OR (geo = 'TR10' AND age = 'Y6')
+ OR (geo = 'TR2' AND age = 'Y6')
+ OR (geo = 'TR21' AND age = 'Y6')
+ OR (geo = 'TR22' AND age = 'Y6')
+ OR (geo = 'TR3' AND age = 'Y6')
+ OR (geo = 'TR31' AND age = 'Y6')
+ OR (geo = 'TR32' AND age = 'Y6')
+ OR (geo = 'TR33' AND age = 'Y6')
+ OR (geo = 'TR4' AND age = 'Y6')
+ OR (geo = 'TR41' AND age = 'Y6')
+ OR (geo = 'TR42' AND age = 'Y6')
+ OR (geo = 'TR5' AND age = 'Y6')
+ OR (geo = 'TR51' AND age = 'Y6')
+ OR (geo = 'TR52' AND age = 'Y6')
+ OR (geo = 'TR6' AND age = 'Y6')
+ OR (geo = 'TR61' AND age = 'Y6')
+ OR (geo = 'TR62' AND age = 'Y6')
+ OR (geo = 'TR63' AND age = 'Y6')
+ OR (geo = 'TR7' AND age = 'Y6')
+ OR (geo = 'TR71' AND age = 'Y6')
+ OR (geo = 'TR72' AND age = 'Y6')
+ OR (geo = 'TR8' AND age = 'Y6')
+ OR (geo = 'TR81' AND age = 'Y6')
+ OR (geo = 'TR82' AND age = 'Y6')
+ OR (geo = 'TR83' AND age = 'Y6')
+ OR (geo = 'TR9' AND age = 'Y6')
+ OR (geo = 'TR90' AND age = 'Y6')
+ OR (geo = 'TRA' AND age = 'Y6')
+ OR (geo = 'TRA1' AND age = 'Y6')
+ OR (geo = 'TRA2' AND age = 'Y6')
+ OR (geo = 'TRB' AND age = 'Y6')
+ OR (geo = 'TRB1' AND age = 'Y6')
+ OR (geo = 'TRB2' AND age = 'Y6')
+ OR (geo = 'TRC' AND age = 'Y6')
+ OR (geo = 'TRC1' AND age = 'Y6')
+ OR (geo = 'TRC2' AND age = 'Y6')
+ OR (geo = 'TRC3' AND age = 'Y6')
+ OR (geo = 'EU27_2020' AND age = 'Y7')
+ OR (geo = 'EU28' AND age = 'Y7')
+ OR (geo = 'EU27_2007' AND age = 'Y7')
+ OR (geo = 'BE' AND age = 'Y7')
+ OR (geo = 'BE1' AND age = 'Y7')
+ OR (geo = 'BE10' AND age = 'Y7')
+ OR (geo = 'BE2' AND age = 'Y7')
+ OR (geo = 'BE21' AND age = 'Y7')
+ OR (geo = 'BE22' AND age = 'Y7')
+ OR (geo = 'BE23' AND age = 'Y7')
+ OR (geo = 'BE24' AND age = 'Y7')
+ OR (geo = 'BE25' AND age = 'Y7')
+ OR (geo = 'BE3' AND age = 'Y7')
+ OR (geo = 'BE31' AND age = 'Y7')
+ OR (geo = 'BE32' AND age = 'Y7')
+ OR (geo = 'BE33' AND age = 'Y7')
+ OR (geo = 'BE34' AND age = 'Y7')
+ OR (geo = 'BE35' AND age = 'Y7')
+ OR (geo = 'BG' AND age = 'Y7')
+ OR (geo = 'BG3' AND age = 'Y7')
+ OR (geo = 'BG31' AND age = 'Y7')
+ OR (geo = 'BG32' AND age = 'Y7')
+ OR (geo = 'BG33' AND age = 'Y7')
+ OR (geo = 'BG34' AND age = 'Y7')
+ OR (geo = 'BG4' AND age = 'Y7')
+ OR (geo = 'BG41' AND age = 'Y7')
+ OR (geo = 'BG42' AND age = 'Y7')
+ OR (geo = 'CZ' AND age = 'Y7')
+ OR (geo = 'CZ0' AND age = 'Y7')
+ OR (geo = 'CZ01' AND age = 'Y7')
+ OR (geo = 'CZ02' AND age = 'Y7')
+ OR (geo = 'CZ03' AND age = 'Y7')
+ OR (geo = 'CZ04' AND age = 'Y7')
+ OR (geo = 'CZ05' AND age = 'Y7')
+ OR (geo = 'CZ06' AND age = 'Y7')
+ OR (geo = 'CZ07' AND age = 'Y7')
+ OR (geo = 'CZ08' AND age = 'Y7')
+ OR (geo = 'DK' AND age = 'Y7')
+ OR (geo = 'DK0' AND age = 'Y7')
+ OR (geo = 'DK01' AND age = 'Y7')
+ OR (geo = 'DK02' AND age = 'Y7')
+ OR (geo = 'DK03' AND age = 'Y7')
+ OR (geo = 'DK04' AND age = 'Y7')
+ OR (geo = 'DK05' AND age = 'Y7')
+ OR (geo = 'DE' AND age = 'Y7')
+ OR (geo = 'DE_TOT' AND age = 'Y7')
+ OR (geo = 'DE1' AND age = 'Y7')
+ OR (geo = 'DE11' AND age = 'Y7')
+ OR (geo = 'DE12' AND age = 'Y7')
+ OR (geo = 'DE13' AND age = 'Y7')
+ OR (geo = 'DE14' AND age = 'Y7')
+ OR (geo = 'DE2' AND age = 'Y7')
+ OR (geo = 'DE21' AND age = 'Y7')
+ OR (geo = 'DE22' AND age = 'Y7')
+ OR (geo = 'DE23' AND age = 'Y7')
+ OR (geo = 'DE24' AND age = 'Y7')
+ OR (geo = 'DE25' AND age = 'Y7')
+ OR (geo = 'DE26' AND age = 'Y7')
+ OR (geo = 'DE27' AND age = 'Y7')
+ OR (geo = 'DE3' AND age = 'Y7')
+ OR (geo = 'DE30' AND age = 'Y7')
+ OR (geo = 'DE4' AND age = 'Y7')
+ OR (geo = 'DE40' AND age = 'Y7')
+ OR (geo = 'DE5' AND age = 'Y7')
+ OR (geo = 'DE50' AND age = 'Y7')
+ OR (geo = 'DE6' AND age = 'Y7')
+ OR (geo = 'DE60' AND age = 'Y7')
+ OR (geo = 'DE7' AND age = 'Y7')
+ OR (geo = 'DE71' AND age = 'Y7')
+ OR (geo = 'DE72' AND age = 'Y7')
+ OR (geo = 'DE73' AND age = 'Y7')
+ OR (geo = 'DE8' AND age = 'Y7')
+ OR (geo = 'DE80' AND age = 'Y7')
+ OR (geo = 'DE9' AND age = 'Y7')
+ OR (geo = 'DE91' AND age = 'Y7')
+ OR (geo = 'DE92' AND age = 'Y7')
+ OR (geo = 'DE93' AND age = 'Y7')
+ OR (geo = 'DE94' AND age = 'Y7')
+ OR (geo = 'DEA' AND age = 'Y7')
+ OR (geo = 'DEA1' AND age = 'Y7')
+ OR (geo = 'DEA2' AND age = 'Y7')
+ OR (geo = 'DEA3' AND age = 'Y7')
+ OR (geo = 'DEA4' AND age = 'Y7')
+ OR (geo = 'DEA5' AND age = 'Y7')
+ OR (geo = 'DEB' AND age = 'Y7')
+ OR (geo = 'DEB1' AND age = 'Y7')
+ OR (geo = 'DEB2' AND age = 'Y7')
+ OR (geo = 'DEB3' AND age = 'Y7')
+ OR (geo = 'DEC' AND age = 'Y7')
+ OR (geo = 'DEC0' AND age = 'Y7')
+ OR (geo = 'DED' AND age = 'Y7')
+ OR (geo = 'DED2' AND age = 'Y7')
+ OR (geo = 'DED4' AND age = 'Y7')
+ OR (geo = 'DED5' AND age = 'Y7')
+ OR (geo = 'DEE' AND age = 'Y7')
+ OR (geo = 'DEE0' AND age = 'Y7')
+ OR (geo = 'DEF' AND age = 'Y7')
+ OR (geo = 'DEF0' AND age = 'Y7')
+ OR (geo = 'DEG' AND age = 'Y7')
+ OR (geo = 'DEG0' AND age = 'Y7')
+ OR (geo = 'EE' AND age = 'Y7')
+ OR (geo = 'EE0' AND age = 'Y7')
+ OR (geo = 'EE00' AND age = 'Y7')
+ OR (geo = 'IE' AND age = 'Y7')
+ OR (geo = 'IE0' AND age = 'Y7')
+ OR (geo = 'IE04' AND age = 'Y7')
+ OR (geo = 'IE05' AND age = 'Y7')
+ OR (geo = 'IE06' AND age = 'Y7')
+ OR (geo = 'EL' AND age = 'Y7')
+ OR (geo = 'EL3' AND age = 'Y7')
+ OR (geo = 'EL30' AND age = 'Y7')
+ OR (geo = 'EL4' AND age = 'Y7')
+ OR (geo = 'EL41' AND age = 'Y7')
+ OR (geo = 'EL42' AND age = 'Y7')
+ OR (geo = 'EL43' AND age = 'Y7')
+ OR (geo = 'EL5' AND age = 'Y7')
+ OR (geo = 'EL51' AND age = 'Y7')
+ OR (geo = 'EL52' AND age = 'Y7')
+ OR (geo = 'EL53' AND age = 'Y7')
+ OR (geo = 'EL54' AND age = 'Y7')
+ OR (geo = 'EL6' AND age = 'Y7')
+ OR (geo = 'EL61' AND age = 'Y7')
+ OR (geo = 'EL62' AND age = 'Y7')
+ OR (geo = 'EL63' AND age = 'Y7')
+ OR (geo = 'EL64' AND age = 'Y7')
+ OR (geo = 'EL65' AND age = 'Y7')
+ OR (geo = 'ES' AND age = 'Y7')
+ OR (geo = 'ES1' AND age = 'Y7')
+ OR (geo = 'ES11' AND age = 'Y7')
+ OR (geo = 'ES12' AND age = 'Y7')
+ OR (geo = 'ES13' AND age = 'Y7')
+ OR (geo = 'ES2' AND age = 'Y7')
+ OR (geo = 'ES21' AND age = 'Y7')
+ OR (geo = 'ES22' AND age = 'Y7')
+ OR (geo = 'ES23' AND age = 'Y7')
+ OR (geo = 'ES24' AND age = 'Y7')
+ OR (geo = 'ES3' AND age = 'Y7')
+ OR (geo = 'ES30' AND age = 'Y7')
+ OR (geo = 'ES4' AND age = 'Y7')
+ OR (geo = 'ES41' AND age = 'Y7')
+ OR (geo = 'ES42' AND age = 'Y7')
+ OR (geo = 'ES43' AND age = 'Y7')
+ OR (geo = 'ES5' AND age = 'Y7')
+ OR (geo = 'ES51' AND age = 'Y7')
+ OR (geo = 'ES52' AND age = 'Y7')
+ OR (geo = 'ES53' AND age = 'Y7')
+ OR (geo = 'ES6' AND age = 'Y7')
+ OR (geo = 'ES61' AND age = 'Y7')
+ OR (geo = 'ES62' AND age = 'Y7')
+ OR (geo = 'ES63' AND age = 'Y7')
+ OR (geo = 'ES64' AND age = 'Y7')
+ OR (geo = 'ES7' AND age = 'Y7')
+ OR (geo = 'ES70' AND age = 'Y7')
+ OR (geo = 'FR' AND age = 'Y7')
+ OR (geo = 'FR1' AND age = 'Y7')
+ OR (geo = 'FR10' AND age = 'Y7')
+ OR (geo = 'FRB' AND age = 'Y7')
+ OR (geo = 'FRB0' AND age = 'Y7')
+ OR (geo = 'FRC' AND age = 'Y7')
+ OR (geo = 'FRC1' AND age = 'Y7')
+ OR (geo = 'FRC2' AND age = 'Y7')
+ OR (geo = 'FRD' AND age = 'Y7')
+ OR (geo = 'FRD1' AND age = 'Y7')
+ OR (geo = 'FRD2' AND age = 'Y7')
+ OR (geo = 'FRE' AND age = 'Y7')
+ OR (geo = 'FRE1' AND age = 'Y7')
+ OR (geo = 'FRE2' AND age = 'Y7')
+ OR (geo = 'FRF' AND age = 'Y7')
+ OR (geo = 'FRF1' AND age = 'Y7')
+ OR (geo = 'FRF2' AND age = 'Y7')
+ OR (geo = 'FRF3' AND age = 'Y7')
+ OR (geo = 'FRG' AND age = 'Y7')
+ OR (geo = 'FRG0' AND age = 'Y7')
+ OR (geo = 'FRH' AND age = 'Y7')
+ OR (geo = 'FRH0' AND age = 'Y7')
+ OR (geo = 'FRI' AND age = 'Y7')
+ OR (geo = 'FRI1' AND age = 'Y7')
+ OR (geo = 'FRI2' AND age = 'Y7')
+ OR (geo = 'FRI3' AND age = 'Y7')
+ OR (geo = 'FRJ' AND age = 'Y7')
+ OR (geo = 'FRJ1' AND age = 'Y7')
+ OR (geo = 'FRJ2' AND age = 'Y7')
+ OR (geo = 'FRK' AND age = 'Y7')
+ OR (geo = 'FRK1' AND age = 'Y7')
+ OR (geo = 'FRK2' AND age = 'Y7')
+ OR (geo = 'FRL' AND age = 'Y7')
+ OR (geo = 'FRL0' AND age = 'Y7')
+ OR (geo = 'FRM' AND age = 'Y7')
+ OR (geo = 'FRM0' AND age = 'Y7')
+ OR (geo = 'FRY' AND age = 'Y7')
+ OR (geo = 'FRY1' AND age = 'Y7')
+ OR (geo = 'FRY2' AND age = 'Y7')
+ OR (geo = 'FRY3' AND age = 'Y7')
+ OR (geo = 'FRY4' AND age = 'Y7')
+ OR (geo = 'FRY5' AND age = 'Y7')
+ OR (geo = 'FRX' AND age = 'Y7')
+ OR (geo = 'FRXX' AND age = 'Y7')
+ OR (geo = 'HR' AND age = 'Y7')
+ OR (geo = 'HR0' AND age = 'Y7')
+ OR (geo = 'HR02' AND age = 'Y7')
+ OR (geo = 'HR03' AND age = 'Y7')
+ OR (geo = 'HR04' AND age = 'Y7')
+ OR (geo = 'HR05' AND age = 'Y7')
+ OR (geo = 'HR06' AND age = 'Y7')
+ OR (geo = 'IT' AND age = 'Y7')
+ OR (geo = 'ITC' AND age = 'Y7')
+ OR (geo = 'ITC1' AND age = 'Y7')
+ OR (geo = 'ITC2' AND age = 'Y7')
+ OR (geo = 'ITC3' AND age = 'Y7')
+ OR (geo = 'ITC4' AND age = 'Y7')
+ OR (geo = 'ITF' AND age = 'Y7')
+ OR (geo = 'ITF1' AND age = 'Y7')
+ OR (geo = 'ITF2' AND age = 'Y7')
+ OR (geo = 'ITF3' AND age = 'Y7')
+ OR (geo = 'ITF4' AND age = 'Y7')
+ OR (geo = 'ITF5' AND age = 'Y7')
+ OR (geo = 'ITF6' AND age = 'Y7')
+ OR (geo = 'ITG' AND age = 'Y7')
+ OR (geo = 'ITG1' AND age = 'Y7')
+ OR (geo = 'ITG2' AND age = 'Y7')
+ OR (geo = 'ITH' AND age = 'Y7')
+ OR (geo = 'ITH1' AND age = 'Y7')
+ OR (geo = 'ITH2' AND age = 'Y7')
+ OR (geo = 'ITH3' AND age = 'Y7')
+ OR (geo = 'ITH4' AND age = 'Y7')
+ OR (geo = 'ITH5' AND age = 'Y7')
+ OR (geo = 'ITI' AND age = 'Y7')
+ OR (geo = 'ITI1' AND age = 'Y7')
+ OR (geo = 'ITI2' AND age = 'Y7')
+ OR (geo = 'ITI3' AND age = 'Y7')
+ OR (geo = 'ITI4' AND age = 'Y7')
+ OR (geo = 'CY' AND age = 'Y7')
+ OR (geo = 'CY0' AND age = 'Y7')
+ OR (geo = 'CY00' AND age = 'Y7')
+ OR (geo = 'LV' AND age = 'Y7')
+ OR (geo = 'LV0' AND age = 'Y7')
+ OR (geo = 'LV00' AND age = 'Y7')
+ OR (geo = 'LT' AND age = 'Y7')
+ OR (geo = 'LT0' AND age = 'Y7')
+ OR (geo = 'LT01' AND age = 'Y7')
+ OR (geo = 'LT02' AND age = 'Y7')
+ OR (geo = 'LU' AND age = 'Y7')
+ OR (geo = 'LU0' AND age = 'Y7')
+ OR (geo = 'LU00' AND age = 'Y7')
+ OR (geo = 'HU' AND age = 'Y7')
+ OR (geo = 'HU1' AND age = 'Y7')
+ OR (geo = 'HU11' AND age = 'Y7')
+ OR (geo = 'HU12' AND age = 'Y7')
+ OR (geo = 'HU2' AND age = 'Y7')
+ OR (geo = 'HU21' AND age = 'Y7')
+ OR (geo = 'HU22' AND age = 'Y7')
+ OR (geo = 'HU23' AND age = 'Y7')
+ OR (geo = 'HU3' AND age = 'Y7')
+ OR (geo = 'HU31' AND age = 'Y7')
+ OR (geo = 'HU32' AND age = 'Y7')
+ OR (geo = 'HU33' AND age = 'Y7')
+ OR (geo = 'HUX' AND age = 'Y7')
+ OR (geo = 'HUXX' AND age = 'Y7')
+ OR (geo = 'MT' AND age = 'Y7')
+ OR (geo = 'MT0' AND age = 'Y7')
+ OR (geo = 'MT00' AND age = 'Y7')
+ OR (geo = 'NL' AND age = 'Y7')
+ OR (geo = 'NL1' AND age = 'Y7')
+ OR (geo = 'NL11' AND age = 'Y7')
+ OR (geo = 'NL12' AND age = 'Y7')
+ OR (geo = 'NL13' AND age = 'Y7')
+ OR (geo = 'NL2' AND age = 'Y7')
+ OR (geo = 'NL21' AND age = 'Y7')
+ OR (geo = 'NL22' AND age = 'Y7')
+ OR (geo = 'NL23' AND age = 'Y7')
+ OR (geo = 'NL3' AND age = 'Y7')
+ OR (geo = 'NL31' AND age = 'Y7')
+ OR (geo = 'NL32' AND age = 'Y7')
+ OR (geo = 'NL33' AND age = 'Y7')
+ OR (geo = 'NL34' AND age = 'Y7')
+ OR (geo = 'NL35' AND age = 'Y7')
+ OR (geo = 'NL36' AND age = 'Y7')
+ OR (geo = 'NL4' AND age = 'Y7')
+ OR (geo = 'NL41' AND age = 'Y7')
+ OR (geo = 'NL42' AND age = 'Y7')
+ OR (geo = 'AT' AND age = 'Y7')
+ OR (geo = 'AT1' AND age = 'Y7')
+ OR (geo = 'AT11' AND age = 'Y7')
+ OR (geo = 'AT12' AND age = 'Y7')
+ OR (geo = 'AT13' AND age = 'Y7')
+ OR (geo = 'AT2' AND age = 'Y7')
+ OR (geo = 'AT21' AND age = 'Y7')
+ OR (geo = 'AT22' AND age = 'Y7')
+ OR (geo = 'AT3' AND age = 'Y7')
+ OR (geo = 'AT31' AND age = 'Y7')
+ OR (geo = 'AT32' AND age = 'Y7')
+ OR (geo = 'AT33' AND age = 'Y7')
+ OR (geo = 'AT34' AND age = 'Y7')
+ OR (geo = 'PL' AND age = 'Y7')
+ OR (geo = 'PL2' AND age = 'Y7')
+ OR (geo = 'PL21' AND age = 'Y7')
+ OR (geo = 'PL22' AND age = 'Y7')
+ OR (geo = 'PL4' AND age = 'Y7')
+ OR (geo = 'PL41' AND age = 'Y7')
+ OR (geo = 'PL42' AND age = 'Y7')
+ OR (geo = 'PL43' AND age = 'Y7')
+ OR (geo = 'PL5' AND age = 'Y7')
+ OR (geo = 'PL51' AND age = 'Y7')
+ OR (geo = 'PL52' AND age = 'Y7')
+ OR (geo = 'PL6' AND age = 'Y7')
+ OR (geo = 'PL61' AND age = 'Y7')
+ OR (geo = 'PL62' AND age = 'Y7')
+ OR (geo = 'PL63' AND age = 'Y7')
+ OR (geo = 'PL7' AND age = 'Y7')
+ OR (geo = 'PL71' AND age = 'Y7')
+ OR (geo = 'PL72' AND age = 'Y7')
+ OR (geo = 'PL8' AND age = 'Y7')
+ OR (geo = 'PL81' AND age = 'Y7')
+ OR (geo = 'PL82' AND age = 'Y7')
+ OR (geo = 'PL84' AND age = 'Y7')
+ OR (geo = 'PL9' AND age = 'Y7')
+ OR (geo = 'PL91' AND age = 'Y7')
+ OR (geo = 'PL92' AND age = 'Y7')
+ OR (geo = 'PT' AND age = 'Y7')
+ OR (geo = 'PT1' AND age = 'Y7')
+ OR (geo = 'PT11' AND age = 'Y7')
+ OR (geo = 'PT15' AND age = 'Y7')
+ OR (geo = 'PT16' AND age = 'Y7')
+ OR (geo = 'PT17' AND age = 'Y7')
+ OR (geo = 'PT18' AND age = 'Y7')
+ OR (geo = 'PT19' AND age = 'Y7')
+ OR (geo = 'PT1A' AND age = 'Y7')
+ OR (geo = 'PT1B' AND age = 'Y7')
+ OR (geo = 'PT1C' AND age = 'Y7')
+ OR (geo = 'PT1D' AND age = 'Y7')
+ OR (geo = 'PT2' AND age = 'Y7')
+ OR (geo = 'PT20' AND age = 'Y7')
+ OR (geo = 'PT3' AND age = 'Y7')
+ OR (geo = 'PT30' AND age = 'Y7')
+ OR (geo = 'RO' AND age = 'Y7')
+ OR (geo = 'RO1' AND age = 'Y7')
+ OR (geo = 'RO11' AND age = 'Y7')
+ OR (geo = 'RO12' AND age = 'Y7')
+ OR (geo = 'RO2' AND age = 'Y7')
+ OR (geo = 'RO21' AND age = 'Y7')
+ OR (geo = 'RO22' AND age = 'Y7')
+ OR (geo = 'RO3' AND age = 'Y7')
+ OR (geo = 'RO31' AND age = 'Y7')
+ OR (geo = 'RO32' AND age = 'Y7')
+ OR (geo = 'RO4' AND age = 'Y7')
+ OR (geo = 'RO41' AND age = 'Y7')
+ OR (geo = 'RO42' AND age = 'Y7')
+ OR (geo = 'SI' AND age = 'Y7')
+ OR (geo = 'SI0' AND age = 'Y7')
+ OR (geo = 'SI03' AND age = 'Y7')
+ OR (geo = 'SI04' AND age = 'Y7')
+ OR (geo = 'SK' AND age = 'Y7')
+ OR (geo = 'SK0' AND age = 'Y7')
+ OR (geo = 'SK01' AND age = 'Y7')
+ OR (geo = 'SK02' AND age = 'Y7')
+ OR (geo = 'SK03' AND age = 'Y7')
+ OR (geo = 'SK04' AND age = 'Y7')
+ OR (geo = 'FI' AND age = 'Y7')
+ OR (geo = 'FI1' AND age = 'Y7')
+ OR (geo = 'FI19' AND age = 'Y7')
+ OR (geo = 'FI1B' AND age = 'Y7')
+ OR (geo = 'FI1C' AND age = 'Y7')
+ OR (geo = 'FI1D' AND age = 'Y7')
+ OR (geo = 'FI2' AND age = 'Y7')
+ OR (geo = 'FI20' AND age = 'Y7')
+ OR (geo = 'SE' AND age = 'Y7')
+ OR (geo = 'SE1' AND age = 'Y7')
+ OR (geo = 'SE11' AND age = 'Y7')
+ OR (geo = 'SE12' AND age = 'Y7')
+ OR (geo = 'SE2' AND age = 'Y7')
+ OR (geo = 'SE21' AND age = 'Y7')
+ OR (geo = 'SE22' AND age = 'Y7')
+ OR (geo = 'SE23' AND age = 'Y7')
+ OR (geo = 'SE3' AND age = 'Y7')
+ OR (geo = 'SE31' AND age = 'Y7')
+ OR (geo = 'SE32' AND age = 'Y7')
+ OR (geo = 'SE33' AND age = 'Y7')
+ OR (geo = 'EFTA' AND age = 'Y7')
+ OR (geo = 'IS' AND age = 'Y7')
+ OR (geo = 'IS0' AND age = 'Y7')
+ OR (geo = 'IS00' AND age = 'Y7')
+ OR (geo = 'LI' AND age = 'Y7')
+ OR (geo = 'LI0' AND age = 'Y7')
+ OR (geo = 'LI00' AND age = 'Y7')
+ OR (geo = 'NO' AND age = 'Y7')
+ OR (geo = 'NO0' AND age = 'Y7')
+ OR (geo = 'NO01' AND age = 'Y7')
+ OR (geo = 'NO02' AND age = 'Y7')
+ OR (geo = 'NO03' AND age = 'Y7')
+ OR (geo = 'NO04' AND age = 'Y7')
+ OR (geo = 'NO05' AND age = 'Y7')
+ OR (geo = 'NO06' AND age = 'Y7')
+ OR (geo = 'NO07' AND age = 'Y7')
+ OR (geo = 'NO08' AND age = 'Y7')
+ OR (geo = 'NO09' AND age = 'Y7')
+ OR (geo = 'NO0A' AND age = 'Y7')
+ OR (geo = 'NO0B' AND age = 'Y7')
+ OR (geo = 'CH' AND age = 'Y7')
+ OR (geo = 'CH0' AND age = 'Y7')
+ OR (geo = 'CH01' AND age = 'Y7')
+ OR (geo = 'CH02' AND age = 'Y7')
+ OR (geo = 'CH03' AND age = 'Y7')
+ OR (geo = 'CH04' AND age = 'Y7')
+ OR (geo = 'CH05' AND age = 'Y7')
+ OR (geo = 'CH06' AND age = 'Y7')
+ OR (geo = 'CH07' AND age = 'Y7')
+ OR (geo = 'UK' AND age = 'Y7')
+ OR (geo = 'UKC' AND age = 'Y7')
+ OR (geo = 'UKC1' AND age = 'Y7')
+ OR (geo = 'UKC2' AND age = 'Y7')
+ OR (geo = 'UKD' AND age = 'Y7')
+ OR (geo = 'UKD1' AND age = 'Y7')
+ OR (geo = 'UKD3' AND age = 'Y7')
+ OR (geo = 'UKD4' AND age = 'Y7')
+ OR (geo = 'UKD6' AND age = 'Y7')
+ OR (geo = 'UKD7' AND age = 'Y7')
+ OR (geo = 'UKE' AND age = 'Y7')
+ OR (geo = 'UKE1' AND age = 'Y7')
+ OR (geo = 'UKE2' AND age = 'Y7')
+ OR (geo = 'UKE3' AND age = 'Y7')
+ OR (geo = 'UKE4' AND age = 'Y7')
+ OR (geo = 'UKF' AND age = 'Y7')
+ OR (geo = 'UKF1' AND age = 'Y7')
+ OR (geo = 'UKF2' AND age = 'Y7')
+ OR (geo = 'UKF3' AND age = 'Y7')
+ OR (geo = 'UKG' AND age = 'Y7')
+ OR (geo = 'UKG1' AND age = 'Y7')
+ OR (geo = 'UKG2' AND age = 'Y7')
+ OR (geo = 'UKG3' AND age = 'Y7')
+ OR (geo = 'UKH' AND age = 'Y7')
+ OR (geo = 'UKH1' AND age = 'Y7')
+ OR (geo = 'UKH2' AND age = 'Y7')
+ OR (geo = 'UKH3' AND age = 'Y7')
+ OR (geo = 'UKI' AND age = 'Y7')
+ OR (geo = 'UKI3' AND age = 'Y7')
+ OR (geo = 'UKI4' AND age = 'Y7')
+ OR (geo = 'UKI5' AND age = 'Y7')
+ OR (geo = 'UKI6' AND age = 'Y7')
+ OR (geo = 'UKI7' AND age = 'Y7')
+ OR (geo = 'UKJ' AND age = 'Y7')
+ OR (geo = 'UKJ1' AND age = 'Y7')
+ OR (geo = 'UKJ2' AND age = 'Y7')
+ OR (geo = 'UKJ3' AND age = 'Y7')
+ OR (geo = 'UKJ4' AND age = 'Y7')
+ OR (geo = 'UKK' AND age = 'Y7')
+ OR (geo = 'UKK1' AND age = 'Y7')
+ OR (geo = 'UKK2' AND age = 'Y7')
+ OR (geo = 'UKK3' AND age = 'Y7')
+ OR (geo = 'UKK4' AND age = 'Y7')
+ OR (geo = 'UKL' AND age = 'Y7')
+ OR (geo = 'UKL1' AND age = 'Y7')
+ OR (geo = 'UKL2' AND age = 'Y7')
+ OR (geo = 'UKM' AND age = 'Y7')
+ OR (geo = 'UKM5' AND age = 'Y7')
+ OR (geo = 'UKM6' AND age = 'Y7')
+ OR (geo = 'UKM7' AND age = 'Y7')
+ OR (geo = 'UKM8' AND age = 'Y7')
+ OR (geo = 'UKM9' AND age = 'Y7')
+ OR (geo = 'UKN' AND age = 'Y7')
+ OR (geo = 'UKN0' AND age = 'Y7')
+ OR (geo = 'ME' AND age = 'Y7')
+ OR (geo = 'ME0' AND age = 'Y7')
+ OR (geo = 'ME00' AND age = 'Y7')
+ OR (geo = 'MK' AND age = 'Y7')
+ OR (geo = 'MK0' AND age = 'Y7')
+ OR (geo = 'MK00' AND age = 'Y7')
+ OR (geo = 'MKX' AND age = 'Y7')
+ OR (geo = 'MKXX' AND age = 'Y7')
+ OR (geo = 'AL' AND age = 'Y7')
+ OR (geo = 'AL0' AND age = 'Y7')
+ OR (geo = 'AL01' AND age = 'Y7')
+ OR (geo = 'AL02' AND age = 'Y7')
+ OR (geo = 'AL03' AND age = 'Y7')
+ OR (geo = 'ALX' AND age = 'Y7')
+ OR (geo = 'ALXX' AND age = 'Y7')
+ OR (geo = 'RS' AND age = 'Y7')
+ OR (geo = 'RS1' AND age = 'Y7')
+ OR (geo = 'RS11' AND age = 'Y7')
+ OR (geo = 'RS12' AND age = 'Y7')
+ OR (geo = 'RS2' AND age = 'Y7')
+ OR (geo = 'RS21' AND age = 'Y7')
+ OR (geo = 'RS22' AND age = 'Y7')
+ OR (geo = 'TR' AND age = 'Y7')
+ OR (geo = 'TR1' AND age = 'Y7')
+ OR (geo = 'TR10' AND age = 'Y7')
+ OR (geo = 'TR2' AND age = 'Y7')
+ OR (geo = 'TR21' AND age = 'Y7')
+ OR (geo = 'TR22' AND age = 'Y7')
+ OR (geo = 'TR3' AND age = 'Y7')
+ OR (geo = 'TR31' AND age = 'Y7')
+ OR (geo = 'TR32' AND age = 'Y7')
+ OR (geo = 'TR33' AND age = 'Y7')
+ OR (geo = 'TR4' AND age = 'Y7')
+ OR (geo = 'TR41' AND age = 'Y7')
+ OR (geo = 'TR42' AND age = 'Y7')
+ OR (geo = 'TR5' AND age = 'Y7')
+ OR (geo = 'TR51' AND age = 'Y7')
+ OR (geo = 'TR52' AND age = 'Y7')
+ OR (geo = 'TR6' AND age = 'Y7')
+ OR (geo = 'TR61' AND age = 'Y7')
+ OR (geo = 'TR62' AND age = 'Y7')
+ OR (geo = 'TR63' AND age = 'Y7')
+ OR (geo = 'TR7' AND age = 'Y7')
+ OR (geo = 'TR71' AND age = 'Y7')
+ OR (geo = 'TR72' AND age = 'Y7')
+ OR (geo = 'TR8' AND age = 'Y7')
+ OR (geo = 'TR81' AND age = 'Y7')
+ OR (geo = 'TR82' AND age = 'Y7')
+ OR (geo = 'TR83' AND age = 'Y7')
+ OR (geo = 'TR9' AND age = 'Y7')
+ OR (geo = 'TR90' AND age = 'Y7')
+ OR (geo = 'TRA' AND age = 'Y7')
+ OR (geo = 'TRA1' AND age = 'Y7')
+ OR (geo = 'TRA2' AND age = 'Y7')
+ OR (geo = 'TRB' AND age = 'Y7')
+ OR (geo = 'TRB1' AND age = 'Y7')
+ OR (geo = 'TRB2' AND age = 'Y7')
+ OR (geo = 'TRC' AND age = 'Y7')
+ OR (geo = 'TRC1' AND age = 'Y7')
+ OR (geo = 'TRC2' AND age = 'Y7')
+ OR (geo = 'TRC3' AND age = 'Y7')
+ OR (geo = 'EU27_2020' AND age = 'Y8')
+ OR (geo = 'EU28' AND age = 'Y8')
+ OR (geo = 'EU27_2007' AND age = 'Y8')
+ OR (geo = 'BE' AND age = 'Y8')
+ OR (geo = 'BE1' AND age = 'Y8')
+ OR (geo = 'BE10' AND age = 'Y8')
+ OR (geo = 'BE2' AND age = 'Y8')
+ OR (geo = 'BE21' AND age = 'Y8')
+ OR (geo = 'BE22' AND age = 'Y8')
+ OR (geo = 'BE23' AND age = 'Y8')
+ OR (geo = 'BE24' AND age = 'Y8')
+ OR (geo = 'BE25' AND age = 'Y8')
+ OR (geo = 'BE3' AND age = 'Y8')
+ OR (geo = 'BE31' AND age = 'Y8')
+ OR (geo = 'BE32' AND age = 'Y8')
+ OR (geo = 'BE33' AND age = 'Y8')
+ OR (geo = 'BE34' AND age = 'Y8')
+ OR (geo = 'BE35' AND age = 'Y8')
+ OR (geo = 'BG' AND age = 'Y8')
+ OR (geo = 'BG3' AND age = 'Y8')
+ OR (geo = 'BG31' AND age = 'Y8')
+ OR (geo = 'BG32' AND age = 'Y8')
+ OR (geo = 'BG33' AND age = 'Y8')
+ OR (geo = 'BG34' AND age = 'Y8')
+ OR (geo = 'BG4' AND age = 'Y8')
+ OR (geo = 'BG41' AND age = 'Y8')
+ OR (geo = 'BG42' AND age = 'Y8')
+ OR (geo = 'CZ' AND age = 'Y8')
+ OR (geo = 'CZ0' AND age = 'Y8')
+ OR (geo = 'CZ01' AND age = 'Y8')
+ OR (geo = 'CZ02' AND age = 'Y8')
+ OR (geo = 'CZ03' AND age = 'Y8')
+ OR (geo = 'CZ04' AND age = 'Y8')
+ OR (geo = 'CZ05' AND age = 'Y8')
+ OR (geo = 'CZ06' AND age = 'Y8')
+ OR (geo = 'CZ07' AND age = 'Y8')
+ OR (geo = 'CZ08' AND age = 'Y8')
+ OR (geo = 'DK' AND age = 'Y8')
+ OR (geo = 'DK0' AND age = 'Y8')
+ OR (geo = 'DK01' AND age = 'Y8')
+ OR (geo = 'DK02' AND age = 'Y8')
+ OR (geo = 'DK03' AND age = 'Y8')
+ OR (geo = 'DK04' AND age = 'Y8')
+ OR (geo = 'DK05' AND age = 'Y8')
+ OR (geo = 'DE' AND age = 'Y8')
+ OR (geo = 'DE_TOT' AND age = 'Y8')
+ OR (geo = 'DE1' AND age = 'Y8')
+ OR (geo = 'DE11' AND age = 'Y8')
+ OR (geo = 'DE12' AND age = 'Y8')
+ OR (geo = 'DE13' AND age = 'Y8')
+ OR (geo = 'DE14' AND age = 'Y8')
+ OR (geo = 'DE2' AND age = 'Y8')
+ OR (geo = 'DE21' AND age = 'Y8')
+ OR (geo = 'DE22' AND age = 'Y8')
+ OR (geo = 'DE23' AND age = 'Y8')
+ OR (geo = 'DE24' AND age = 'Y8')
+ OR (geo = 'DE25' AND age = 'Y8')
+ OR (geo = 'DE26' AND age = 'Y8')
+ OR (geo = 'DE27' AND age = 'Y8')
+ OR (geo = 'DE3' AND age = 'Y8')
+ OR (geo = 'DE30' AND age = 'Y8')
+ OR (geo = 'DE4' AND age = 'Y8')
+ OR (geo = 'DE40' AND age = 'Y8')
+ OR (geo = 'DE5' AND age = 'Y8')
+ OR (geo = 'DE50' AND age = 'Y8')
+ OR (geo = 'DE6' AND age = 'Y8')
+ OR (geo = 'DE60' AND age = 'Y8')
+ OR (geo = 'DE7' AND age = 'Y8')
+ OR (geo = 'DE71' AND age = 'Y8')
+ OR (geo = 'DE72' AND age = 'Y8')
+ OR (geo = 'DE73' AND age = 'Y8')
+ OR (geo = 'DE8' AND age = 'Y8')
+ OR (geo = 'DE80' AND age = 'Y8')
+ OR (geo = 'DE9' AND age = 'Y8')
+ OR (geo = 'DE91' AND age = 'Y8')
+ OR (geo = 'DE92' AND age = 'Y8')
+ OR (geo = 'DE93' AND age = 'Y8')
+ OR (geo = 'DE94' AND age = 'Y8')
+ OR (geo = 'DEA' AND age = 'Y8')
+ OR (geo = 'DEA1' AND age = 'Y8')
+ OR (geo = 'DEA2' AND age = 'Y8')
+ OR (geo = 'DEA3' AND age = 'Y8')
+ OR (geo = 'DEA4' AND age = 'Y8')
+ OR (geo = 'DEA5' AND age = 'Y8')
+ OR (geo = 'DEB' AND age = 'Y8')
+ OR (geo = 'DEB1' AND age = 'Y8')
+ OR (geo = 'DEB2' AND age = 'Y8')
+ OR (geo = 'DEB3' AND age = 'Y8')
+ OR (geo = 'DEC' AND age = 'Y8')
+ OR (geo = 'DEC0' AND age = 'Y8')
+ OR (geo = 'DED' AND age = 'Y8')
+ OR (geo = 'DED2' AND age = 'Y8')
+ OR (geo = 'DED4' AND age = 'Y8')
+ OR (geo = 'DED5' AND age = 'Y8')
+ OR (geo = 'DEE' AND age = 'Y8')
+ OR (geo = 'DEE0' AND age = 'Y8')
+ OR (geo = 'DEF' AND age = 'Y8')
+ OR (geo = 'DEF0' AND age = 'Y8')
+ OR (geo = 'DEG' AND age = 'Y8')
+ OR (geo = 'DEG0' AND age = 'Y8')
+ OR (geo = 'EE' AND age = 'Y8')
+ OR (geo = 'EE0' AND age = 'Y8')
+ OR (geo = 'EE00' AND age = 'Y8')
+ OR (geo = 'IE' AND age = 'Y8')
+ OR (geo = 'IE0' AND age = 'Y8')
+ OR (geo = 'IE04' AND age = 'Y8')
+ OR (geo = 'IE05' AND age = 'Y8')
+ OR (geo = 'IE06' AND age = 'Y8')
+ OR (geo = 'EL' AND age = 'Y8')
+ OR (geo = 'EL3' AND age = 'Y8')
+ OR (geo = 'EL30' AND age = 'Y8')
+ OR (geo = 'EL4' AND age = 'Y8')
+ OR (geo = 'EL41' AND age = 'Y8')
+ OR (geo = 'EL42' AND age = 'Y8')
+ OR (geo = 'EL43' AND age = 'Y8')
+ OR (geo = 'EL5' AND age = 'Y8')
+ OR (geo = 'EL51' AND age = 'Y8')
+ OR (geo = 'EL52' AND age = 'Y8')
+ OR (geo = 'EL53' AND age = 'Y8')
+ OR (geo = 'EL54' AND age = 'Y8')
+ OR (geo = 'EL6' AND age = 'Y8')
+ OR (geo = 'EL61' AND age = 'Y8')
+ OR (geo = 'EL62' AND age = 'Y8')
+ OR (geo = 'EL63' AND age = 'Y8')
+ OR (geo = 'EL64' AND age = 'Y8')
+ OR (geo = 'EL65' AND age = 'Y8')
+ OR (geo = 'ES' AND age = 'Y8')
+ OR (geo = 'ES1' AND age = 'Y8')
+ OR (geo = 'ES11' AND age = 'Y8')
+ OR (geo = 'ES12' AND age = 'Y8')
+ OR (geo = 'ES13' AND age = 'Y8')
+ OR (geo = 'ES2' AND age = 'Y8')
+ OR (geo = 'ES21' AND age = 'Y8')
+ OR (geo = 'ES22' AND age = 'Y8')
+ OR (geo = 'ES23' AND age = 'Y8')
+ OR (geo = 'ES24' AND age = 'Y8')
+ OR (geo = 'ES3' AND age = 'Y8')
+ OR (geo = 'ES30' AND age = 'Y8')
+ OR (geo = 'ES4' AND age = 'Y8')
+ OR (geo = 'ES41' AND age = 'Y8')
+ OR (geo = 'ES42' AND age = 'Y8')
+ OR (geo = 'ES43' AND age = 'Y8')
+ OR (geo = 'ES5' AND age = 'Y8')
+ OR (geo = 'ES51' AND age = 'Y8')
+ OR (geo = 'ES52' AND age = 'Y8')
+ OR (geo = 'ES53' AND age = 'Y8')
+ OR (geo = 'ES6' AND age = 'Y8')
+ OR (geo = 'ES61' AND age = 'Y8')
+ OR (geo = 'ES62' AND age = 'Y8')
+ OR (geo = 'ES63' AND age = 'Y8')
+ OR (geo = 'ES64' AND age = 'Y8')
+ OR (geo = 'ES7' AND age = 'Y8')
+ OR (geo = 'ES70' AND age = 'Y8')
+ OR (geo = 'FR' AND age = 'Y8')
+ OR (geo = 'FR1' AND age = 'Y8')
+ OR (geo = 'FR10' AND age = 'Y8')
+ OR (geo = 'FRB' AND age = 'Y8')
+ OR (geo = 'FRB0' AND age = 'Y8')
+ OR (geo = 'FRC' AND age = 'Y8')
+ OR (geo = 'FRC1' AND age = 'Y8')
+ OR (geo = 'FRC2' AND age = 'Y8')
+ OR (geo = 'FRD' AND age = 'Y8')
+ OR (geo = 'FRD1' AND age = 'Y8')
+ OR (geo = 'FRD2' AND age = 'Y8')
+ OR (geo = 'FRE' AND age = 'Y8')
+ OR (geo = 'FRE1' AND age = 'Y8')
+ OR (geo = 'FRE2' AND age = 'Y8')
+ OR (geo = 'FRF' AND age = 'Y8')
+ OR (geo = 'FRF1' AND age = 'Y8')
+ OR (geo = 'FRF2' AND age = 'Y8')
+ OR (geo = 'FRF3' AND age = 'Y8')
+ OR (geo = 'FRG' AND age = 'Y8')
+ OR (geo = 'FRG0' AND age = 'Y8')
+ OR (geo = 'FRH' AND age = 'Y8')
+ OR (geo = 'FRH0' AND age = 'Y8')
+ OR (geo = 'FRI' AND age = 'Y8')
+ OR (geo = 'FRI1' AND age = 'Y8')
+ OR (geo = 'FRI2' AND age = 'Y8')
+ OR (geo = 'FRI3' AND age = 'Y8')
+ OR (geo = 'FRJ' AND age = 'Y8')
+ OR (geo = 'FRJ1' AND age = 'Y8')
+ OR (geo = 'FRJ2' AND age = 'Y8')
+ OR (geo = 'FRK' AND age = 'Y8')
+ OR (geo = 'FRK1' AND age = 'Y8')
+ OR (geo = 'FRK2' AND age = 'Y8')
+ OR (geo = 'FRL' AND age = 'Y8')
+ OR (geo = 'FRL0' AND age = 'Y8')
+ OR (geo = 'FRM' AND age = 'Y8')
+ OR (geo = 'FRM0' AND age = 'Y8')
+ OR (geo = 'FRY' AND age = 'Y8')
+ OR (geo = 'FRY1' AND age = 'Y8')
+ OR (geo = 'FRY2' AND age = 'Y8')
+ OR (geo = 'FRY3' AND age = 'Y8')
+ OR (geo = 'FRY4' AND age = 'Y8')
+ OR (geo = 'FRY5' AND age = 'Y8')
+ OR (geo = 'FRX' AND age = 'Y8')
+ OR (geo = 'FRXX' AND age = 'Y8')
+ OR (geo = 'HR' AND age = 'Y8')
+ OR (geo = 'HR0' AND age = 'Y8')
+ OR (geo = 'HR02' AND age = 'Y8')
+ OR (geo = 'HR03' AND age = 'Y8')
+ OR (geo = 'HR04' AND age = 'Y8')
+ OR (geo = 'HR05' AND age = 'Y8')
+ OR (geo = 'HR06' AND age = 'Y8')
+ OR (geo = 'IT' AND age = 'Y8')
+ OR (geo = 'ITC' AND age = 'Y8')
+ OR (geo = 'ITC1' AND age = 'Y8')
+ OR (geo = 'ITC2' AND age = 'Y8')
+ OR (geo = 'ITC3' AND age = 'Y8')
+ OR (geo = 'ITC4' AND age = 'Y8')
+ OR (geo = 'ITF' AND age = 'Y8')
+ OR (geo = 'ITF1' AND age = 'Y8')
+ OR (geo = 'ITF2' AND age = 'Y8')
+ OR (geo = 'ITF3' AND age = 'Y8')
+ OR (geo = 'ITF4' AND age = 'Y8')
+ OR (geo = 'ITF5' AND age = 'Y8')
+ OR (geo = 'ITF6' AND age = 'Y8')
+ OR (geo = 'ITG' AND age = 'Y8')
+ OR (geo = 'ITG1' AND age = 'Y8')
+ OR (geo = 'ITG2' AND age = 'Y8')
+ OR (geo = 'ITH' AND age = 'Y8')
+ OR (geo = 'ITH1' AND age = 'Y8')
+ OR (geo = 'ITH2' AND age = 'Y8')
+ OR (geo = 'ITH3' AND age = 'Y8')
+ OR (geo = 'ITH4' AND age = 'Y8')
+ OR (geo = 'ITH5' AND age = 'Y8')
+ OR (geo = 'ITI' AND age = 'Y8')
+ OR (geo = 'ITI1' AND age = 'Y8')
+ OR (geo = 'ITI2' AND age = 'Y8')
+ OR (geo = 'ITI3' AND age = 'Y8')
+ OR (geo = 'ITI4' AND age = 'Y8')
+ OR (geo = 'CY' AND age = 'Y8')
+ OR (geo = 'CY0' AND age = 'Y8')
+ OR (geo = 'CY00' AND age = 'Y8')
+ OR (geo = 'LV' AND age = 'Y8')
+ OR (geo = 'LV0' AND age = 'Y8')
+ OR (geo = 'LV00' AND age = 'Y8')
+ OR (geo = 'LT' AND age = 'Y8')
+ OR (geo = 'LT0' AND age = 'Y8')
+ OR (geo = 'LT01' AND age = 'Y8')
+ OR (geo = 'LT02' AND age = 'Y8')
+ OR (geo = 'LU' AND age = 'Y8')
+ OR (geo = 'LU0' AND age = 'Y8')
+ OR (geo = 'LU00' AND age = 'Y8')
+ OR (geo = 'HU' AND age = 'Y8')
+ OR (geo = 'HU1' AND age = 'Y8')
+ OR (geo = 'HU11' AND age = 'Y8')
+ OR (geo = 'HU12' AND age = 'Y8')
+ OR (geo = 'HU2' AND age = 'Y8')
+ OR (geo = 'HU21' AND age = 'Y8')
+ OR (geo = 'HU22' AND age = 'Y8')
+ OR (geo = 'HU23' AND age = 'Y8')
+ OR (geo = 'HU3' AND age = 'Y8')
+ OR (geo = 'HU31' AND age = 'Y8')
+ OR (geo = 'HU32' AND age = 'Y8')
+ OR (geo = 'HU33' AND age = 'Y8')
+ OR (geo = 'HUX' AND age = 'Y8')
+ OR (geo = 'HUXX' AND age = 'Y8')
+ OR (geo = 'MT' AND age = 'Y8')
+ OR (geo = 'MT0' AND age = 'Y8')
+ OR (geo = 'MT00' AND age = 'Y8')
+ OR (geo = 'NL' AND age = 'Y8')
+ OR (geo = 'NL1' AND age = 'Y8')
+ OR (geo = 'NL11' AND age = 'Y8')
+ OR (geo = 'NL12' AND age = 'Y8')
+ OR (geo = 'NL13' AND age = 'Y8')
+ OR (geo = 'NL2' AND age = 'Y8')
+ OR (geo = 'NL21' AND age = 'Y8')
+ OR (geo = 'NL22' AND age = 'Y8')
+ OR (geo = 'NL23' AND age = 'Y8')
+ OR (geo = 'NL3' AND age = 'Y8')
+ OR (geo = 'NL31' AND age = 'Y8')
+ OR (geo = 'NL32' AND age = 'Y8')
+ OR (geo = 'NL33' AND age = 'Y8')
+ OR (geo = 'NL34' AND age = 'Y8')
+ OR (geo = 'NL35' AND age = 'Y8')
+ OR (geo = 'NL36' AND age = 'Y8')
+ OR (geo = 'NL4' AND age = 'Y8')
+ OR (geo = 'NL41' AND age = 'Y8')
+ OR (geo = 'NL42' AND age = 'Y8')
+ OR (geo = 'AT' AND age = 'Y8')
+ OR (geo = 'AT1' AND age = 'Y8')
+ OR (geo = 'AT11' AND age = 'Y8')
+ OR (geo = 'AT12' AND age = 'Y8')
+ OR (geo = 'AT13' AND age = 'Y8')
+ OR (geo = 'AT2' AND age = 'Y8')
+ OR (geo = 'AT21' AND age = 'Y8')
+ OR (geo = 'AT22' AND age = 'Y8')
+ OR (geo = 'AT3' AND age = 'Y8')
+ OR (geo = 'AT31' AND age = 'Y8')
+ OR (geo = 'AT32' AND age = 'Y8')
+ OR (geo = 'AT33' AND age = 'Y8')
+ OR (geo = 'AT34' AND age = 'Y8')
+ OR (geo = 'PL' AND age = 'Y8')
+ OR (geo = 'PL2' AND age = 'Y8')
+ OR (geo = 'PL21' AND age = 'Y8')
+ OR (geo = 'PL22' AND age = 'Y8')
+ OR (geo = 'PL4' AND age = 'Y8')
+ OR (geo = 'PL41' AND age = 'Y8')
+ OR (geo = 'PL42' AND age = 'Y8')
+ OR (geo = 'PL43' AND age = 'Y8')
+ OR (geo = 'PL5' AND age = 'Y8')
+ OR (geo = 'PL51' AND age = 'Y8')
+ OR (geo = 'PL52' AND age = 'Y8')
+ OR (geo = 'PL6' AND age = 'Y8')
+ OR (geo = 'PL61' AND age = 'Y8')
+ OR (geo = 'PL62' AND age = 'Y8')
+ OR (geo = 'PL63' AND age = 'Y8')
+ OR (geo = 'PL7' AND age = 'Y8')
+ OR (geo = 'PL71' AND age = 'Y8')
+ OR (geo = 'PL72' AND age = 'Y8')
+);
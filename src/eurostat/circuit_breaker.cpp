@@ -0,0 +1,76 @@
+#include "circuit_breaker.hpp"
+
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Number of consecutive failures opening the circuit of an endpoint
+static constexpr idx_t FAILURE_THRESHOLD = 3;
+
+// Interval the circuit stays open before a trial request, doubled after each failed trial
+static constexpr auto MIN_OPEN_INTERVAL = std::chrono::milliseconds(5000);
+static constexpr auto MAX_OPEN_INTERVAL = std::chrono::milliseconds(120000);
+
+// A trial request without outcome after this interval (e.g. canceled) lets another one through
+static constexpr auto TRIAL_TIMEOUT = std::chrono::milliseconds(120000);
+
+//======================================================================================================================
+// CircuitBreaker Implementation
+//======================================================================================================================
+
+CircuitBreaker &CircuitBreaker::Get() {
+	static CircuitBreaker instance;
+	return instance;
+}
+
+bool CircuitBreaker::AllowRequest(const string &endpoint, string &error) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto it = endpoints.find(endpoint);
+
+	if (it == endpoints.end() || it->second.state == State::CLOSED) {
+		return true;
+	}
+	auto &state = it->second;
+	const auto now = std::chrono::steady_clock::now();
+	const auto interval = state.state == State::OPEN ? state.open_interval : TRIAL_TIMEOUT;
+
+	// Let a trial request through once the interval is elapsed.
+	if (now - state.opened_at >= interval) {
+		state.state = State::HALF_OPEN;
+		state.opened_at = now;
+		return true;
+	}
+
+	const auto retry_ms = std::chrono::duration_cast<std::chrono::milliseconds>(interval - (now - state.opened_at));
+	error = StringUtil::Format(
+	    "EUROSTAT: Endpoint '%s' is unavailable after %d consecutive failures, retrying in %.1f s.", endpoint,
+	    state.failures, static_cast<double>(retry_ms.count()) / 1000.0);
+	return false;
+}
+
+void CircuitBreaker::Record(const string &endpoint, bool failed) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (!failed) {
+		endpoints.erase(endpoint);
+		return;
+	}
+	auto &state = endpoints[endpoint];
+	state.failures++;
+
+	if (state.state == State::HALF_OPEN) {
+		state.state = State::OPEN;
+		state.opened_at = std::chrono::steady_clock::now();
+		state.open_interval = MinValue(state.open_interval * 2, MAX_OPEN_INTERVAL);
+	} else if (state.state == State::CLOSED && state.failures >= FAILURE_THRESHOLD) {
+		state.state = State::OPEN;
+		state.opened_at = std::chrono::steady_clock::now();
+		state.open_interval = MIN_OPEN_INTERVAL;
+	}
+}
+
+} // namespace duckdb
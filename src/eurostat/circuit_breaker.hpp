@@ -0,0 +1,39 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+//! Circuit breaker per endpoint (API URL of a provider, several providers share a host), to fail fast when an endpoint
+//! is down instead of waiting for the timeout of every request. The circuit opens after consecutive failures
+//! (unreachable host, timeouts, gateway errors), requests are rejected at once while it is open, then a single trial
+//! request is let through (half-open): its success closes the circuit, its failure opens it again for a longer
+//! interval. The state is shared by all the requests of the process.
+class CircuitBreaker {
+public:
+	static CircuitBreaker &Get();
+
+	//! Whether a request to the endpoint can be sent, otherwise the error to return at once.
+	bool AllowRequest(const string &endpoint, string &error);
+	//! Record the outcome of a request sent to the endpoint.
+	void Record(const string &endpoint, bool failed);
+
+private:
+	enum class State : uint8_t { CLOSED, OPEN, HALF_OPEN };
+
+	struct EndpointState {
+		State state = State::CLOSED;
+		idx_t failures = 0;
+		//! When the circuit was opened (or the trial request sent), and for how long it stays open.
+		std::chrono::steady_clock::time_point opened_at;
+		std::chrono::milliseconds open_interval {0};
+	};
+
+	std::mutex lock;
+	std::unordered_map<string, EndpointState> endpoints;
+};
+
+} // namespace duckdb
@@ -0,0 +1,140 @@
+#include "concurrency_controller.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include <algorithm>
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Initial limit of concurrent requests to a host
+static constexpr double INITIAL_CONCURRENCY_LIMIT = 4.0;
+
+// Latency is considered flat while it stays under this factor of the baseline
+static constexpr double LATENCY_TOLERANCE = 2.0;
+
+// Baseline latency slowly drifts up, so it follows permanent changes of the host
+static constexpr double LATENCY_BASELINE_DRIFT = 1.01;
+
+// Min interval between two multiplicative decreases, requests in flight fail together when the host is overloaded
+static constexpr auto DECREASE_INTERVAL = std::chrono::milliseconds(1000);
+
+// Number of recent latencies kept per host, and min number of them to compute the hedging delay
+static constexpr idx_t LATENCY_SAMPLES = 128;
+static constexpr idx_t MIN_LATENCY_SAMPLES = 16;
+
+// Percentile of the recent latencies used as hedging delay, with a lower bound in milliseconds
+static constexpr double HEDGE_PERCENTILE = 0.95;
+static constexpr double MIN_HEDGE_DELAY_MS = 100.0;
+
+// No hedging for a while after the host throttled us
+static constexpr auto HEDGE_BACKOFF_INTERVAL = std::chrono::milliseconds(10000);
+
+//======================================================================================================================
+// ConcurrencyController Implementation
+//======================================================================================================================
+
+ConcurrencyController &ConcurrencyController::Get() {
+	static ConcurrencyController instance;
+	return instance;
+}
+
+ConcurrencyController::HostState &ConcurrencyController::GetState(const string &host, idx_t max_limit) {
+	auto it = hosts.find(host);
+
+	if (it == hosts.end()) {
+		HostState state;
+		state.limit = MinValue<double>(INITIAL_CONCURRENCY_LIMIT, MaxValue<idx_t>(max_limit, 1));
+		state.min_latency = 0.0;
+		state.last_decrease = std::chrono::steady_clock::time_point();
+		it = hosts.emplace(host, state).first;
+	}
+	return it->second;
+}
+
+idx_t ConcurrencyController::GetLimit(const string &host, idx_t max_limit) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto &state = GetState(host, max_limit);
+
+	return MaxValue<idx_t>(1, MinValue<idx_t>(static_cast<idx_t>(state.limit), max_limit));
+}
+
+string ConcurrencyController::Update(const string &host, RequestOutcome outcome, const string &cause,
+                                     double latency_ms, idx_t in_flight, idx_t max_limit) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto &state = GetState(host, max_limit);
+
+	const auto old_limit = static_cast<idx_t>(state.limit);
+	const auto now = std::chrono::steady_clock::now();
+	string reason;
+
+	switch (outcome) {
+	case RequestOutcome::THROTTLED:
+		// Multiplicative decrease.
+		if (now - state.last_decrease >= DECREASE_INTERVAL) {
+			state.limit = MaxValue(1.0, state.limit / 2.0);
+			state.last_decrease = now;
+			reason = "decrease, " + cause;
+		}
+		break;
+
+	case RequestOutcome::SUCCESS:
+		if (state.latencies.size() < LATENCY_SAMPLES) {
+			state.latencies.push_back(latency_ms);
+		} else {
+			state.latencies[state.next_latency] = latency_ms;
+		}
+		state.next_latency = (state.next_latency + 1) % LATENCY_SAMPLES;
+
+		if (state.min_latency <= 0.0 || latency_ms < state.min_latency) {
+			state.min_latency = latency_ms;
+		} else {
+			state.min_latency = MinValue(latency_ms, state.min_latency * LATENCY_BASELINE_DRIFT);
+		}
+
+		if (latency_ms > state.min_latency * LATENCY_TOLERANCE) {
+			// The host queues our requests, back off gently.
+			state.limit = MaxValue(1.0, state.limit - 1.0 / state.limit);
+			reason = StringUtil::Format("decrease, latency rising (%.0f ms)", latency_ms);
+
+		} else if (in_flight >= old_limit) {
+			// Additive increase, only when the limit is what bounds the requests in flight.
+			state.limit = MinValue<double>(static_cast<double>(max_limit), state.limit + 1.0 / state.limit);
+			reason = StringUtil::Format("increase, latency flat (%.0f ms)", latency_ms);
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return static_cast<idx_t>(state.limit) != old_limit ? reason : string();
+}
+
+bool ConcurrencyController::GetHedgeDelay(const string &host, double &delay_ms) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	auto it = hosts.find(host);
+	if (it == hosts.end()) {
+		return false;
+	}
+	auto &state = it->second;
+
+	if (state.latencies.size() < MIN_LATENCY_SAMPLES) {
+		return false;
+	}
+	if (std::chrono::steady_clock::now() - state.last_decrease < HEDGE_BACKOFF_INTERVAL) {
+		return false;
+	}
+
+	auto latencies = state.latencies;
+	const auto index = static_cast<idx_t>(HEDGE_PERCENTILE * static_cast<double>(latencies.size() - 1));
+	std::nth_element(latencies.begin(), latencies.begin() + static_cast<int64_t>(index), latencies.end());
+
+	delay_ms = MaxValue(MIN_HEDGE_DELAY_MS, latencies[index]);
+	return true;
+}
+
+} // namespace duckdb
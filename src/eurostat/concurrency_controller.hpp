@@ -0,0 +1,52 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+//! Outcome of a request, as seen by the concurrency controller.
+enum class RequestOutcome : uint8_t {
+	SUCCESS,   // Response received, its latency is considered
+	THROTTLED, // Throttling response (429, 503) or timeout
+	FAILED     // Other errors, they do not change the limit
+};
+
+//! Adaptive limit of concurrent requests per host (AIMD). The limit grows by about one request per window of
+//! successful requests while the latency (time to first byte) stays flat, and it is halved on throttling responses
+//! or timeouts. The state is shared by all the scans of the process.
+class ConcurrencyController {
+public:
+	static ConcurrencyController &Get();
+
+	//! Current limit of concurrent requests to the host.
+	idx_t GetLimit(const string &host, idx_t max_limit);
+	//! Update the limit of the host with the outcome of a request, returns the reason of the change (empty if the
+	//! limit did not change).
+	string Update(const string &host, RequestOutcome outcome, const string &cause, double latency_ms, idx_t in_flight,
+	              idx_t max_limit);
+	//! Delay after which a request to the host that has not received its first bytes can be hedged: a high
+	//! percentile of the recent latencies. Returns false when hedging is not advisable (too few samples, or the
+	//! host is throttling us).
+	bool GetHedgeDelay(const string &host, double &delay_ms);
+
+private:
+	struct HostState {
+		double limit;
+		//! Baseline latency, the lowest recent time to first byte.
+		double min_latency;
+		std::chrono::steady_clock::time_point last_decrease;
+		//! Recent latencies (ring buffer), to compute the hedging delay.
+		vector<double> latencies;
+		idx_t next_latency = 0;
+	};
+
+	HostState &GetState(const string &host, idx_t max_limit);
+
+	std::mutex lock;
+	std::unordered_map<string, HostState> hosts;
+};
+
+} // namespace duckdb
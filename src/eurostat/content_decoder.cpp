@@ -0,0 +1,327 @@
+#include "content_decoder.hpp"
+
+#include "duckdb/common/allocator.hpp"
+#include "miniz.hpp"
+#include "zstd.h"
+#include <cstring>
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Size of the output buffer of the decompressors and of the compressor
+static constexpr idx_t DECODER_BUFFER_SIZE = 256 * 1024;
+
+// GZip magic number and header flags (RFC 1952)
+static constexpr uint8_t GZIP_MAGIC_1 = 0x1F;
+static constexpr uint8_t GZIP_MAGIC_2 = 0x8B;
+static constexpr uint8_t GZIP_METHOD_DEFLATE = 0x08;
+static constexpr uint8_t GZIP_FLAG_HCRC = 0x02;
+static constexpr uint8_t GZIP_FLAG_EXTRA = 0x04;
+static constexpr uint8_t GZIP_FLAG_NAME = 0x08;
+static constexpr uint8_t GZIP_FLAG_COMMENT = 0x10;
+
+// Zstd magic number: 0xFD2FB528 (little-endian: 28 B5 2F FD)
+static constexpr uint8_t ZSTD_MAGIC_1 = 0x28;
+static constexpr uint8_t ZSTD_MAGIC_2 = 0xB5;
+static constexpr uint8_t ZSTD_MAGIC_3 = 0x2F;
+static constexpr uint8_t ZSTD_MAGIC_4 = 0xFD;
+
+//======================================================================================================================
+// ContentDecoder Implementation
+//======================================================================================================================
+
+ContentDecoder::ContentDecoder(HttpContentReceiver receiver_p, Allocator &allocator)
+    : receiver(std::move(receiver_p)), allocator(allocator), encoding(Encoding::UNKNOWN), header_done(false),
+      finished(false), stream_ended(false), gzip_stream(nullptr), zstd_stream(nullptr) {
+}
+
+ContentDecoder::~ContentDecoder() {
+	if (gzip_stream) {
+		auto stream = static_cast<duckdb_miniz::mz_stream *>(gzip_stream);
+		duckdb_miniz::mz_inflateEnd(stream);
+		delete stream;
+	}
+	if (zstd_stream) {
+		duckdb_zstd::ZSTD_freeDStream(static_cast<duckdb_zstd::ZSTD_DStream *>(zstd_stream));
+	}
+}
+
+bool ContentDecoder::DetectEncoding(const char *data, idx_t data_length) {
+	if (data_length < 4) {
+		return false;
+	}
+	auto bytes = reinterpret_cast<const uint8_t *>(data);
+
+	if (bytes[0] == GZIP_MAGIC_1 && bytes[1] == GZIP_MAGIC_2) {
+		encoding = Encoding::GZIP;
+	} else if (bytes[0] == ZSTD_MAGIC_1 && bytes[1] == ZSTD_MAGIC_2 && bytes[2] == ZSTD_MAGIC_3 &&
+	           bytes[3] == ZSTD_MAGIC_4) {
+		encoding = Encoding::ZSTD;
+	} else {
+		encoding = Encoding::IDENTITY;
+	}
+	return true;
+}
+
+idx_t ContentDecoder::ReadGZipHeader(const char *data, idx_t data_length) {
+	auto bytes = reinterpret_cast<const uint8_t *>(data);
+
+	if (data_length < 10) {
+		return 0;
+	}
+	if (bytes[2] != GZIP_METHOD_DEFLATE) {
+		throw IOException("Unsupported GZip compression method");
+	}
+
+	const uint8_t flags = bytes[3];
+	idx_t pos = 10;
+
+	if (flags & GZIP_FLAG_EXTRA) {
+		if (pos + 2 > data_length) {
+			return 0;
+		}
+		pos += 2 + (bytes[pos] | (bytes[pos + 1] << 8));
+	}
+	for (const auto flag : {GZIP_FLAG_NAME, GZIP_FLAG_COMMENT}) {
+		if (flags & flag) {
+			while (pos < data_length && bytes[pos] != 0) {
+				pos++;
+			}
+			pos++;
+		}
+	}
+	if (flags & GZIP_FLAG_HCRC) {
+		pos += 2;
+	}
+	return pos <= data_length ? pos : 0;
+}
+
+bool ContentDecoder::WriteGZip(const char *data, idx_t data_length) {
+	// Skip the GZip member header.
+
+	if (!header_done) {
+		// Avoid copying the content when the whole header is in this chunk.
+		if (header.empty() && ReadGZipHeader(data, data_length) == 0) {
+			header.append(data, data_length);
+			return true;
+		}
+		if (!header.empty()) {
+			header.append(data, data_length);
+		}
+		const char *content = header.empty() ? data : header.data();
+		const idx_t content_length = header.empty() ? data_length : header.size();
+
+		auto header_size = ReadGZipHeader(content, content_length);
+		if (header_size == 0) {
+			return true;
+		}
+		header_done = true;
+
+		auto stream = new duckdb_miniz::mz_stream();
+		memset(stream, 0, sizeof(duckdb_miniz::mz_stream));
+		gzip_stream = stream;
+
+		auto status = duckdb_miniz::mz_inflateInit2(stream, -MZ_DEFAULT_WINDOW_BITS);
+		if (status != duckdb_miniz::MZ_OK) {
+			throw IOException("Failed to initialize GZip decoder: %s", duckdb_miniz::mz_error(status));
+		}
+
+		if (header.empty()) {
+			return WriteGZip(data + header_size, data_length - header_size);
+		}
+		string remaining = header.substr(header_size);
+		header.clear();
+		return WriteGZip(remaining.data(), remaining.size());
+	}
+
+	auto stream = static_cast<duckdb_miniz::mz_stream *>(gzip_stream);
+
+	// End of the deflate stream, ignore the trailer.
+	if (!stream) {
+		return true;
+	}
+
+	stream->next_in = reinterpret_cast<const unsigned char *>(data);
+	stream->avail_in = static_cast<unsigned int>(data_length);
+
+	do {
+		stream->next_out = buffer.get();
+		stream->avail_out = static_cast<unsigned int>(buffer.GetSize());
+
+		auto status = duckdb_miniz::mz_inflate(stream, duckdb_miniz::MZ_NO_FLUSH);
+		if (status != duckdb_miniz::MZ_OK && status != duckdb_miniz::MZ_STREAM_END &&
+		    status != duckdb_miniz::MZ_BUF_ERROR) {
+			throw IOException("Failed to decode GZip content: %s", duckdb_miniz::mz_error(status));
+		}
+
+		auto produced = buffer.GetSize() - stream->avail_out;
+		if (produced > 0 && !receiver(reinterpret_cast<const char *>(buffer.get()), produced)) {
+			finished = true;
+			return false;
+		}
+		if (status == duckdb_miniz::MZ_STREAM_END) {
+			duckdb_miniz::mz_inflateEnd(stream);
+			delete stream;
+			gzip_stream = nullptr;
+			stream_ended = true;
+			return true;
+		}
+		if (produced == 0 && status == duckdb_miniz::MZ_BUF_ERROR) {
+			break;
+		}
+	} while (stream->avail_in > 0 || stream->avail_out == 0);
+
+	return true;
+}
+
+bool ContentDecoder::WriteZstd(const char *data, idx_t data_length) {
+	if (!zstd_stream) {
+		auto stream = duckdb_zstd::ZSTD_createDStream();
+		duckdb_zstd::ZSTD_initDStream(stream);
+		zstd_stream = stream;
+	}
+	auto stream = static_cast<duckdb_zstd::ZSTD_DStream *>(zstd_stream);
+
+	duckdb_zstd::ZSTD_inBuffer input = {data, data_length, 0};
+	duckdb_zstd::ZSTD_outBuffer output = {nullptr, 0, 0};
+
+	do {
+		output = {buffer.get(), buffer.GetSize(), 0};
+
+		auto status = duckdb_zstd::ZSTD_decompressStream(stream, &output, &input);
+		if (duckdb_zstd::ZSTD_isError(status)) {
+			throw IOException("Failed to decode Zstd content: %s", duckdb_zstd::ZSTD_getErrorName(status));
+		}
+		// Zero once a whole frame was decoded and flushed.
+		stream_ended = status == 0;
+		if (output.pos > 0 && !receiver(reinterpret_cast<const char *>(buffer.get()), output.pos)) {
+			finished = true;
+			return false;
+		}
+	} while (input.pos < input.size || output.pos == output.size);
+
+	return true;
+}
+
+bool ContentDecoder::Write(const char *data, idx_t data_length) {
+	if (finished) {
+		return false;
+	}
+
+	// Wait for the first bytes to detect the encoding.
+
+	if (encoding == Encoding::UNKNOWN) {
+		if (header.empty() && DetectEncoding(data, data_length)) {
+			return Write(data, data_length);
+		}
+		header.append(data, data_length);
+
+		if (!DetectEncoding(header.data(), header.size())) {
+			return true;
+		}
+		string content = std::move(header);
+		header.clear();
+		return Write(content.data(), content.size());
+	}
+
+	if (encoding != Encoding::IDENTITY && !buffer.get()) {
+		buffer = allocator.Allocate(DECODER_BUFFER_SIZE);
+	}
+
+	switch (encoding) {
+	case Encoding::GZIP:
+		return WriteGZip(data, data_length);
+	case Encoding::ZSTD:
+		return WriteZstd(data, data_length);
+	default:
+		if (!receiver(data, data_length)) {
+			finished = true;
+			return false;
+		}
+		return true;
+	}
+}
+
+void ContentDecoder::Finish() {
+	// Content too short to detect any encoding, send it as is.
+	if (encoding == Encoding::UNKNOWN && !header.empty() && !finished) {
+		encoding = Encoding::IDENTITY;
+		receiver(header.data(), header.size());
+		header.clear();
+	}
+	// Content stopped before the end of its compressed stream (e.g. a dropped connection).
+	if ((encoding == Encoding::GZIP || encoding == Encoding::ZSTD) && !finished && !stream_ended) {
+		throw IOException("Truncated %s content, the end of the compressed stream is missing",
+		                  encoding == Encoding::GZIP ? "GZip" : "Zstd");
+	}
+}
+
+string ContentDecoder::Decode(string &&content, Allocator &allocator) {
+	string result;
+
+	try {
+		ContentDecoder decoder(
+		    [&](const char *data, size_t data_length) {
+			    result.append(data, data_length);
+			    return true;
+		    },
+		    allocator);
+
+		decoder.Write(content.data(), content.size());
+		decoder.Finish();
+	} catch (...) {
+		return std::move(content);
+	}
+	return result;
+}
+
+//======================================================================================================================
+// ContentEncoder Implementation
+//======================================================================================================================
+
+ContentEncoder::ContentEncoder(HttpContentReceiver receiver_p, int level, Allocator &allocator)
+    : receiver(std::move(receiver_p)) {
+	buffer = allocator.Allocate(DECODER_BUFFER_SIZE);
+
+	auto context = duckdb_zstd::ZSTD_createCCtx();
+	duckdb_zstd::ZSTD_CCtx_setParameter(context, duckdb_zstd::ZSTD_c_compressionLevel, level);
+	zstd_context = context;
+}
+
+ContentEncoder::~ContentEncoder() {
+	duckdb_zstd::ZSTD_freeCCtx(static_cast<duckdb_zstd::ZSTD_CCtx *>(zstd_context));
+}
+
+void ContentEncoder::Compress(const char *data, idx_t data_length, bool end) {
+	auto context = static_cast<duckdb_zstd::ZSTD_CCtx *>(zstd_context);
+	duckdb_zstd::ZSTD_inBuffer input = {data, data_length, 0};
+
+	while (true) {
+		duckdb_zstd::ZSTD_outBuffer output = {buffer.get(), buffer.GetSize(), 0};
+
+		const auto mode = end ? duckdb_zstd::ZSTD_e_end : duckdb_zstd::ZSTD_e_continue;
+		auto remaining = duckdb_zstd::ZSTD_compressStream2(context, &output, &input, mode);
+		if (duckdb_zstd::ZSTD_isError(remaining)) {
+			throw IOException("Failed to encode Zstd content: %s", duckdb_zstd::ZSTD_getErrorName(remaining));
+		}
+		if (output.pos > 0) {
+			receiver(reinterpret_cast<const char *>(buffer.get()), output.pos);
+		}
+		if (end ? remaining == 0 : input.pos == input.size) {
+			break;
+		}
+	}
+}
+
+void ContentEncoder::Write(const char *data, idx_t data_length) {
+	Compress(data, data_length, false);
+}
+
+void ContentEncoder::Finish() {
+	Compress(nullptr, 0, true);
+}
+
+} // namespace duckdb
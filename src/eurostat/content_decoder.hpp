@@ -0,0 +1,79 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! Callback to receive chunks of a response body, returns false to stop receiving more data.
+using HttpContentReceiver = std::function<bool(const char *data, size_t data_length)>;
+
+//! Incremental decoder of a (optionally GZip or Zstd compressed) content.
+//! Compression is detected by the magic number of the first bytes, decoded data is sent to the receiver.
+class ContentDecoder {
+public:
+	explicit ContentDecoder(HttpContentReceiver receiver, Allocator &allocator = Allocator::DefaultAllocator());
+	~ContentDecoder();
+
+public:
+	//! Decode a chunk of content, returns false when the receiver does not want more data.
+	bool Write(const char *data, idx_t data_length);
+	//! Flush pending data after the last chunk, throws if a compressed content is truncated.
+	void Finish();
+
+	//! Decode a whole content, returns it as is when it can not be decoded.
+	static string Decode(string &&content, Allocator &allocator = Allocator::DefaultAllocator());
+
+private:
+	enum class Encoding : uint8_t { UNKNOWN, IDENTITY, GZIP, ZSTD };
+
+	//! Detect the encoding from the first bytes of the content.
+	bool DetectEncoding(const char *data, idx_t data_length);
+	//! Skip the GZip member header, returns the number of bytes consumed (0 if more bytes are needed).
+	idx_t ReadGZipHeader(const char *data, idx_t data_length);
+
+	bool WriteGZip(const char *data, idx_t data_length);
+	bool WriteZstd(const char *data, idx_t data_length);
+
+private:
+	HttpContentReceiver receiver;
+	Allocator &allocator;
+	Encoding encoding;
+	//! First bytes of the content, kept until the encoding (and GZip header) can be determined.
+	string header;
+	bool header_done;
+	bool finished;
+	//! The end of the compressed stream was decoded (a truncated content never reaches it).
+	bool stream_ended;
+	//! Output buffer of the decompressor.
+	AllocatedData buffer;
+	//! Decompressor streams.
+	void *gzip_stream;
+	void *zstd_stream;
+};
+
+//! Incremental Zstd encoder of a content, at a fast level by default (cached responses are encoded while received).
+//! Encoded data is sent to the receiver.
+class ContentEncoder {
+public:
+	explicit ContentEncoder(HttpContentReceiver receiver, int level = 1,
+	                        Allocator &allocator = Allocator::DefaultAllocator());
+	~ContentEncoder();
+
+public:
+	//! Encode a chunk of content.
+	void Write(const char *data, idx_t data_length);
+	//! Flush the end of the Zstd frame after the last chunk.
+	void Finish();
+
+private:
+	void Compress(const char *data, idx_t data_length, bool end);
+
+private:
+	HttpContentReceiver receiver;
+	//! Output buffer of the compressor.
+	AllocatedData buffer;
+	//! Compressor context.
+	void *zstd_context;
+};
+
+} // namespace duckdb
@@ -0,0 +1,593 @@
+#include "curl_http_client.hpp"
+
+#ifndef __EMSCRIPTEN__
+
+#include "duckdb/common/http_util.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "circuit_breaker.hpp"
+#include "concurrency_controller.hpp"
+#include "request_scheduler.hpp"
+#include <atomic>
+#include <chrono>
+#include <curl/curl.h>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Max number of connections per host, requests are multiplexed over them with HTTP/2
+static constexpr long CURL_MAX_HOST_CONNECTIONS = 2;
+
+// Max time to wait for activity on the sockets of the transfers, in milliseconds (shorter with hedging, to notice
+// the slow requests in time)
+static constexpr int CURL_POLL_TIMEOUT_MS = 1000;
+static constexpr int CURL_HEDGING_POLL_TIMEOUT_MS = 20;
+
+// Max time to wait before retrying to start transfers waiting for a request slot of the scheduler, in milliseconds
+static constexpr int CURL_SLOT_POLL_TIMEOUT_MS = 50;
+
+//! Share of the DNS cache, TLS sessions and connections between all transfers of the process.
+class CurlShare {
+public:
+	static CURLSH *Get() {
+		// Never released, transfers may still run while static objects are destroyed at exit.
+		static auto instance = new CurlShare();
+		return instance->handle;
+	}
+
+private:
+	CurlShare() {
+		curl_global_init(CURL_GLOBAL_DEFAULT);
+
+		handle = curl_share_init();
+		curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+		curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+		curl_share_setopt(handle, CURLSHOPT_LOCKFUNC, Lock);
+		curl_share_setopt(handle, CURLSHOPT_UNLOCKFUNC, Unlock);
+		curl_share_setopt(handle, CURLSHOPT_USERDATA, this);
+	}
+
+	static void Lock(CURL *, curl_lock_data data, curl_lock_access, void *userptr) {
+		static_cast<CurlShare *>(userptr)->locks[data].lock();
+	}
+	static void Unlock(CURL *, curl_lock_data data, void *userptr) {
+		static_cast<CurlShare *>(userptr)->locks[data].unlock();
+	}
+
+	CURLSH *handle;
+	std::mutex locks[CURL_LOCK_DATA_LAST];
+};
+
+//! State of a transfer of the batch.
+struct CurlTransfer {
+	HttpStreamRequest &request;
+	string host;
+	//! Endpoint of the provider, its circuit breaker is not shared with the other providers of the host.
+	string endpoint;
+	CURL *easy;
+	curl_slist *header_list;
+	//! Priority class of the request, added transfers hold a request slot of the scheduler.
+	RequestPriority priority;
+	//! The easy handle was added to the multi handle, and when.
+	bool added;
+	std::chrono::steady_clock::time_point start_time;
+	//! Status and headers were sent to the response handler.
+	bool started;
+	bool stream_body;
+	//! The receiver did not want more data, or the caller canceled the requests.
+	bool canceled;
+	bool interrupted;
+	const std::atomic<bool> *cancel_flag;
+	string body;
+	HttpHeaders received_headers;
+	ContentDecoder decoder;
+
+	//! Hedged requests: the other transfer of the same request. The first one receiving its response wins and fills
+	//! the response of the request, the other one is lost and aborted.
+	CurlTransfer *sibling;
+	bool is_hedge;
+	bool winner;
+	bool lost;
+
+	CurlTransfer(HttpStreamRequest &request, Allocator &allocator)
+	    : request(request), host(HttpRequest::GetUrlHost(request.url)),
+	      endpoint(HttpRequest::GetUrlEndpoint(request.url)), easy(nullptr), header_list(nullptr),
+	      priority(RequestPriority::METADATA), added(false), started(false), stream_body(false), canceled(false),
+	      interrupted(false), cancel_flag(nullptr), decoder(request.content_receiver, allocator), sibling(nullptr),
+	      is_hedge(false), winner(false), lost(false) {
+	}
+	~CurlTransfer() {
+		if (easy) {
+			curl_easy_cleanup(easy);
+		}
+		if (header_list) {
+			curl_slist_free_all(header_list);
+		}
+	}
+
+	//! Try to become the transfer that fills the response of the request.
+	bool TryWin() {
+		if (winner) {
+			return true;
+		}
+		if (lost || (sibling && sibling->winner)) {
+			lost = true;
+			return false;
+		}
+		winner = true;
+		if (sibling) {
+			sibling->lost = true;
+		}
+		return true;
+	}
+
+	//! Read the status of the response and ask the handler if the body has to be streamed.
+	void Start() {
+		auto &response = request.response;
+		started = true;
+
+		if (!TryWin()) {
+			return;
+		}
+		response.headers = std::move(received_headers);
+
+		long status_code = 0;
+		curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status_code);
+		response.status_code = static_cast<int32_t>(status_code);
+
+		char *content_type = nullptr;
+		curl_easy_getinfo(easy, CURLINFO_CONTENT_TYPE, &content_type);
+		response.content_type = content_type ? content_type : "";
+
+		curl_off_t content_length = -1;
+		curl_easy_getinfo(easy, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length);
+		response.content_length = content_length;
+
+		stream_body = request.response_handler && request.response_handler(response);
+	}
+
+	//! Receive a chunk of the body, returns false to abort the transfer.
+	bool Write(const char *data, size_t data_length) {
+		if (!started) {
+			Start();
+		}
+		if (lost) {
+			return false;
+		}
+		if (!stream_body) {
+			body.append(data, data_length);
+			return true;
+		}
+		if (!decoder.Write(data, data_length)) {
+			canceled = true;
+			return false;
+		}
+		return true;
+	}
+
+	//! Complete the response once the transfer is done.
+	void Finish(CURLcode code, Allocator &allocator) {
+		auto &response = request.response;
+
+		if (lost) {
+			return;
+		}
+		if (interrupted) {
+			TryWin();
+			response.error = "HTTP request canceled";
+			return;
+		}
+		if (code != CURLE_OK && !(canceled && code == CURLE_WRITE_ERROR)) {
+			// Let the hedged sibling, still running, answer the request.
+			if (!winner && sibling && sibling->added && !sibling->lost) {
+				lost = true;
+				return;
+			}
+			TryWin();
+
+			if (response.error.empty()) {
+				response.error = string("HTTP request failed: ") + curl_easy_strerror(code);
+			}
+			return;
+		}
+		if (!started) {
+			Start();
+		}
+		if (lost) {
+			return;
+		}
+		if (stream_body && !canceled) {
+			decoder.Finish();
+		}
+
+		// Auto-decompress the body that was not streamed
+		response.body = ContentDecoder::Decode(std::move(body), allocator);
+	}
+
+	static size_t WriteCallback(char *data, size_t size, size_t nmemb, void *userdata) {
+		auto &transfer = *static_cast<CurlTransfer *>(userdata);
+		const auto data_length = size * nmemb;
+
+		// Exceptions must not cross the C library, keep the error in the response.
+		try {
+			return transfer.Write(data, data_length) ? data_length : 0;
+		} catch (std::exception &e) {
+			transfer.request.response.error = e.what();
+			return 0;
+		}
+	}
+
+	//! Called by curl about once per second even without any data (e.g. waiting for the first bytes), aborts the
+	//! transfer when the caller canceled the requests.
+	static int ProgressCallback(void *userdata, curl_off_t, curl_off_t, curl_off_t, curl_off_t) {
+		auto &transfer = *static_cast<CurlTransfer *>(userdata);
+
+		if (transfer.cancel_flag && *transfer.cancel_flag) {
+			transfer.interrupted = true;
+			return 1;
+		}
+		return 0;
+	}
+
+	static size_t HeaderCallback(char *data, size_t size, size_t nmemb, void *userdata) {
+		auto &transfer = *static_cast<CurlTransfer *>(userdata);
+		const auto data_length = size * nmemb;
+		const string line(data, data_length);
+
+		// A new status line starts the headers of a new response (e.g. after a redirect).
+		if (StringUtil::StartsWith(line, "HTTP/")) {
+			transfer.received_headers.clear();
+			return data_length;
+		}
+		auto pos = line.find(':');
+		if (pos != string::npos) {
+			auto key = line.substr(0, pos);
+			auto value = line.substr(pos + 1);
+			StringUtil::Trim(value);
+			transfer.received_headers[key] = value;
+		}
+		return data_length;
+	}
+
+	//! Create the easy handle of the transfer.
+	void Initialize(const HttpSettings &settings) {
+		priority = settings.priority;
+
+		easy = curl_easy_init();
+		if (!easy) {
+			throw IOException("Failed to initialize a curl transfer");
+		}
+		curl_easy_setopt(easy, CURLOPT_URL, request.url.c_str());
+		curl_easy_setopt(easy, CURLOPT_SHARE, CurlShare::Get());
+		curl_easy_setopt(easy, CURLOPT_PRIVATE, this);
+		curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+		curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, WriteCallback);
+		curl_easy_setopt(easy, CURLOPT_WRITEDATA, this);
+
+		if (settings.canceled) {
+			cancel_flag = settings.canceled;
+			curl_easy_setopt(easy, CURLOPT_XFERINFOFUNCTION, ProgressCallback);
+			curl_easy_setopt(easy, CURLOPT_XFERINFODATA, this);
+			curl_easy_setopt(easy, CURLOPT_NOPROGRESS, 0L);
+		}
+
+		if (request.read_headers) {
+			curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, HeaderCallback);
+			curl_easy_setopt(easy, CURLOPT_HEADERDATA, this);
+		}
+
+		// Wait for a connection to multiplex on rather than opening a new one.
+		curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+
+		curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, settings.follow_redirects ? 1L : 0L);
+		curl_easy_setopt(easy, CURLOPT_SSL_VERIFYPEER, 0L);
+		curl_easy_setopt(easy, CURLOPT_SSL_VERIFYHOST, 0L);
+		curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, settings.keep_alive ? 1L : 0L);
+
+		// Same semantics than the read timeout of httplib, abort when no data is received for 'timeout' seconds.
+		const auto timeout_sec = static_cast<long>(settings.timeout);
+		curl_easy_setopt(easy, CURLOPT_CONNECTTIMEOUT, timeout_sec);
+		curl_easy_setopt(easy, CURLOPT_LOW_SPEED_LIMIT, 1L);
+		curl_easy_setopt(easy, CURLOPT_LOW_SPEED_TIME, timeout_sec);
+
+		if (!settings.proxy.empty()) {
+			string proxy_host;
+			idx_t proxy_port = settings.proxy_port > 0 ? settings.proxy_port : 80;
+			string proxy_copy = settings.proxy;
+			HTTPUtil::ParseHTTPProxyHost(proxy_copy, proxy_host, proxy_port);
+			curl_easy_setopt(easy, CURLOPT_PROXY, proxy_host.c_str());
+			curl_easy_setopt(easy, CURLOPT_PROXYPORT, static_cast<long>(proxy_port));
+			if (!settings.proxy_username.empty()) {
+				curl_easy_setopt(easy, CURLOPT_PROXYUSERNAME, settings.proxy_username.c_str());
+				curl_easy_setopt(easy, CURLOPT_PROXYPASSWORD, settings.proxy_password.c_str());
+			}
+		}
+
+		bool has_user_agent = false;
+		for (auto &h : request.headers) {
+			header_list = curl_slist_append(header_list, (h.first + ": " + h.second).c_str());
+			has_user_agent |= StringUtil::CIEquals(h.first, "User-Agent");
+		}
+		if (!has_user_agent) {
+			curl_easy_setopt(easy, CURLOPT_USERAGENT, settings.user_agent.c_str());
+		}
+		if (header_list) {
+			curl_easy_setopt(easy, CURLOPT_HTTPHEADER, header_list);
+		}
+	}
+};
+
+//! Multi handle of a batch, releases all transfers on destruction.
+struct CurlMulti {
+	CURLM *handle;
+	vector<unique_ptr<CurlTransfer>> transfers;
+
+	CurlMulti() : handle(curl_multi_init()) {
+		if (!handle) {
+			throw IOException("Failed to initialize a curl multi handle");
+		}
+	}
+	~CurlMulti() {
+		for (auto &transfer : transfers) {
+			if (transfer->added) {
+				curl_multi_remove_handle(handle, transfer->easy);
+				RequestScheduler::Get().Release(transfer->priority);
+			}
+		}
+		transfers.clear();
+		curl_multi_cleanup(handle);
+	}
+};
+
+//======================================================================================================================
+// CurlHttpClient Implementation
+//======================================================================================================================
+
+//! Classify the outcome of a completed transfer for the concurrency controller.
+static RequestOutcome GetRequestOutcome(CURLcode code, const CurlTransfer &transfer, string &cause) {
+	const auto status_code = transfer.request.response.status_code;
+
+	if (code == CURLE_OPERATION_TIMEDOUT) {
+		cause = "timeout";
+		return RequestOutcome::THROTTLED;
+	}
+	if (status_code == 429 || status_code == 503) {
+		cause = "HTTP " + std::to_string(status_code);
+		return RequestOutcome::THROTTLED;
+	}
+	if (code != CURLE_OK && !(transfer.canceled && code == CURLE_WRITE_ERROR)) {
+		return RequestOutcome::FAILED;
+	}
+	return RequestOutcome::SUCCESS;
+}
+
+void CurlHttpClient::StreamHttpRequests(const HttpSettings &settings, vector<HttpStreamRequest> &requests) {
+	if (requests.empty()) {
+		return;
+	}
+	auto &allocator = settings.allocator ? *settings.allocator : Allocator::DefaultAllocator();
+	auto &controller = ConcurrencyController::Get();
+	const auto max_limit = MaxValue<idx_t>(settings.max_concurrency, 1);
+
+	try {
+		CurlShare::Get();
+		CurlMulti multi;
+
+		curl_multi_setopt(multi.handle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+		curl_multi_setopt(multi.handle, CURLMOPT_MAX_HOST_CONNECTIONS, CURL_MAX_HOST_CONNECTIONS);
+		curl_multi_setopt(multi.handle, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(max_limit));
+
+		std::deque<CurlTransfer *> pending;
+
+		for (auto &request : requests) {
+			auto transfer = make_uniq<CurlTransfer>(request, allocator);
+			transfer->Initialize(settings);
+			pending.push_back(transfer.get());
+			multi.transfers.push_back(std::move(transfer));
+		}
+
+		// Start pending transfers while their host is under its (adaptive) concurrency limit, and the scheduler gives
+		// them a request slot of their priority class.
+
+		auto &scheduler = RequestScheduler::Get();
+		auto &breaker = CircuitBreaker::Get();
+		std::unordered_map<string, idx_t> in_flight;
+		idx_t active = 0;
+
+		// The request slot of the transfer must be acquired.
+		auto add_transfer = [&](CurlTransfer &transfer) {
+			curl_multi_add_handle(multi.handle, transfer.easy);
+			transfer.added = true;
+			transfer.start_time = std::chrono::steady_clock::now();
+			in_flight[transfer.host]++;
+			active++;
+		};
+		auto remove_transfer = [&](CurlTransfer &transfer) {
+			curl_multi_remove_handle(multi.handle, transfer.easy);
+			scheduler.Release(transfer.priority);
+			transfer.added = false;
+			in_flight[transfer.host]--;
+			active--;
+		};
+
+		// Fail fast when the endpoint is down, the request slot of the transfer must be acquired.
+		auto start_transfer = [&](CurlTransfer &transfer) {
+			if (!breaker.AllowRequest(transfer.endpoint, transfer.request.response.error)) {
+				scheduler.Release(transfer.priority);
+				return;
+			}
+			add_transfer(transfer);
+		};
+
+		auto start_transfers = [&]() {
+			for (auto it = pending.begin(); it != pending.end();) {
+				auto transfer = *it;
+
+				if (in_flight[transfer->host] >= controller.GetLimit(transfer->host, max_limit) ||
+				    !scheduler.TryAcquire(transfer->priority, max_limit)) {
+					it++;
+					continue;
+				}
+				it = pending.erase(it);
+				start_transfer(*transfer);
+			}
+
+			// Nothing in flight, wait for a slot rather than leaving the batch with pending transfers.
+			while (active == 0 && !pending.empty()) {
+				auto transfer = pending.front();
+				pending.pop_front();
+				scheduler.Acquire(transfer->priority, max_limit);
+				start_transfer(*transfer);
+			}
+		};
+		start_transfers();
+
+		// Hedge the requests without first bytes after the hedging delay of their host, within its concurrency
+		// limit so hedges do not amplify the load of a struggling host.
+
+		auto hedge_transfers = [&]() {
+			const auto now = std::chrono::steady_clock::now();
+			const auto transfer_count = multi.transfers.size();
+
+			for (idx_t i = 0; i < transfer_count; i++) {
+				auto transfer = multi.transfers[i].get();
+
+				if (!transfer->added || transfer->started || transfer->sibling || transfer->is_hedge) {
+					continue;
+				}
+				double delay_ms = 0;
+				if (!controller.GetHedgeDelay(transfer->host, delay_ms)) {
+					continue;
+				}
+				const auto elapsed_ms =
+				    std::chrono::duration<double, std::milli>(now - transfer->start_time).count();
+
+				if (elapsed_ms < delay_ms ||
+				    in_flight[transfer->host] >= controller.GetLimit(transfer->host, max_limit) ||
+				    !scheduler.TryAcquire(transfer->priority, max_limit)) {
+					continue;
+				}
+
+				auto hedge = make_uniq<CurlTransfer>(transfer->request, allocator);
+				hedge->Initialize(settings);
+				hedge->is_hedge = true;
+				hedge->sibling = transfer;
+				transfer->sibling = hedge.get();
+
+				add_transfer(*hedge);
+				multi.transfers.push_back(std::move(hedge));
+
+				if (settings.statistics) {
+					settings.statistics->RecordHedge(false);
+				}
+			}
+		};
+
+		// Drive all transfers until completion.
+
+		int running = 0;
+
+		do {
+			auto code = curl_multi_perform(multi.handle, &running);
+			if (code != CURLM_OK) {
+				throw IOException("HTTP request failed: %s", curl_multi_strerror(code));
+			}
+
+			CURLMsg *message;
+			int queued = 0;
+			bool completed = false;
+
+			while ((message = curl_multi_info_read(multi.handle, &queued))) {
+				if (message->msg != CURLMSG_DONE) {
+					continue;
+				}
+				CurlTransfer *transfer = nullptr;
+				curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &transfer);
+				const auto result = message->data.result;
+
+				try {
+					transfer->Finish(result, allocator);
+				} catch (std::exception &e) {
+					transfer->request.response.error = e.what();
+				}
+				remove_transfer(*transfer);
+				completed = true;
+
+				// Transfers that lost the race of a hedged request, or canceled, are not accounted.
+				if (transfer->lost || transfer->interrupted) {
+					continue;
+				}
+				if (transfer->is_hedge && settings.statistics) {
+					settings.statistics->RecordHedge(true);
+				}
+
+				// Feed the concurrency controller with the outcome and latency (time to first byte).
+
+				curl_off_t ttfb_us = 0;
+				curl_easy_getinfo(transfer->easy, CURLINFO_STARTTRANSFER_TIME_T, &ttfb_us);
+
+				string cause;
+				const auto outcome = GetRequestOutcome(result, *transfer, cause);
+
+				breaker.Record(transfer->endpoint, HttpRequest::IsEndpointFailure(transfer->request.response));
+
+				auto reason = controller.Update(transfer->host, outcome, cause, static_cast<double>(ttfb_us) / 1000.0,
+				                                in_flight[transfer->host] + 1, max_limit);
+
+				if (settings.statistics) {
+					const auto &response = transfer->request.response;
+					settings.statistics->RecordRequest(!response.error.empty() || response.status_code >= 400);
+					settings.statistics->RecordLimit(transfer->host, controller.GetLimit(transfer->host, max_limit),
+					                                 reason);
+				}
+
+			}
+
+			// Abort the transfers that lost the race of a hedged request.
+
+			for (auto &transfer : multi.transfers) {
+				if (transfer->added && transfer->lost) {
+					remove_transfer(*transfer);
+					completed = true;
+				}
+			}
+
+			if (completed || !pending.empty()) {
+				start_transfers();
+			}
+			if (settings.hedging) {
+				hedge_transfers();
+			}
+
+			if (running > 0) {
+				auto timeout_ms = settings.hedging ? CURL_HEDGING_POLL_TIMEOUT_MS : CURL_POLL_TIMEOUT_MS;
+				if (!pending.empty()) {
+					timeout_ms = MinValue(timeout_ms, CURL_SLOT_POLL_TIMEOUT_MS);
+				}
+
+				code = curl_multi_poll(multi.handle, nullptr, 0, timeout_ms, nullptr);
+				if (code != CURLM_OK) {
+					throw IOException("HTTP request failed: %s", curl_multi_strerror(code));
+				}
+			}
+		} while (active > 0);
+
+	} catch (std::exception &e) {
+		for (auto &request : requests) {
+			if (request.response.error.empty() && request.response.status_code == 0) {
+				request.response.error = e.what();
+			}
+		}
+	}
+}
+
+} // namespace duckdb
+
+#endif // __EMSCRIPTEN__
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "http_request.hpp"
+
+#ifndef __EMSCRIPTEN__
+
+namespace duckdb {
+
+//! HTTP transport built on the libcurl multi interface. Requests of a batch are multiplexed over a few HTTP/2
+//! connections per host, DNS cache, TLS sessions and connections are shared by all transfers of the process.
+struct CurlHttpClient {
+	//! Execute a batch of HTTP GET requests concurrently, returns when all of them are completed.
+	static void StreamHttpRequests(const HttpSettings &settings, vector<HttpStreamRequest> &requests);
+};
+
+} // namespace duckdb
+
+#endif // __EMSCRIPTEN__
@@ -1,26 +1,57 @@
 #include "eurostat_info_functions.hpp"
 #include "eurostat_data_functions.hpp"
 #include "function_builder.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iterator>
+#include <mutex>
+#include <set>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 
 // DuckDB
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_distinct.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
 
 // EUROSTAT
 #include "eurostat.hpp"
 #include "filter_encoder.hpp"
 #include "http_request.hpp"
+#include "parsed_response.hpp"
+#include "response_cache.hpp"
+#include "shared_cache.hpp"
+#include "row_filter.hpp"
 
 // Debug logging controlled by EUROSTAT_DEBUG environment variable
 static int GetDebugLevel() {
@@ -43,6 +74,71 @@ namespace duckdb {
 
 namespace {
 
+//======================================================================================================================
+// ES_ReadQueryState
+//======================================================================================================================
+
+//! Per-connection state to know if the current query binds any EUROSTAT_Read scan, so the optimizer pass can skip
+//! the plans of other queries without walking them.
+struct ES_ReadQueryState final : ClientContextState {
+	bool has_scans = false;
+
+	void QueryEnd() override {
+		has_scans = false;
+	}
+};
+
+static constexpr const char *ES_READ_QUERY_STATE_KEY = "eurostat_read";
+
+// Interval between the checks of an interrupted query while the scan waits for the background fetch
+static constexpr auto ES_READ_WAIT_INTERVAL = std::chrono::milliseconds(100);
+
+// Max number of sorted runs of rows merged at once when the rows of an elided ORDER BY arrive in another order
+static constexpr idx_t ES_READ_MERGE_FAN_IN = 64;
+
+//! Returns an ENUM type over the given codes, sorted so the ENUM compares like the VARCHAR codes.
+static LogicalType CreateEnumType(const std::vector<string> &codes) {
+	std::set<string> sorted_codes(codes.begin(), codes.end());
+	Vector values(LogicalType::VARCHAR, sorted_codes.size());
+	auto data = FlatVector::GetData<string_t>(values);
+	idx_t index = 0;
+
+	for (const auto &code : sorted_codes) {
+		data[index++] = StringVector::AddString(values, code);
+	}
+	return LogicalType::ENUM(values, sorted_codes.size());
+}
+
+//! Labels of the codes of a dimension, emitted as dictionary vectors over the label table of the dimension.
+struct ES_LabelColumn {
+	//! Column of the dimension in the data structure.
+	column_t dimension;
+	//! Index of each code in the label table.
+	std::unordered_map<string, uint32_t> code_index;
+	//! Label table, its last entry is NULL for the codes without label.
+	Vector labels;
+	uint32_t null_index;
+
+	ES_LabelColumn(column_t dimension, const std::unordered_map<string, string> &code_labels)
+	    : dimension(dimension), labels(LogicalType::VARCHAR, code_labels.size() + 1),
+	      null_index(static_cast<uint32_t>(code_labels.size())) {
+		auto data = FlatVector::GetData<string_t>(labels);
+		uint32_t index = 0;
+
+		for (const auto &entry : code_labels) {
+			code_index.emplace(entry.first, index);
+			data[index++] = StringVector::AddString(labels, entry.second);
+		}
+		FlatVector::SetNull(labels, null_index, true);
+	}
+
+	//! Index of the label of a code in the label table.
+	uint32_t GetIndex(const string &code) const {
+		const auto it = code_index.find(code);
+		return it == code_index.end() ? null_index : it->second;
+	}
+};
+
 //======================================================================================================================
 // ES_Read
 //======================================================================================================================
@@ -56,12 +152,30 @@ struct ES_Read {
 		string provider_id;
 		string dataflow_id;
 		std::vector<eurostat::Dimension> data_structure;
+		//! Type of each dimension, VARCHAR or ENUM over the codes of the contentconstraint ('enum_dimensions').
+		std::vector<LogicalType> dimension_types;
+		//! Label columns ('labels'), projected after the observation value.
+		std::vector<shared_ptr<ES_LabelColumn>> label_columns;
 		std::vector<string> complex_filters;
+		//! Residual filters not sent to the API, evaluated while parsing the rows.
+		shared_ptr<RowFilter> row_filter;
 		std::size_t limit = 0;
+		std::size_t first_n_observations = 0;
+		std::size_t last_n_observations = 0;
+		//! Column answered from the contentconstraint metadata instead of downloading the dataset.
+		column_t metadata_column = DConstants::INVALID_INDEX;
+		//! No row can match the pushed-down filters, nothing is fetched.
+		bool empty_result = false;
+		//! Columns the rows are emitted sorted by (ascending), set when an ORDER BY is elided.
+		std::vector<column_t> order_columns;
+		//! Columns the output chunks are partitioned by (single value per chunk), set when DuckDB asks for them to
+		//! aggregate per partition (see GetPartitionInfo).
+		mutable std::vector<column_t> partition_columns;
 
 		explicit BindData(const string &provider_id, const string &dataflow_id,
 		                  const std::vector<eurostat::Dimension> &data_structure)
-		    : provider_id(provider_id), dataflow_id(dataflow_id), data_structure(std::move(data_structure)) {
+		    : provider_id(provider_id), dataflow_id(dataflow_id), data_structure(std::move(data_structure)),
+		      dimension_types(this->data_structure.size(), LogicalType::VARCHAR) {
 		}
 	};
 
@@ -86,344 +200,2172 @@ struct ES_Read {
 			throw InvalidInputException("EUROSTAT: Unknown Endpoint '%s'.", provider_id.c_str());
 		}
 
+		// Flag the query, so the optimizer pass knows there is a EUROSTAT_Read scan to optimize.
+
+		context.registered_state->GetOrCreate<ES_ReadQueryState>(ES_READ_QUERY_STATE_KEY)->has_scans = true;
+
 		// Get dataflow metadata.
 
 		auto data_structure = EurostatUtils::DataStructureOf(context, provider_id, dataflow_id);
+		auto bind_data = make_uniq<BindData>(provider_id, dataflow_id, data_structure);
 
-		for (const auto &dim : data_structure) {
-			names.emplace_back(dim.name);
-			return_types.push_back(LogicalType::VARCHAR);
+		// Type the dimensions as ENUM over the codes of the contentconstraint, if requested (time periods are
+		// kept as VARCHAR).
+
+		auto options_param = input.named_parameters.find("enum_dimensions");
+
+		if (options_param != input.named_parameters.end() && !options_param->second.IsNull() &&
+		    BooleanValue::Get(options_param->second)) {
+			auto dimension_values = EurostatUtils::DimensionValuesOf(context, provider_id, dataflow_id);
+
+			for (idx_t i = 0; i < data_structure.size(); i++) {
+				const auto &dim = data_structure[i];
+				std::vector<string> codes;
+
+				if (dim.name == "time_period") {
+					continue;
+				}
+				if (dim.name == "geo_level") {
+					// Virtual dimension, computed from the GEO codes.
+					for (const auto &geo_code : dimension_values["geo"]) {
+						codes.push_back(eurostat::Dimension::GetGeoLevelFromGeoCode(geo_code));
+					}
+				} else {
+					codes = std::move(dimension_values[dim.name]);
+				}
+				if (!codes.empty()) {
+					bind_data->dimension_types[i] = CreateEnumType(codes);
+				}
+			}
+		}
+
+		// Add a '<dimension>_label' column for each dimension with a codelist, if requested.
+
+		options_param = input.named_parameters.find("labels");
+
+		if (options_param != input.named_parameters.end() && !options_param->second.IsNull() &&
+		    BooleanValue::Get(options_param->second)) {
+			string language = "en";
+
+			auto language_param = input.named_parameters.find("language");
+			if (language_param != input.named_parameters.end() && !language_param->second.IsNull()) {
+				language = StringValue::Get(language_param->second);
+			}
+			if (language.empty()) {
+				language = "en";
+			}
+			auto dimension_labels = EurostatUtils::DimensionLabelsOf(context, provider_id, dataflow_id, language);
+
+			for (idx_t i = 0; i < data_structure.size(); i++) {
+				const auto &dim = data_structure[i];
+				const auto labels_it = dimension_labels->find(dim.name);
+
+				if (dim.position == -1 || dim.name == "time_period" || labels_it == dimension_labels->end()) {
+					continue;
+				}
+				bind_data->label_columns.push_back(make_shared_ptr<ES_LabelColumn>(i, labels_it->second));
+			}
+		}
+
+		for (idx_t i = 0; i < data_structure.size(); i++) {
+			names.emplace_back(data_structure[i].name);
+			return_types.push_back(bind_data->dimension_types[i]);
 		}
 		names.emplace_back("observation_value");
 		return_types.push_back(LogicalType::DOUBLE);
 
-		return unique_ptr<FunctionData>(new BindData(provider_id, dataflow_id, data_structure));
+		for (const auto &label_column : bind_data->label_columns) {
+			names.emplace_back(data_structure[label_column->dimension].name + "_label");
+			return_types.push_back(LogicalType::VARCHAR);
+		}
+
+		return std::move(bind_data);
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Init
 	//------------------------------------------------------------------------------------------------------------------
 
-	//! Dimension values structure.
-	struct DimensionValues {
-		std::vector<string> values;
+	struct State final : GlobalTableFunctionState {
+		std::vector<column_t> column_ids;
+		//! Column of the data structure stored at each column of the collection (projected columns only).
+		std::vector<column_t> stored_columns;
+		//! Column of the collection for each output column, INVALID_INDEX for virtual columns.
+		std::vector<idx_t> output_columns;
+		column_t time_period_column;
+		column_t observation_column;
+		//! Label columns, stored as the index of their label in the label table of the dimension.
+		std::vector<shared_ptr<ES_LabelColumn>> label_columns;
+		//! Rows read, kept in buffer-managed memory that DuckDB spills to 'temp_directory' under 'memory_limit'.
+		unique_ptr<ColumnDataCollection> rows;
+		DataChunk append_chunk;
+		DataChunk scan_chunk;
+		idx_t row_count;
+		optional_ptr<BufferManager> buffer_manager;
+
+		//! Columns of the data structure the rows arrive sorted by (elided ORDER BY), checked while they are appended.
+		std::vector<column_t> order_columns;
+		//! Columns of the collection the output chunks are partitioned by, and values of the current partition.
+		std::vector<idx_t> partition_columns;
+		vector<Value> partition_values;
+		//! Next row of the scan chunk to emit, and index of the last emitted chunk.
+		idx_t scan_offset;
+		idx_t batch_index;
+		//! Sort key of the last row, to check the rows arrive sorted.
+		string last_order_key;
+		//! Rows starting a new sorted run, where the rows arrived in another order (e.g. codes in codelist order).
+		std::vector<idx_t> run_starts;
+		//! Key of the partition of the last row, and keys of the partitions already appended.
+		string last_partition_key;
+		std::unordered_map<string, bool> partition_keys;
+
+		//! Rows are fetched by a background thread while the scan emits the chunks already read.
+		std::thread fetch_thread;
+		std::mutex lock;
+		std::condition_variable rows_available;
+		idx_t scan_chunk_index;
+		bool finished;
+		ErrorData error;
+		//! Set when the scan is destroyed before the end of the download (e.g. LIMIT satisfied upstream) or the query
+		//! is interrupted, aborts the requests in flight.
+		std::atomic<bool> canceled;
+		//! Statistics of the HTTP requests, shown by EXPLAIN ANALYZE.
+		shared_ptr<HttpStatistics> statistics;
+
+		explicit State()
+		    : time_period_column(0), observation_column(0), row_count(0), scan_offset(0), batch_index(0),
+		      scan_chunk_index(0), finished(false), canceled(false) {
+		}
+
+		~State() override {
+			canceled = true;
+
+			if (fetch_thread.joinable()) {
+				fetch_thread.join();
+			}
+		}
+
+		//! Prepare the collection to store the projected columns of the data structure.
+		void Initialize(ClientContext &context, const std::vector<eurostat::Dimension> &data_structure,
+		                const std::vector<LogicalType> &dimension_types,
+		                const std::vector<shared_ptr<ES_LabelColumn>> &label_columns_p) {
+			vector<LogicalType> types;
+
+			time_period_column = data_structure.size() - 1;
+			observation_column = data_structure.size();
+			label_columns = label_columns_p;
+
+			for (const auto &column_id : column_ids) {
+				if (column_id > observation_column + label_columns.size()) {
+					output_columns.push_back(DConstants::INVALID_INDEX);
+					continue;
+				}
+				output_columns.push_back(stored_columns.size());
+				stored_columns.push_back(column_id);
+
+				if (column_id > observation_column) {
+					types.push_back(LogicalType::UINTEGER);
+				} else {
+					types.push_back(column_id == observation_column ? LogicalType::DOUBLE
+					                                                : dimension_types[column_id]);
+				}
+			}
+
+			buffer_manager = BufferManager::GetBufferManager(context);
+			rows = make_uniq<ColumnDataCollection>(*buffer_manager, types);
+			append_chunk.Initialize(BufferAllocator::Get(context), types);
+			scan_chunk.Initialize(BufferAllocator::Get(context), types);
+		}
+
+		//! Append a row, 'values' contains the dimension values of the series indexed by column of the data structure.
+		void AppendRow(const std::vector<string> &values, const string &time_period, double observation_value) {
+			const auto row_idx = append_chunk.size();
+
+			if (!order_columns.empty()) {
+				CheckOrder(values, time_period);
+			}
+			if (!partition_columns.empty()) {
+				CheckPartition(values);
+			}
+
+			for (idx_t col_idx = 0; col_idx < stored_columns.size(); col_idx++) {
+				const auto column_id = stored_columns[col_idx];
+				auto &vector = append_chunk.data[col_idx];
+
+				if (column_id == observation_column) {
+					FlatVector::GetData<double>(vector)[row_idx] = observation_value;
+				} else if (column_id > observation_column) {
+					const auto &label_column = *label_columns[column_id - observation_column - 1];
+					FlatVector::GetData<uint32_t>(vector)[row_idx] =
+					    label_column.GetIndex(values[label_column.dimension]);
+				} else {
+					const auto &value = column_id == time_period_column ? time_period : values[column_id];
+
+					if (vector.GetType().id() == LogicalTypeId::ENUM) {
+						SetEnumValue(vector, row_idx, value);
+					} else {
+						FlatVector::GetData<string_t>(vector)[row_idx] = StringVector::AddString(vector, value);
+					}
+				}
+			}
+			append_chunk.SetCardinality(row_idx + 1);
+			row_count++;
+
+			if (append_chunk.size() == STANDARD_VECTOR_SIZE) {
+				FlushRows(false);
+			}
+		}
+
+		//! Set the ENUM value of a code, empty codes are NULL.
+		static void SetEnumValue(Vector &vector, idx_t row_idx, const string &value) {
+			if (value.empty()) {
+				FlatVector::SetNull(vector, row_idx, true);
+				return;
+			}
+			const auto pos = EnumType::GetPos(vector.GetType(), string_t(value));
+
+			if (pos < 0) {
+				throw IOException("EUROSTAT: Code '%s' is not in the contentconstraint of the dataflow, read it "
+				                  "without 'enum_dimensions'.",
+				                  value.c_str());
+			}
+			switch (vector.GetType().InternalType()) {
+			case PhysicalType::UINT8:
+				FlatVector::GetData<uint8_t>(vector)[row_idx] = static_cast<uint8_t>(pos);
+				break;
+			case PhysicalType::UINT16:
+				FlatVector::GetData<uint16_t>(vector)[row_idx] = static_cast<uint16_t>(pos);
+				break;
+			default:
+				FlatVector::GetData<uint32_t>(vector)[row_idx] = static_cast<uint32_t>(pos);
+				break;
+			}
+		}
+
+		//! Check the rows arrive sorted by the order columns, the ORDER BY of the query was elided. Rows arriving in
+		//! another order start a new sorted run, the runs are merged at the end of the download.
+		void CheckOrder(const std::vector<string> &values, const string &time_period) {
+			string key;
+
+			// Codes have no NUL characters, so the keys compare as the tuples of their values.
+			for (const auto &column_id : order_columns) {
+				key += column_id == time_period_column ? time_period : values[column_id];
+				key += '\0';
+			}
+			if (key < last_order_key) {
+				run_starts.push_back(row_count);
+			}
+			last_order_key = std::move(key);
+		}
+
+		//! Check the rows arrive grouped by the partition columns: a partition appearing again after another one would
+		//! be emitted twice, and aggregated as two groups with the same value.
+		void CheckPartition(const std::vector<string> &values) {
+			string key;
+
+			for (const auto &col_idx : partition_columns) {
+				key += values[stored_columns[col_idx]];
+				key += '\0';
+			}
+			if (key == last_partition_key && !partition_keys.empty()) {
+				return;
+			}
+			if (!partition_keys.emplace(key, true).second) {
+				throw IOException("EUROSTAT: The rows of the dataset are not grouped by the dimensions of the GROUP "
+				                  "BY, they can not be aggregated per partition.");
+			}
+			last_partition_key = std::move(key);
+		}
+
+		//! Cursor over a sorted run of rows of the collection, with the sort key of its current row.
+		struct RunCursor {
+			idx_t row;
+			idx_t end;
+			idx_t chunk_index = DConstants::INVALID_INDEX;
+			DataChunk chunk;
+			string key;
+		};
+
+		//! Sort the rows by the order columns, merging their sorted runs (see 'run_starts') into new collections, so
+		//! they stay in buffer-managed memory. Chunks of the collections are full but the last one.
+		void SortRuns() {
+			std::vector<idx_t> key_columns;
+
+			for (const auto &column_id : order_columns) {
+				const auto it = std::find(stored_columns.begin(), stored_columns.end(), column_id);
+
+				if (it == stored_columns.end()) {
+					throw InternalException("EUROSTAT: Order column %llu is not read by the scan", column_id);
+				}
+				key_columns.push_back(NumericCast<idx_t>(it - stored_columns.begin()));
+			}
+			std::vector<idx_t> bounds {0};
+			bounds.insert(bounds.end(), run_starts.begin(), run_starts.end());
+			bounds.push_back(rows->Count());
+
+			EUROSTAT_SCAN_DEBUG_LOG(1, "Sorting %zu runs of rows of an elided ORDER BY", bounds.size() - 1);
+
+			while (bounds.size() > 2 && !canceled) {
+				auto sorted = make_uniq<ColumnDataCollection>(*buffer_manager, rows->Types());
+				std::vector<idx_t> sorted_bounds {0};
+
+				for (idx_t first = 0; first + 1 < bounds.size(); first += ES_READ_MERGE_FAN_IN) {
+					const auto last = MinValue<idx_t>(first + ES_READ_MERGE_FAN_IN, bounds.size() - 1);
+					MergeRuns(bounds, first, last, key_columns, *sorted);
+					sorted_bounds.push_back(sorted->Count());
+				}
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					rows = std::move(sorted);
+				}
+				bounds = std::move(sorted_bounds);
+			}
+			run_starts.clear();
+		}
+
+		//! Merge the runs [first, last) of the collection into the sorted collection, stable for rows of equal keys.
+		void MergeRuns(const std::vector<idx_t> &bounds, idx_t first, idx_t last,
+		               const std::vector<idx_t> &key_columns, ColumnDataCollection &sorted) {
+			vector<unique_ptr<RunCursor>> cursors;
+
+			for (idx_t run = first; run < last; run++) {
+				auto cursor = make_uniq<RunCursor>();
+				cursor->row = bounds[run];
+				cursor->end = bounds[run + 1];
+				rows->InitializeScanChunk(cursor->chunk);
+				LoadRunRow(*cursor, key_columns);
+				cursors.push_back(std::move(cursor));
+			}
+			DataChunk output;
+			rows->InitializeScanChunk(output);
+
+			while (!canceled) {
+				RunCursor *next = nullptr;
+
+				for (auto &cursor : cursors) {
+					if (cursor->row < cursor->end && (!next || cursor->key < next->key)) {
+						next = cursor.get();
+					}
+				}
+				if (!next) {
+					break;
+				}
+				const auto offset = next->row % STANDARD_VECTOR_SIZE;
+
+				for (idx_t col_idx = 0; col_idx < output.ColumnCount(); col_idx++) {
+					VectorOperations::Copy(next->chunk.data[col_idx], output.data[col_idx], offset + 1, offset,
+					                       output.size());
+				}
+				output.SetCardinality(output.size() + 1);
+
+				if (output.size() == STANDARD_VECTOR_SIZE) {
+					sorted.Append(output);
+					output.Reset();
+				}
+				next->row++;
+				LoadRunRow(*next, key_columns);
+			}
+			if (output.size() > 0) {
+				sorted.Append(output);
+			}
+		}
+
+		//! Load the chunk of the current row of a cursor, and compute its sort key (as in CheckOrder).
+		void LoadRunRow(RunCursor &cursor, const std::vector<idx_t> &key_columns) {
+			if (cursor.row >= cursor.end) {
+				return;
+			}
+			const auto chunk_index = cursor.row / STANDARD_VECTOR_SIZE;
+			const auto offset = cursor.row % STANDARD_VECTOR_SIZE;
+
+			if (chunk_index != cursor.chunk_index) {
+				cursor.chunk.Reset();
+				rows->FetchChunk(chunk_index, cursor.chunk);
+				cursor.chunk_index = chunk_index;
+			}
+			if (offset >= cursor.chunk.size()) {
+				throw InternalException("EUROSTAT: Row %llu is not in chunk %llu of the scan", cursor.row, chunk_index);
+			}
+			cursor.key.clear();
+
+			for (const auto &col_idx : key_columns) {
+				const auto &vector = cursor.chunk.data[col_idx];
+
+				if (FlatVector::Validity(vector).RowIsValid(offset)) {
+					cursor.key += FlatVector::GetData<string_t>(vector)[offset].GetString();
+				}
+				cursor.key += '\0';
+			}
+		}
+
+		//! Publish the pending rows to the scan, all chunks except the last one are full.
+		void FlushRows(bool last) {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				if (append_chunk.size() > 0) {
+					rows->Append(append_chunk);
+				}
+				finished = last;
+			}
+			append_chunk.Reset();
+			rows_available.notify_all();
+		}
+
+		//! Flush pending rows, sort them if they did not arrive in the order of an elided ORDER BY, and mark the end
+		//! of the data.
+		void Finalize() {
+			if (!run_starts.empty()) {
+				if (append_chunk.size() > 0) {
+					rows->Append(append_chunk);
+					append_chunk.Reset();
+				}
+				SortRuns();
+			}
+			FlushRows(true);
+		}
+
+		//! Mark the end of the data with an error, raised by the scan.
+		void Fail(ErrorData fetch_error) {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				error = std::move(fetch_error);
+				finished = true;
+			}
+			rows_available.notify_all();
+		}
+
+		//! Wait for the next chunk of rows, returns false at the end of the data. An interrupted query cancels the
+		//! background fetch instead of waiting for its end. Rows of an elided ORDER BY are emitted at the end of the
+		//! download, once it is known they are sorted.
+		bool FetchChunk(ClientContext &context) {
+			std::unique_lock<std::mutex> guard(lock);
+
+			while (!rows_available.wait_for(guard, ES_READ_WAIT_INTERVAL, [&]() {
+				return finished || (order_columns.empty() && scan_chunk_index < rows->ChunkCount());
+			})) {
+				if (context.interrupted) {
+					canceled = true;
+					throw InterruptException();
+				}
+			}
+
+			if (error.HasError()) {
+				error.Throw();
+			}
+			if (scan_chunk_index >= rows->ChunkCount()) {
+				return false;
+			}
+			scan_chunk.Reset();
+			rows->FetchChunk(scan_chunk_index++, scan_chunk);
+			scan_offset = 0;
+			return true;
+		}
+
+		//! Returns the end of the partition starting at a row of the scan chunk.
+		idx_t GetPartitionEnd(idx_t start) const {
+			idx_t end = start + 1;
+
+			for (; end < scan_chunk.size(); end++) {
+				for (const auto &col_idx : partition_columns) {
+					if (!RowsEqual(scan_chunk.data[col_idx], start, end)) {
+						return end;
+					}
+				}
+			}
+			return end;
+		}
+
+		//! Check if two rows of a (flat) vector of the collection have the same value.
+		static bool RowsEqual(const Vector &vector, idx_t a, idx_t b) {
+			const auto &validity = FlatVector::Validity(vector);
+
+			if (!validity.RowIsValid(a) || !validity.RowIsValid(b)) {
+				return validity.RowIsValid(a) == validity.RowIsValid(b);
+			}
+			switch (vector.GetType().InternalType()) {
+			case PhysicalType::VARCHAR: {
+				const auto data = FlatVector::GetData<string_t>(vector);
+				return data[a] == data[b];
+			}
+			case PhysicalType::UINT8:
+				return FlatVector::GetData<uint8_t>(vector)[a] == FlatVector::GetData<uint8_t>(vector)[b];
+			case PhysicalType::UINT16:
+				return FlatVector::GetData<uint16_t>(vector)[a] == FlatVector::GetData<uint16_t>(vector)[b];
+			default:
+				return FlatVector::GetData<uint32_t>(vector)[a] == FlatVector::GetData<uint32_t>(vector)[b];
+			}
+		}
 	};
 
-	//! Data row structure.
-	struct Datarow {
-		size_t dimension_index;
-		string time_period;
-		double observation_value = NAN;
-	};
+	//! Incremental parser of a TSV response (Header + Rows), fed with chunks of the decompressed response body.
+	struct TsvReader {
+		State &data_table;
+		const std::vector<eurostat::Dimension> &data_structure;
+		std::unordered_map<string, bool> &row_keys;
+		const bool check_keys;
+		const std::size_t row_limit;
+		//! Residual filters, rows they reject are not stored.
+		const RowFilter *row_filter;
+		//! Query of a slice of a cached response, its rows out of the query are skipped.
+		const DataQuery *slice_query;
+		//! Optional, records the whole response in columnar form while it is parsed (before any filter).
+		unique_ptr<ParsedResponseBuilder> builder;
+
+		std::vector<string> time_periods;
+		//! Time periods of the TSV header matching the residual filters.
+		std::vector<bool> period_matches;
+		//! Column of the data structure of each dimension in the TSV header.
+		std::vector<column_t> header_columns;
+		column_t geo_column = DConstants::INVALID_INDEX;
+		column_t geo_level_column = DConstants::INVALID_INDEX;
+		int64_t line_index = 0;
+		string pending_line;
+
+		//! Reused buffers to parse rows.
+		std::vector<string> tokens;
+		std::vector<string> series_values;
+		std::vector<bool> state_keys;
+
+		TsvReader(State &data_table, const std::vector<eurostat::Dimension> &data_structure,
+		          std::unordered_map<string, bool> &row_keys, bool check_keys, std::size_t row_limit,
+		          const RowFilter *row_filter, const DataQuery *slice_query)
+		    : data_table(data_table), data_structure(data_structure), row_keys(row_keys), check_keys(check_keys),
+		      row_limit(row_limit), row_filter(row_filter), slice_query(slice_query) {
+			series_values.resize(data_structure.size());
+		}
+
+		//! Do we can stop parsing more rows?
+		bool LimitReached() const {
+			return (row_limit > 0 && data_table.row_count >= row_limit) || data_table.canceled;
+		}
+
+		//! Parse a chunk of the response body, returns false when no more data is needed.
+		bool Consume(const char *data, size_t data_length) {
+			const char *end = data + data_length;
+
+			while (data < end) {
+				auto eol = static_cast<const char *>(memchr(data, '\n', end - data));
+
+				if (!eol) {
+					pending_line.append(data, end - data);
+					break;
+				}
+				pending_line.append(data, eol - data);
+				ParseLine(pending_line);
+				pending_line.clear();
+				data = eol + 1;
+
+				if (LimitReached()) {
+					EUROSTAT_SCAN_DEBUG_LOG(1, "LIMIT pushdown %li reached, stopping download!", row_limit);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		//! Parse the last line of the response body.
+		void Finish() {
+			if (!pending_line.empty() && !LimitReached()) {
+				ParseLine(pending_line);
+				pending_line.clear();
+			}
+		}
+
+		//! Returns the column of the data structure with the given name.
+		column_t FindColumn(const string &name) const {
+			for (column_t column_id = 0; column_id < data_structure.size(); column_id++) {
+				if (data_structure[column_id].name == name) {
+					return column_id;
+				}
+			}
+			return DConstants::INVALID_INDEX;
+		}
+
+		//! Set the columns of the data structure of the dimensions of the series key.
+		void SetHeaderColumns(const std::vector<string> &header_names) {
+			for (const auto &name : header_names) {
+				auto column_id = FindColumn(name);
+				if (column_id == DConstants::INVALID_INDEX) {
+					throw IOException("EUROSTAT: Unknown dimension '%s' in TSV header.", name);
+				}
+				header_columns.push_back(column_id);
+
+				// Add GEO_LEVEL virtual dimension.
+				if (name == "geo") {
+					geo_column = column_id;
+					geo_level_column = FindColumn("geo_level");
+				}
+			}
+		}
+
+		//! Check the time periods of the header with the filters.
+		void SetTimePeriods() {
+			for (const auto &time_period : time_periods) {
+				period_matches.push_back((!row_filter || row_filter->MatchesPeriod(time_period)) &&
+				                         (!slice_query || slice_query->MatchesPeriod(time_period)));
+			}
+		}
+
+		//! Check the rows of a series are not duplicated (by another request), returns false if all of them are.
+		bool CheckKeys(const string &series_key) {
+			bool all_are_duplicated = true;
+			state_keys.clear();
+
+			for (const auto &time_period : time_periods) {
+				std::string row_key = series_key + "|" + time_period;
+
+				if (row_keys.find(row_key) != row_keys.end()) {
+					state_keys.push_back(true);
+				} else {
+					state_keys.push_back(false);
+					row_keys.emplace(row_key, true);
+					all_are_duplicated = false;
+				}
+			}
+			return !all_are_duplicated;
+		}
+
+		//! Record a whole series (parsed from the tokens of its line) in the parsed response.
+		void RecordSeries(idx_t token_count) {
+			builder->AddSeries();
+
+			for (idx_t dim_index = 0; dim_index < header_columns.size(); dim_index++) {
+				builder->AddCode(dim_index, series_values[header_columns[dim_index]]);
+			}
+			for (idx_t i = 0; i < time_periods.size() && i + 1 < token_count; i++) {
+				string &value_str = tokens[i + 1];
+				StringUtil::Trim(value_str);
+				double value = 0.0;
+
+				if (!value_str.empty() && value_str != ":" && TryCast::Operation(string_t(value_str), value, false)) {
+					builder->AddObservation(static_cast<uint32_t>(i), value);
+				}
+			}
+		}
+
+		//! Read the rows of a cached parsed response, as if its TSV was parsed.
+		void Read(const ParsedResponse &response) {
+			SetHeaderColumns(response.dimension_names);
+			time_periods = response.time_periods;
+			SetTimePeriods();
+			line_index = 1;
+
+			const auto dimension_count = header_columns.size();
+			const auto series_offsets = response.GetSeriesOffsets();
+			const auto observation_periods = response.GetObservationPeriods();
+			const auto observation_values = response.GetObservationValues();
+			string series_key;
+
+			for (idx_t series_idx = 0; series_idx < response.series_count && !LimitReached(); series_idx++) {
+				const auto codes = response.GetSeriesCodes(series_idx);
+				bool series_matches = true;
+
+				for (idx_t dim_index = 0; dim_index < dimension_count && series_matches; dim_index++) {
+					const auto &code = response.dictionaries[dim_index][codes[dim_index]];
+					series_values[header_columns[dim_index]] = code;
+
+					// Series out of the query of a cached slice, skip.
+					series_matches = !slice_query || slice_query->MatchesCode(dim_index, code);
+				}
+				if (!series_matches) {
+					continue;
+				}
+				if (geo_level_column != DConstants::INVALID_INDEX) {
+					series_values[geo_level_column] =
+					    eurostat::Dimension::GetGeoLevelFromGeoCode(series_values[geo_column]);
+				}
+				if (row_filter && !row_filter->MatchesSeries(series_values)) {
+					continue;
+				}
+				if (check_keys) {
+					series_key.clear();
+
+					for (idx_t dim_index = 0; dim_index < dimension_count; dim_index++) {
+						if (dim_index > 0) {
+							series_key += ',';
+						}
+						series_key += series_values[header_columns[dim_index]];
+					}
+					if (!CheckKeys(series_key)) {
+						continue;
+					}
+				}
+
+				for (idx_t obs_idx = series_offsets[series_idx]; obs_idx < series_offsets[series_idx + 1]; obs_idx++) {
+					const auto period_index = observation_periods[obs_idx];
+					const auto value = observation_values[obs_idx];
+
+					if ((check_keys && state_keys[period_index]) || !period_matches[period_index]) {
+						continue;
+					}
+					if (!row_filter || row_filter->MatchesValue(value)) {
+						data_table.AppendRow(series_values, time_periods[period_index], value);
+
+						if (LimitReached()) {
+							return;
+						}
+					}
+				}
+			}
+		}
+
+		//! Parse a line of the TSV response.
+		void ParseLine(const string &line) {
+			if (line.empty()) {
+				return;
+			}
+			std::string token;
+
+			// Parse header line to...
+			if (line_index == 0) {
+				size_t pos = line.find("\\TIME_PERIOD");
+
+				if (pos == string::npos) {
+					throw IOException("EUROSTAT: TIME_PERIOD not found in TSV header.");
+				}
+
+				// Extract dimension column names (before TIME_PERIOD).
+
+				std::istringstream stream_1(line.substr(0, pos));
+				std::vector<string> header_names;
+
+				while (std::getline(stream_1, token, ',')) {
+					header_names.push_back(StringUtil::Lower(token));
+				}
+				SetHeaderColumns(header_names);
+
+				// Extract time periods (after TIME_PERIOD).
+
+				std::istringstream stream_2(line.substr(pos + strlen("\\TIME_PERIOD") + 1));
+
+				while (std::getline(stream_2, token, '\t')) {
+					StringUtil::Trim(token);
+
+					if (!token.empty()) {
+						time_periods.push_back(token);
+					}
+				}
+				SetTimePeriods();
+
+				if (builder) {
+					builder->SetHeader(header_names, time_periods);
+				}
+
+			} else {
+				// Add data row.
+				ParseDatarow(line);
+			}
+			line_index++;
+		}
+
+		//! Parse a data row from a TSV line.
+		void ParseDatarow(const string &line) {
+			// Split line by tabs.
+
+			idx_t token_count = 0;
+			idx_t start = 0;
+
+			for (idx_t i = 0; i <= line.size(); i++) {
+				if (i == line.size() || line[i] == '\t') {
+					if (token_count == tokens.size()) {
+						tokens.emplace_back();
+					}
+					tokens[token_count++].assign(line, start, i - start);
+					start = i + 1;
+				}
+			}
+
+			// Parse dimensions from first token (comma-separated).
+
+			idx_t token_index = 0;
+			start = 0;
+			const auto &series_key = tokens[0];
+
+			for (idx_t i = 0; i <= series_key.size() && token_index < header_columns.size(); i++) {
+				if (i == series_key.size() || series_key[i] == ',') {
+					auto &value = series_values[header_columns[token_index]];
+					value.assign(series_key, start, i - start);
+
+					// Series out of the query of a cached slice, skip.
+					if (slice_query && !slice_query->MatchesCode(token_index, value)) {
+						return;
+					}
+					token_index++;
+					start = i + 1;
+				}
+			}
+			if (geo_level_column != DConstants::INVALID_INDEX) {
+				series_values[geo_level_column] =
+				    eurostat::Dimension::GetGeoLevelFromGeoCode(series_values[geo_column]);
+			}
+
+			// Keep the whole series in the parsed response, before any filter.
+
+			if (builder) {
+				RecordSeries(token_count);
+			}
+
+			// Series rejected by the residual filters, skip.
+
+			if (row_filter && !row_filter->MatchesSeries(series_values)) {
+				return;
+			}
+
+			// Check if the row keys are valid (if enabled).
+
+			if (check_keys && !CheckKeys(tokens[0])) {
+				return;
+			}
+
+			// Parse observation values for each time period.
+
+			for (size_t i = 0; i < time_periods.size() && i + 1 < token_count; i++) {
+				// Duplicate row, skip.
+
+				if (check_keys && state_keys[i]) {
+					continue;
+				}
+				if (!period_matches[i]) {
+					continue;
+				}
+
+				string &value_str = tokens[i + 1];
+				StringUtil::Trim(value_str);
+
+				// Store the row.
+
+				if (!value_str.empty() && value_str != ":") {
+					double value = 0.0;
+
+					if (TryCast::Operation(string_t(value_str), value, false) &&
+					    (!row_filter || row_filter->MatchesValue(value))) {
+						data_table.AppendRow(series_values, time_periods[i], value);
+
+						// Do we can stop parsing more rows?
+						if (LimitReached()) {
+							EUROSTAT_SCAN_DEBUG_LOG(1, "LIMIT pushdown %li reached, stopping parsing!", row_limit);
+							return;
+						}
+					}
+				}
+			}
+		}
+	};
+
+	//! Get the filter clauses of the data requests, previously parsed in 'PushdownComplexFilter' function.
+	static std::vector<string> GetFilterClauses(const BindData &bind_data) {
+		std::vector<string> filter_clauses;
+		std::unordered_map<string, bool> unique_clauses;
+
+		for (const auto &filter_clause : bind_data.complex_filters) {
+			if (!filter_clause.empty() && unique_clauses.emplace(filter_clause, true).second) {
+				filter_clauses.push_back(filter_clause);
+			}
+		}
+		if (filter_clauses.empty()) {
+			filter_clauses.emplace_back("?");
+		}
+		return filter_clauses;
+	}
+
+	//! Get the number of observations per series requested by Top-N pushdown (e.g. "lastNObservations=1&").
+	static string GetObservationsClause(const BindData &bind_data) {
+		if (bind_data.last_n_observations > 0) {
+			return "lastNObservations=" + std::to_string(bind_data.last_n_observations) + "&";
+		}
+		if (bind_data.first_n_observations > 0) {
+			return "firstNObservations=" + std::to_string(bind_data.first_n_observations) + "&";
+		}
+		return string();
+	}
+
+	//! Get the columns of the data structure the rows of the scan arrive sorted by: the API returns the series of a
+	//! request sorted by key, with periods in ascending order, so the rows of a single request are sorted by the
+	//! dimensions of the series key (but the ones with a single code in the request), then time_period. Empty if the
+	//! scan sends several requests.
+	static std::vector<column_t> GetSortedColumns(const BindData &bind_data) {
+		std::vector<column_t> sorted_columns;
+		const auto filter_clauses = GetFilterClauses(bind_data);
+
+		if (filter_clauses.size() != 1 || bind_data.metadata_column != DConstants::INVALID_INDEX ||
+		    bind_data.empty_result) {
+			return sorted_columns;
+		}
+		// Only the codes of the dimensions are needed, periods which are not years do not matter.
+		DataQuery query;
+		DataQuery::Parse(filter_clauses[0], query);
+
+		const auto &data_structure = bind_data.data_structure;
+		column_t time_period_column = DConstants::INVALID_INDEX;
+		idx_t key_index = 0;
+
+		for (column_t column_id = 0; column_id < data_structure.size(); column_id++) {
+			const auto &dimension = data_structure[column_id];
+
+			if (dimension.name == "time_period") {
+				time_period_column = column_id;
+				continue;
+			}
+			if (dimension.position == -1) {
+				continue;
+			}
+			if (key_index >= query.dim_codes.size() || query.dim_codes[key_index].size() != 1) {
+				sorted_columns.push_back(column_id);
+			}
+			key_index++;
+		}
+		if (time_period_column != DConstants::INVALID_INDEX) {
+			sorted_columns.push_back(time_period_column);
+		}
+		return sorted_columns;
+	}
+
+	//! Check if rows sorted by 'sorted_columns' are also sorted by the given dimensions (or only grouped by them, with
+	//! 'any_order'), the dimensions of the series key not in 'sorted_columns' have a single value.
+	static bool IsSortedBy(const std::vector<column_t> &sorted_columns, const std::vector<column_t> &columns,
+	                       bool any_order) {
+		std::vector<column_t> key_columns;
+
+		for (const auto &column_id : columns) {
+			if (std::find(sorted_columns.begin(), sorted_columns.end(), column_id) != sorted_columns.end() &&
+			    std::find(key_columns.begin(), key_columns.end(), column_id) == key_columns.end()) {
+				key_columns.push_back(column_id);
+			}
+		}
+		if (sorted_columns.empty() || key_columns.size() > sorted_columns.size()) {
+			return false;
+		}
+		const auto prefix_end = sorted_columns.begin() + NumericCast<int64_t>(key_columns.size());
+
+		for (idx_t i = 0; i < key_columns.size(); i++) {
+			if (any_order ? std::find(sorted_columns.begin(), prefix_end, key_columns[i]) == prefix_end
+			              : sorted_columns[i] != key_columns[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//! Fill the state with the different values of one dimension, taken from the contentconstraint metadata.
+	static void LoadDimensionValues(ClientContext &context, const BindData &bind_data, State &data_table) {
+		const auto &data_structure = bind_data.data_structure;
+		const auto &dimension = data_structure[bind_data.metadata_column];
+
+		auto dimension_values = EurostatUtils::DimensionValuesOf(context, bind_data.provider_id, bind_data.dataflow_id);
+		std::vector<string> values;
+
+		if (dimension.name == "geo_level") {
+			// Virtual dimension, computed from the GEO codes.
+			std::set<string> geo_levels;
+
+			for (const auto &geo_code : dimension_values["geo"]) {
+				geo_levels.insert(eurostat::Dimension::GetGeoLevelFromGeoCode(geo_code));
+			}
+			values.assign(geo_levels.begin(), geo_levels.end());
+		} else {
+			values = std::move(dimension_values[dimension.name]);
+		}
+
+		EUROSTAT_SCAN_DEBUG_LOG(1, "Metadata scan of dimension '%s': %zu values", dimension.name.c_str(),
+		                        values.size());
+
+		// Append one row per value, the other columns are not projected.
+
+		std::vector<string> series_values(data_structure.size());
+
+		for (const auto &value : values) {
+			if (dimension.name == "time_period") {
+				data_table.AppendRow(series_values, value, NAN);
+			} else {
+				series_values[bind_data.metadata_column] = value;
+				data_table.AppendRow(series_values, string(), NAN);
+			}
+		}
+	}
+
+	//! Parameters of the download of a dataset, executed by a background thread (it can not use the ClientContext).
+	struct FetchTask {
+		string provider_id;
+		string dataflow_id;
+		std::vector<eurostat::Dimension> data_structure;
+		string base_url;
+		std::vector<string> filter_clauses;
+		string observations_clause;
+		std::size_t row_limit;
+		shared_ptr<RowFilter> row_filter;
+		HttpSettings settings;
+		//! Time to live (in seconds, 0 = disabled) and memory limit of the cached responses.
+		uint64_t cache_ttl = 0;
+		idx_t cache_memory = 0;
+		//! Update time of the data of the dataflow, responses cached for other updates are not used.
+		string data_version;
+		//! Optional, cache of the parsed responses of the database, and its memory limit.
+		shared_ptr<ParsedResponseCache> parsed_cache;
+		idx_t parsed_cache_memory = 0;
+		//! Optional, directory of the responses shared by the processes of the host.
+		shared_ptr<SharedCacheDirectory> shared_cache;
+		//! Optional, remote directory of the responses shared by the nodes of a cluster.
+		shared_ptr<SharedCacheDirectory> remote_cache;
+
+		//! The rows must arrive in the order of the series key (elided ORDER BY, partitioned scan), so each request is
+		//! answered by a single source.
+		bool ordered = false;
+
+		//! Get the URL of a data request.
+		string GetDataUrl(const string &filter_clause) const {
+			return base_url + filter_clause + observations_clause + "format=TSV&compressed=true";
+		}
+		//! Get the key of the dataflow in the response cache.
+		string GetDataflowKey() const {
+			return provider_id + "/" + dataflow_id + "@" + data_version;
+		}
+		//! Get the cached parsed response of a query, nullptr if missing.
+		shared_ptr<const ParsedResponse> GetParsedResponse(const DataQuery &query) const {
+			return parsed_cache ? parsed_cache->Lookup(GetParsedKey(query)) : nullptr;
+		}
+		//! Get the key of a query in the parsed response cache: its URL and the update time of the dataflow.
+		string GetParsedKey(const DataQuery &query) const {
+			return data_version + " " + GetDataUrl(query.GetFilterClause());
+		}
+	};
+
+	//! Part of the dataset read by a scan: a request to download, or a slice of a cached response.
+	struct FetchSource {
+		string url;
+		//! Query of the request, its response is cached if set.
+		bool cacheable = false;
+		DataQuery query;
+		//! Slice of a cached response answering the request.
+		ResponseCache::Slice slice;
+	};
+
+	//! Get the sources of the data requests, answered from the cached responses when possible: only the ranges of
+	//! years missing from the cache are downloaded.
+	static std::vector<FetchSource> GetFetchSources(const FetchTask &task) {
+		std::vector<FetchSource> sources;
+		const auto dataflow_key = task.GetDataflowKey();
+		auto &cache = ResponseCache::Get();
+
+		for (const auto &filter_clause : task.filter_clauses) {
+			DataQuery query;
+
+			// Top-N requests (per series) can not be answered from other responses.
+			const bool caching = task.cache_ttl > 0 || task.parsed_cache || task.shared_cache || task.remote_cache;
+
+			if (!caching || !task.observations_clause.empty() || !DataQuery::Parse(filter_clause, query)) {
+				FetchSource source;
+				source.url = task.GetDataUrl(filter_clause);
+				sources.push_back(std::move(source));
+				continue;
+			}
+			vector<ResponseCache::Slice> slices;
+			vector<DataQuery> gaps;
+
+			if (task.cache_ttl > 0) {
+				cache.Lookup(dataflow_key, query, slices, gaps);
+			}
+
+			// The rows of several slices would not arrive in the order of the series key, download the whole response.
+			if (slices.size() + gaps.size() == 0 || (task.ordered && slices.size() + gaps.size() > 1)) {
+				slices.clear();
+				gaps.clear();
+				gaps.push_back(query);
+			}
+
+			for (auto &slice : slices) {
+				EUROSTAT_SCAN_DEBUG_LOG(1, "Cached response of '%s' answers '%s'",
+				                        slice.entry->query.GetFilterClause().c_str(),
+				                        slice.query.GetFilterClause().c_str());
+				FetchSource source;
+				source.slice = std::move(slice);
+				sources.push_back(std::move(source));
+			}
+			for (auto &gap : gaps) {
+				FetchSource source;
+				source.url = task.GetDataUrl(slices.empty() ? filter_clause : gap.GetFilterClause());
+				source.cacheable = true;
+				source.query = std::move(gap);
+				sources.push_back(std::move(source));
+			}
+		}
+		return sources;
+	}
+
+	//! Get the receiver of the content of a response: it is parsed, and kept (compressed) for the response cache, or
+	//! written to the shared cache directories. The optional heartbeat is called for every chunk received.
+	static HttpContentReceiver GetContentReceiver(TsvReader &reader, ResponseCache::BodyWriter *body,
+	                                              std::vector<SharedCacheDirectory::Writer *> writers,
+	                                              std::function<void()> heartbeat = nullptr) {
+		return [&reader, body, writers, heartbeat](const char *data, size_t data_length) {
+			if (heartbeat) {
+				heartbeat();
+			}
+			if (body) {
+				body->Append(data, data_length);
+			}
+			for (auto writer : writers) {
+				writer->Append(data, data_length);
+			}
+			return reader.Consume(data, data_length);
+		};
+	}
+
+	//! Download and parse the dataset, rows are published to the scan while they are read.
+	static void FetchData(State &data_table, const FetchTask &task) {
+		const string &provider_id = task.provider_id;
+		const string &dataflow_id = task.dataflow_id;
+		const std::size_t &row_limit = task.row_limit;
+		const auto dataflow_key = task.GetDataflowKey();
+		int32_t url_count = 0;
+
+		std::unordered_map<string, bool> row_keys;
+		bool check_keys = task.filter_clauses.size() > 1;
+
+		// Read the cached responses first: the slices of cached responses (filtered by their query), and the parsed
+		// responses of the requests, which skip the download, the decompression and the parsing.
+
+		const auto sources = GetFetchSources(task);
+		std::vector<idx_t> requests_sources;
+
+		auto record_cache_hit = [&](const string &cache) {
+			if (task.settings.statistics) {
+				task.settings.statistics->RecordCacheHit(cache);
+			}
+		};
+
+		for (idx_t i = 0; i < sources.size(); i++) {
+			const auto &source = sources[i];
+			shared_ptr<const ParsedResponse> parsed;
+
+			if (source.slice.entry) {
+				parsed = task.GetParsedResponse(source.slice.entry->query);
+			} else if (source.cacheable) {
+				parsed = task.GetParsedResponse(source.query);
+			}
+			if (!source.slice.entry && !parsed) {
+				requests_sources.push_back(i);
+				continue;
+			}
+			if ((row_limit > 0 && data_table.row_count >= row_limit) || data_table.canceled) {
+				break;
+			}
+			TsvReader reader(data_table, task.data_structure, row_keys, check_keys, row_limit, task.row_filter.get(),
+			                 source.slice.entry && source.slice.filtered ? &source.slice.query : nullptr);
+
+			record_cache_hit(parsed ? "parsed" : "memory");
+
+			if (parsed) {
+				EUROSTAT_SCAN_DEBUG_LOG(1, "Reading parsed response of '%s'", source.url.c_str());
+				reader.Read(*parsed);
+				continue;
+			}
+			// Cached responses are compressed, decode them while parsing.
+			ContentDecoder decoder([&reader](const char *data, size_t data_length) {
+				return reader.Consume(data, data_length);
+			});
+			const auto &body = source.slice.entry->body;
+
+			if (decoder.Write(body.data(), body.size())) {
+				decoder.Finish();
+				reader.Finish();
+			}
+		}
+
+		// Keep a whole response (not stopped by a LIMIT) in the caches of the process.
+
+		auto cache_response = [&](const FetchSource &source, TsvReader &reader, ResponseCache::BodyWriter *body) {
+			if (!source.cacheable || reader.LimitReached() || reader.line_index == 0) {
+				return;
+			}
+			auto parsed = reader.builder ? reader.builder->Finish() : nullptr;
+			if (parsed) {
+				task.parsed_cache->Insert(task.GetParsedKey(source.query), std::move(parsed), task.parsed_cache_memory);
+			}
+			auto compressed_body = body ? body->Finish() : string();
+			if (!compressed_body.empty()) {
+				ResponseCache::Get().Insert(dataflow_key, source.query, std::move(compressed_body), task.cache_ttl,
+				                            task.cache_memory);
+			}
+		};
+
+		// Read a response published in a shared cache directory, copying it to the local one (if leased).
+
+		auto read_shared_response = [&](idx_t source_index, SharedCacheDirectory &directory,
+		                                SharedCacheDirectory::Writer *copy) {
+			const auto &source = sources[source_index];
+
+			TsvReader reader(data_table, task.data_structure, row_keys, check_keys, row_limit, task.row_filter.get(),
+			                 nullptr);
+			unique_ptr<ResponseCache::BodyWriter> body;
+
+			if (task.parsed_cache) {
+				reader.builder = make_uniq<ParsedResponseBuilder>(*task.settings.allocator, task.parsed_cache_memory);
+			}
+			if (task.cache_ttl > 0) {
+				body = make_uniq<ResponseCache::BodyWriter>(task.cache_memory);
+			}
+			std::vector<SharedCacheDirectory::Writer *> writers;
+			if (copy) {
+				writers.push_back(copy);
+			}
+			auto receiver = GetContentReceiver(reader, body.get(), writers);
+
+			if (!directory.Read(task.GetParsedKey(source.query), receiver)) {
+				return false;
+			}
+			EUROSTAT_SCAN_DEBUG_LOG(1, "Reading shared cached response of '%s'", source.url.c_str());
+			record_cache_hit(&directory == task.remote_cache.get() ? "remote" : "shared");
+			reader.Finish();
+
+			if (copy && !reader.LimitReached() && reader.line_index > 0) {
+				copy->Commit();
+			}
+			cache_response(source, reader, body.get());
+			return true;
+		};
+
+		// Read a response published in the remote cache directory by another node.
+
+		std::unordered_map<idx_t, unique_ptr<SharedCacheDirectory::Lease>> leases;
+
+		auto read_remote_response = [&](idx_t source_index) {
+			if (!task.remote_cache) {
+				return false;
+			}
+			unique_ptr<SharedCacheDirectory::Writer> copy;
+			if (leases.count(source_index)) {
+				copy = task.shared_cache->CreateWriter(task.GetParsedKey(sources[source_index].query));
+			}
+			if (!read_shared_response(source_index, *task.remote_cache, copy.get())) {
+				return false;
+			}
+			copy.reset();
+			leases.erase(source_index);
+			return true;
+		};
+
+		// Refresh the heartbeat of the leases while responses are received, so the other processes keep waiting
+		// for them (their requests may be queued behind the other requests of the batch).
+
+		auto refresh_leases = [&leases]() {
+			for (auto &entry : leases) {
+				entry.second->Refresh();
+			}
+		};
+
+		// Download the responses, with a LIMIT fetch URLs one by one to stop as soon as enough rows were read,
+		// otherwise all at once (they are multiplexed concurrently by the 'curl' transport). The responses of the
+		// leased requests are published to the shared cache directory, and the cacheable ones to the remote one.
+
+		auto download_sources = [&](const std::vector<idx_t> &download_indexes) {
+			const idx_t batch_size = row_limit > 0 ? 1 : download_indexes.size();
+
+			for (idx_t batch_start = 0; batch_start < download_indexes.size(); batch_start += batch_size) {
+				// Do we can stop parsing more rows?
+				if ((row_limit > 0 && data_table.row_count >= row_limit) || data_table.canceled) {
+					break;
+				}
+				const idx_t batch_end = MinValue<idx_t>(batch_start + batch_size, download_indexes.size());
+				refresh_leases();
+
+				// Parse TSV responses (Header + Rows) while they are downloaded, errors are reported as XML
+				// documents. Responses of cacheable requests are kept, unless they are larger than the cache.
+
+				vector<unique_ptr<TsvReader>> readers;
+				vector<unique_ptr<ResponseCache::BodyWriter>> bodies;
+				vector<unique_ptr<SharedCacheDirectory::Writer>> writers;
+				vector<unique_ptr<SharedCacheDirectory::Writer>> remote_writers;
+				vector<HttpStreamRequest> requests;
+
+				for (idx_t i = batch_start; i < batch_end; i++) {
+					const auto source_index = download_indexes[i];
+					const auto &source = sources[source_index];
+
+					EUROSTAT_SCAN_DEBUG_LOG(1, "Fetching data from URL: %s", source.url.c_str());
+
+					readers.push_back(make_uniq<TsvReader>(data_table, task.data_structure, row_keys, check_keys,
+					                                       row_limit, task.row_filter.get(), nullptr));
+					auto &reader = *readers.back();
+					bodies.push_back(source.cacheable && task.cache_ttl > 0
+					                     ? make_uniq<ResponseCache::BodyWriter>(task.cache_memory)
+					                     : nullptr);
+
+					if (source.cacheable && task.parsed_cache) {
+						reader.builder =
+						    make_uniq<ParsedResponseBuilder>(*task.settings.allocator, task.parsed_cache_memory);
+					}
+					writers.push_back(leases.count(source_index)
+					                      ? task.shared_cache->CreateWriter(task.GetParsedKey(source.query))
+					                      : nullptr);
+					remote_writers.push_back(source.cacheable && task.remote_cache
+					                             ? task.remote_cache->CreateWriter(task.GetParsedKey(source.query))
+					                             : nullptr);
+
+					std::vector<SharedCacheDirectory::Writer *> content_writers;
+					for (auto writer : {writers.back().get(), remote_writers.back().get()}) {
+						if (writer) {
+							content_writers.push_back(writer);
+						}
+					}
+
+					HttpStreamRequest request(source.url);
+					request.response_handler = [](const HttpResponseData &response) {
+						return response.status_code == 200 && response.content_type != "application/xml";
+					};
+					request.content_receiver =
+					    GetContentReceiver(reader, bodies.back().get(), content_writers, refresh_leases);
+					request.negative_result = [](const HttpResponseData &response) {
+						return response.status_code == 404 ||
+						       (response.status_code == 200 && response.content_type == "application/xml");
+					};
+					requests.push_back(std::move(request));
+					url_count++;
+				}
+
+				// Execute HTTP GET requests.
+
+				HttpRequest::StreamHttpRequests(task.settings, requests);
+
+				for (idx_t i = 0; i < requests.size(); i++) {
+					const auto &response = requests[i].response;
+					const auto source_index = download_indexes[batch_start + i];
+
+					if (response.content_type == "application/xml") {
+						std::string error_msg = EurostatUtils::GetXmlErrorMessage(response.body);
+
+						EUROSTAT_SCAN_DEBUG_LOG(
+						    1, "Failed to fetch a dataset from provider='%s', dataflow='%s': (%d) %s",
+						    provider_id.c_str(), dataflow_id.c_str(), response.status_code, error_msg.c_str());
+
+						// No data for this URL, the rows of the other URLs are kept.
+						if (response.status_code == 200) {
+							leases.erase(source_index);
+							continue;
+						}
+						throw IOException(
+						    "EUROSTAT: Failed to fetch a dataset from provider='%s', dataflow='%s': (%d) %s",
+						    provider_id.c_str(), dataflow_id.c_str(), response.status_code, error_msg.c_str());
+					}
+					if (response.status_code != 200) {
+						throw IOException(
+						    "EUROSTAT: Failed to fetch a dataset from provider='%s', dataflow='%s': (%d) %s",
+						    provider_id.c_str(), dataflow_id.c_str(), response.status_code, response.error.c_str());
+					}
+					if (!response.error.empty()) {
+						throw IOException("EUROSTAT: " + response.error);
+					}
+					readers[i]->Finish();
+
+					// Publish the whole response to the other processes and nodes, then release its lease.
+
+					for (auto writer : {writers[i].get(), remote_writers[i].get()}) {
+						if (writer && !readers[i]->LimitReached() && readers[i]->line_index > 0 && writer->Commit()) {
+							EUROSTAT_SCAN_DEBUG_LOG(1, "Published shared cached response of '%s'",
+							                        sources[source_index].url.c_str());
+						}
+					}
+					writers[i].reset();
+					remote_writers[i].reset();
+					leases.erase(source_index);
+
+					cache_response(sources[source_index], *readers[i], bodies[i].get());
+				}
+			}
+		};
+
+		// Responses missing from the caches of the process: read the ones published in the shared cache directory,
+		// or in the remote one, download the others, holding their lease so other processes wait for them instead of
+		// downloading them too.
+
+		if (!task.shared_cache && !task.remote_cache) {
+			download_sources(requests_sources);
+		} else {
+			std::vector<idx_t> download_indexes;
+			std::vector<idx_t> waiting_indexes;
+
+			for (const auto source_index : requests_sources) {
+				if ((row_limit > 0 && data_table.row_count >= row_limit) || data_table.canceled) {
+					break;
+				}
+				if (!sources[source_index].cacheable) {
+					download_indexes.push_back(source_index);
+					continue;
+				}
+				if (task.shared_cache) {
+					if (read_shared_response(source_index, *task.shared_cache, nullptr)) {
+						continue;
+					}
+					auto lease = task.shared_cache->TryLease(task.GetParsedKey(sources[source_index].query));
+
+					if (!lease) {
+						waiting_indexes.push_back(source_index);
+						continue;
+					}
+					leases[source_index] = std::move(lease);
+				}
+				if (read_remote_response(source_index)) {
+					continue;
+				}
+				download_indexes.push_back(source_index);
+			}
+			download_sources(download_indexes);
+
+			// Requests downloaded by other processes: read their response once published, or download it if the
+			// other process failed.
+
+			download_indexes.clear();
+
+			for (const auto source_index : waiting_indexes) {
+				if ((row_limit > 0 && data_table.row_count >= row_limit) || data_table.canceled) {
+					break;
+				}
+				const auto key = task.GetParsedKey(sources[source_index].query);
+
+				EUROSTAT_SCAN_DEBUG_LOG(1, "Waiting the download of '%s' by another process",
+				                        sources[source_index].url.c_str());
+				task.shared_cache->WaitLease(key, data_table.canceled);
+
+				if (read_shared_response(source_index, *task.shared_cache, nullptr)) {
+					continue;
+				}
+				auto lease = task.shared_cache->TryLease(key);
+				if (lease) {
+					leases[source_index] = std::move(lease);
+				}
+				if (read_remote_response(source_index)) {
+					continue;
+				}
+				download_indexes.push_back(source_index);
+			}
+			download_sources(download_indexes);
+		}
+
+		EUROSTAT_SCAN_DEBUG_LOG(1, "Finished fetching data. Total URLs: %d", url_count);
+		EUROSTAT_SCAN_DEBUG_LOG(1, "Total rows: %zu", data_table.row_count);
+	}
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
+		auto &data_table = global_state->Cast<State>();
+
+		std::copy(input.column_ids.begin(), input.column_ids.end(), std::back_inserter(data_table.column_ids));
+		data_table.Initialize(context, bind_data.data_structure, bind_data.dimension_types, bind_data.label_columns);
+
+		// The filters can not match any row, no need to send any request.
+
+		if (bind_data.empty_result) {
+			data_table.Finalize();
+			return global_state;
+		}
+
+		// Aggregate over one dimension (DISTINCT, MIN, MAX), answer it from metadata.
+
+		if (bind_data.metadata_column != DConstants::INVALID_INDEX) {
+			LoadDimensionValues(context, bind_data, data_table);
+			data_table.Finalize();
+			return global_state;
+		}
+
+		// Rows of a single request arrive sorted (elided ORDER BY) and grouped by the partition columns.
+		data_table.order_columns = bind_data.order_columns;
+
+		if (!bind_data.partition_columns.empty()) {
+			for (const auto &column_id : bind_data.partition_columns) {
+				const auto it =
+				    std::find(data_table.stored_columns.begin(), data_table.stored_columns.end(), column_id);
+
+				if (it == data_table.stored_columns.end()) {
+					throw InternalException("EUROSTAT: Partition column %llu is not read by the scan", column_id);
+				}
+				data_table.partition_columns.push_back(NumericCast<idx_t>(it - data_table.stored_columns.begin()));
+			}
+		}
+
+		const auto it = eurostat::ENDPOINTS.find(bind_data.provider_id);
+		string base_url = it->second.api_url + "data/" + bind_data.dataflow_id;
+
+		FetchTask task;
+		task.provider_id = bind_data.provider_id;
+		task.dataflow_id = bind_data.dataflow_id;
+		task.data_structure = bind_data.data_structure;
+		task.base_url = base_url;
+		task.filter_clauses = GetFilterClauses(bind_data);
+		task.observations_clause = GetObservationsClause(bind_data);
+		task.row_limit = bind_data.limit;
+		task.row_filter = bind_data.row_filter;
+		task.ordered = !bind_data.order_columns.empty() || !bind_data.partition_columns.empty();
+		task.settings = HttpRequest::ExtractHttpSettings(context, base_url);
+		task.settings.timeout = 90;
+		task.settings.statistics = data_table.statistics = make_shared_ptr<HttpStatistics>();
+		task.settings.priority = RequestPriority::INTERACTIVE;
+		task.settings.canceled = &data_table.canceled;
+
+		if (task.settings.hedging && task.settings.transport == HttpTransport::CURL) {
+			data_table.statistics->EnableHedging();
+		}
+
+		Value priority;
+		if (context.TryGetCurrentSetting("eurostat_request_priority", priority) && !priority.IsNull()) {
+			task.settings.priority = RequestScheduler::ParseDataPriority(priority.ToString());
+		}
+
+		// Answer the requests from the cached responses of previous scans, if enabled.
+
+		Value cache_setting;
+		if (task.settings.use_cache && context.TryGetCurrentSetting("eurostat_response_cache_ttl", cache_setting) &&
+		    !cache_setting.IsNull()) {
+			task.cache_ttl = UBigIntValue::Get(cache_setting);
+		}
+		if (context.TryGetCurrentSetting("eurostat_response_cache_size", cache_setting) && !cache_setting.IsNull()) {
+			task.cache_memory = DBConfig::ParseMemoryLimit(cache_setting.ToString());
+		}
+		if (task.cache_memory == 0) {
+			task.cache_ttl = 0;
+		}
+		if (task.settings.use_cache && context.TryGetCurrentSetting("eurostat_parsed_cache_size", cache_setting) &&
+		    !cache_setting.IsNull()) {
+			task.parsed_cache_memory = DBConfig::ParseMemoryLimit(cache_setting.ToString());
+		}
+
+		string cache_directory;
+		if (task.settings.use_cache && context.TryGetCurrentSetting("eurostat_cache_directory", cache_setting) &&
+		    !cache_setting.IsNull()) {
+			cache_directory = cache_setting.ToString();
+		}
+		string remote_cache_directory;
+		if (task.settings.use_cache &&
+		    context.TryGetCurrentSetting("eurostat_remote_cache_directory", cache_setting) && !cache_setting.IsNull()) {
+			remote_cache_directory = cache_setting.ToString();
+		}
+
+		// Cached responses are only used for the current update of the dataflow, no cache is used when it is unknown.
+
+		if ((task.cache_ttl > 0 || task.parsed_cache_memory > 0 || !cache_directory.empty() ||
+		     !remote_cache_directory.empty()) &&
+		    task.observations_clause.empty()) {
+			task.data_version = EurostatUtils::DataflowUpdateOf(context, bind_data.provider_id, bind_data.dataflow_id);
+		}
+		if (task.data_version.empty()) {
+			// Unknown update (or Top-N responses, not keyed by their query), responses can not be reused.
+			task.cache_ttl = 0;
+		}
+		if (task.parsed_cache_memory > 0 && !task.data_version.empty()) {
+			task.parsed_cache = ObjectCache::GetObjectCache(context).GetOrCreate<ParsedResponseCache>(
+			    ParsedResponseCache::ObjectType());
+		}
+		if (!cache_directory.empty() && !task.data_version.empty()) {
+			auto &fs = FileSystem::GetFileSystem(context);
+			task.shared_cache = make_shared_ptr<SharedCacheDirectory>(fs, cache_directory);
+		}
+
+		// The remote file systems (e.g. S3) read their settings and secrets through the opener of the client, which
+		// outlives the scan (its fetch thread is joined before the end of the query).
+
+		if (!remote_cache_directory.empty() && !task.data_version.empty()) {
+			auto &fs = FileSystem::GetFileSystem(context);
+			auto opener = ClientData::Get(context).file_opener.get();
+			task.remote_cache = make_shared_ptr<SharedCacheDirectory>(fs, remote_cache_directory, opener);
+		}
+
+		// Fetch data from all generated URLs in a background thread, so the network latency overlaps with the
+		// work of other operators (and other EUROSTAT_Read scans) of the query.
+
+		auto fetch = [&data_table, task]() {
+			try {
+				FetchData(data_table, task);
+				data_table.Finalize();
+			} catch (std::exception &ex) {
+				data_table.Fail(ErrorData(ex));
+			} catch (...) {
+				data_table.Fail(ErrorData("EUROSTAT: Unknown error fetching the dataset."));
+			}
+		};
+#ifdef __EMSCRIPTEN__
+		// No threads in the browser, fetch data synchronously.
+		fetch();
+#else
+		data_table.fetch_thread = std::thread(std::move(fetch));
+#endif
+
+		return global_state;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Optimize (LIMIT, Top-N, DISTINCT pushdown and ORDER BY elision)
+	//------------------------------------------------------------------------------------------------------------------
+
+	//! Kind of an output column of the EUROSTAT_Read scan.
+	enum class ColumnKind : uint8_t { UNKNOWN, DIMENSION, TIME_PERIOD, OBSERVATION_VALUE };
 
-	struct State final : GlobalTableFunctionState {
-		std::vector<column_t> column_ids;
-		std::vector<DimensionValues> dimensions;
-		std::vector<Datarow> rows;
-		idx_t current_row;
+	//! Returns the EUROSTAT_Read scan of a LogicalOperator, nullptr if it is not.
+	static LogicalGet *GetEurostatScan(LogicalOperator &op) {
+		if (op.type != LogicalOperatorType::LOGICAL_GET) {
+			return nullptr;
+		}
+		auto &get = op.Cast<LogicalGet>();
 
-		explicit State() : current_row(0) {
+		// Identify the scan by its function pointer, cheaper than comparing names.
+		if (get.function.function != Execute) {
+			return nullptr;
 		}
-	};
+		return &get;
+	}
 
-	//! Parse a data row from a TSV line.
-	static bool ParseDatarow(State &data_table, const std::vector<string> &time_periods, int32_t geo_column_index,
-	                         const string &line, std::unordered_map<string, bool> &row_keys, const bool &check_keys,
-	                         const std::size_t &row_limit) {
-		std::vector<bool> state_keys;
+	//! Follows a column binding down through projections and filters, returns the operator that produces it.
+	static LogicalOperator *ResolveBinding(LogicalOperator &op, ColumnBinding &binding) {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &projection = op.Cast<LogicalProjection>();
 
-		// Split line by tabs.
+			if (binding.table_index != projection.table_index) {
+				return nullptr;
+			}
+			const auto &expr = *projection.expressions[binding.column_index];
+
+			if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+				return nullptr;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			return ResolveBinding(*op.children[0], binding);
+		}
+		case LogicalOperatorType::LOGICAL_FILTER:
+			return ResolveBinding(*op.children[0], binding);
 
-		std::istringstream line_stream(line);
-		std::string token;
-		std::vector<std::string> tokens;
+		case LogicalOperatorType::LOGICAL_WINDOW: {
+			auto &window = op.Cast<LogicalWindow>();
 
-		while (std::getline(line_stream, token, '\t')) {
-			tokens.emplace_back(token);
+			if (binding.table_index == window.window_index) {
+				return &op;
+			}
+			return ResolveBinding(*op.children[0], binding);
 		}
-		if (tokens.empty()) {
-			return false;
+		case LogicalOperatorType::LOGICAL_GET: {
+			auto &get = op.Cast<LogicalGet>();
+			return binding.table_index == get.table_index ? &op : nullptr;
+		}
+		default:
+			return nullptr;
+		}
+	}
+
+	//! Returns the column of the EUROSTAT_Read scan referenced by an expression evaluated on top of the given operator,
+	//! INVALID_INDEX if it is not a column of a scan.
+	static column_t GetScanColumn(LogicalOperator &op, const Expression &expr, LogicalGet *&out_get) {
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return DConstants::INVALID_INDEX;
 		}
+		ColumnBinding binding = expr.Cast<BoundColumnRefExpression>().binding;
 
-		// Check if the row keys are valid (if enabled).
+		auto producer = ResolveBinding(op, binding);
+		auto get = producer ? GetEurostatScan(*producer) : nullptr;
+		if (!get) {
+			return DConstants::INVALID_INDEX;
+		}
 
-		if (check_keys) {
-			bool all_are_duplicated = true;
+		// Map the binding to the column of the table function.
 
-			for (const auto &time_period : time_periods) {
-				std::string row_key = tokens[0] + "|" + time_period;
+		idx_t index = binding.column_index;
 
-				if (row_keys.find(row_key) != row_keys.end()) {
-					state_keys.push_back(true);
-				} else {
-					state_keys.push_back(false);
-					row_keys.emplace(row_key, true);
-					all_are_duplicated = false;
-				}
-			}
-			if (all_are_duplicated) {
-				return true;
+		if (!get->projection_ids.empty()) {
+			if (index >= get->projection_ids.size()) {
+				return DConstants::INVALID_INDEX;
 			}
+			index = get->projection_ids[index];
 		}
 
-		// Parse dimensions from first token (comma-separated).
+		const auto &column_ids = get->GetColumnIds();
+		if (index >= column_ids.size() || column_ids[index].IsVirtualColumn()) {
+			return DConstants::INVALID_INDEX;
+		}
+		out_get = get;
+		return column_ids[index].GetPrimaryIndex();
+	}
 
-		DimensionValues dim_values;
-		std::istringstream dim_stream(tokens[0]);
+	//! Returns the kind of column referenced by an expression evaluated on top of the given operator.
+	static ColumnKind GetColumnKind(LogicalOperator &op, const Expression &expr, LogicalGet *&out_get) {
+		LogicalGet *get = nullptr;
+		const auto column_id = GetScanColumn(op, expr, get);
 
-		while (std::getline(dim_stream, token, ',')) {
-			dim_values.values.emplace_back(token);
-		}
-		if (geo_column_index != -1) {
-			auto geo_level = eurostat::Dimension::GetGeoLevelFromGeoCode(dim_values.values[geo_column_index]);
-			dim_values.values.emplace_back(std::move(geo_level));
+		if (column_id == DConstants::INVALID_INDEX) {
+			return ColumnKind::UNKNOWN;
 		}
+		const auto &data_structure = get->bind_data->Cast<BindData>().data_structure;
 
-		data_table.dimensions.emplace_back(std::move(dim_values));
+		out_get = get;
 
-		// Parse observation values for each time period.
+		if (column_id == data_structure.size()) {
+			return ColumnKind::OBSERVATION_VALUE;
+		}
+		if (column_id > data_structure.size()) {
+			return ColumnKind::UNKNOWN;
+		}
+		if (data_structure[column_id].name == "time_period") {
+			return ColumnKind::TIME_PERIOD;
+		}
+		return ColumnKind::DIMENSION;
+	}
 
-		for (size_t i = 0; i < time_periods.size(); i++) {
-			// Duplicate row, skip.
+	//! Checks if an expression only references dimension columns (that is, it is constant for a whole series).
+	static bool ReferencesOnlyDimensions(LogicalOperator &op, const Expression &expr) {
+		if (expr.IsVolatile()) {
+			return false;
+		}
+		if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+			LogicalGet *get = nullptr;
+			return GetColumnKind(op, expr, get) == ColumnKind::DIMENSION;
+		}
 
-			if (check_keys && state_keys[i]) {
-				continue;
+		bool result = true;
+		ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+			if (result && !ReferencesOnlyDimensions(op, child)) {
+				result = false;
 			}
+		});
+		return result;
+	}
 
-			string value_str = tokens[i + 1];
-			StringUtil::Trim(value_str);
-
-			// Store the row.
+	//! Returns the EUROSTAT_Read scan under the operator, if there are only projections and filters on
+	//! dimensions in between, i.e. whole series are kept or removed.
+	static LogicalGet *GetSeriesPreservingScan(LogicalOperator &op) {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+			return GetSeriesPreservingScan(*op.children[0]);
+
+		case LogicalOperatorType::LOGICAL_FILTER:
+			for (const auto &expr : op.expressions) {
+				if (!ReferencesOnlyDimensions(*op.children[0], *expr)) {
+					return nullptr;
+				}
+			}
+			return GetSeriesPreservingScan(*op.children[0]);
 
-			if (!value_str.empty() && value_str != ":") {
-				double value = 0.0;
+		case LogicalOperatorType::LOGICAL_GET:
+			return GetEurostatScan(op);
 
-				if (TryCast::Operation(string_t(value_str), value, false)) {
-					Datarow datarow;
-					datarow.dimension_index = data_table.dimensions.size() - 1;
-					datarow.time_period = time_periods[i];
-					datarow.observation_value = value;
+		default:
+			return nullptr;
+		}
+	}
 
-					data_table.rows.emplace_back(datarow);
+	//! Sets the number of observations per series to request, 'lastNObservations' or 'firstNObservations'.
+	static void PushdownObservations(LogicalGet &get, bool last_observations, idx_t count) {
+		auto &bind_data = get.bind_data->Cast<BindData>();
 
-					// Do we can stop parsing more rows?
-					if (row_limit > 0 && data_table.rows.size() >= row_limit) {
-						EUROSTAT_SCAN_DEBUG_LOG(1, "LIMIT pushdown %li reached, stopping parsing!", row_limit);
-						return true;
-					}
-				}
+		if (last_observations) {
+			if (bind_data.first_n_observations > 0) {
+				return;
+			}
+			bind_data.last_n_observations = MaxValue<idx_t>(bind_data.last_n_observations, count);
+			EUROSTAT_SCAN_DEBUG_LOG(1, "Top-N pushdown: lastNObservations=%zu", bind_data.last_n_observations);
+		} else {
+			if (bind_data.last_n_observations > 0) {
+				return;
 			}
+			bind_data.first_n_observations = MaxValue<idx_t>(bind_data.first_n_observations, count);
+			EUROSTAT_SCAN_DEBUG_LOG(1, "Top-N pushdown: firstNObservations=%zu", bind_data.first_n_observations);
 		}
-		return true;
 	}
 
-	//! Generate data URLs based on input filters and data structure.
-	static std::vector<string> GetDataUrls(ClientContext &context, TableFunctionInitInput &input,
-	                                       const std::vector<eurostat::Dimension> &data_structure,
-	                                       const string &base_url, const BindData &bind_data) {
-		std::unordered_map<string, bool> urls;
-
-		// Use complex filters previously parsed in 'PushdownComplexFilter' function.
+	//! Top-N pushdown of "ORDER BY [dimensions...,] time_period [ASC|DESC] LIMIT n".
+	//! The first/last n periods of every series are a superset of the Top-N rows, DuckDB still applies the Top-N.
+	static void TryPushdownTopN(LogicalOperator &child, const vector<BoundOrderByNode> &orders, idx_t count) {
+		if (orders.empty() || count == 0) {
+			return;
+		}
+		auto get = GetSeriesPreservingScan(child);
+		if (!get) {
+			return;
+		}
 
-		for (const auto &filter_clause : bind_data.complex_filters) {
-			if (!filter_clause.empty()) {
-				string url = base_url + filter_clause + "format=TSV&compressed=true";
+		// Leading keys must be dimensions, so rows of a series are consecutive in the ordering.
+		for (idx_t i = 0; i + 1 < orders.size(); i++) {
+			LogicalGet *column_get = nullptr;
 
-				if (urls.find(url) == urls.end()) {
-					urls.emplace(url, true);
-				}
+			if (GetColumnKind(child, *orders[i].expression, column_get) != ColumnKind::DIMENSION || column_get != get) {
+				return;
 			}
 		}
-		if (urls.empty()) {
-			string url = base_url + "?format=TSV&compressed=true";
-			urls.emplace(url, true);
-		}
-
-		// Return the list of unique URLs.
 
-		std::vector<std::string> keys;
-		keys.reserve(urls.size());
+		// Last key must be the time period.
+		const auto &last_order = orders.back();
+		LogicalGet *column_get = nullptr;
 
-		for (const auto &pair : urls) {
-			keys.push_back(pair.first);
+		if (GetColumnKind(child, *last_order.expression, column_get) != ColumnKind::TIME_PERIOD || column_get != get) {
+			return;
+		}
+		if (last_order.type == OrderType::DESCENDING) {
+			PushdownObservations(*get, true, count);
+		} else if (last_order.type == OrderType::ASCENDING) {
+			PushdownObservations(*get, false, count);
 		}
-
-		return keys;
 	}
 
-	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
-		auto &bind_data = input.bind_data->Cast<BindData>();
-		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
-		auto &data_table = global_state->Cast<State>();
+	//! Extracts the rank bound 'n' of a "rank <= n" (or "rank < n", "rank = n") predicate.
+	static bool GetRankBound(const Expression &expr, ColumnBinding &out_binding, idx_t &out_count) {
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+			return false;
+		}
+		const auto &comparison = expr.Cast<BoundComparisonExpression>();
+		const Expression *column = comparison.left.get();
+		const Expression *constant = comparison.right.get();
+		auto comparison_type = comparison.GetExpressionType();
+
+		if (column->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+			std::swap(column, constant);
+			comparison_type = FlipComparisonExpression(comparison_type);
+		}
+		if (column->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF ||
+		    constant->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+			return false;
+		}
 
-		std::copy(input.column_ids.begin(), input.column_ids.end(), std::back_inserter(data_table.column_ids));
-		const string &provider_id = bind_data.provider_id;
-		const string &dataflow_id = bind_data.dataflow_id;
-		const std::size_t &row_limit = bind_data.limit;
+		Value bound = constant->Cast<BoundConstantExpression>().value;
+		if (bound.IsNull() || !bound.DefaultTryCastAs(LogicalType::BIGINT)) {
+			return false;
+		}
+		int64_t count = bound.GetValue<int64_t>();
+
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_EQUAL:
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+			count--;
+			break;
+		default:
+			return false;
+		}
+		if (count <= 0) {
+			return false;
+		}
 
-		const auto it = eurostat::ENDPOINTS.find(provider_id);
-		string base_url = it->second.api_url + "data/" + dataflow_id;
-		int32_t url_count = 0;
+		out_binding = column->Cast<BoundColumnRefExpression>().binding;
+		out_count = static_cast<idx_t>(count);
+		return true;
+	}
 
-		// Fetch data from all generated URLs
+	//! Top-N pushdown of "ROW_NUMBER() OVER (PARTITION BY dimensions... ORDER BY time_period [ASC|DESC]) <= n".
+	//! Partitions are unions of whole series, so the first/last n periods of every series contain the result.
+	static void TryPushdownWindowTopN(LogicalOperator &filter) {
+		auto &child = *filter.children[0];
 
-		HttpSettings settings;
+		for (const auto &expr : filter.expressions) {
+			ColumnBinding binding;
+			idx_t count = 0;
 
-		const auto &data_urls = GetDataUrls(context, input, bind_data.data_structure, base_url, bind_data);
-		std::unordered_map<string, bool> row_keys;
-		bool check_keys = data_urls.size() > 1;
+			if (!GetRankBound(*expr, binding, count)) {
+				continue;
+			}
+			auto producer = ResolveBinding(child, binding);
+			if (!producer || producer->type != LogicalOperatorType::LOGICAL_WINDOW) {
+				continue;
+			}
+			auto &window = producer->Cast<LogicalWindow>();
 
-		for (const auto &data_url : data_urls) {
-			// Do we can stop parsing more rows?
-			if (row_limit > 0 && data_table.rows.size() >= row_limit) {
+			if (window.expressions.size() != 1) {
+				continue;
+			}
+			const auto &window_expr = window.expressions[0]->Cast<BoundWindowExpression>();
+
+			switch (window_expr.GetExpressionType()) {
+			case ExpressionType::WINDOW_ROW_NUMBER:
+			case ExpressionType::WINDOW_RANK:
+			case ExpressionType::WINDOW_RANK_DENSE:
 				break;
+			default:
+				continue;
+			}
+			if (window_expr.filter_expr || window_expr.orders.size() != 1) {
+				continue;
 			}
 
-			EUROSTAT_SCAN_DEBUG_LOG(1, "Fetching data from URL: %s", data_url.c_str());
+			auto &window_child = *window.children[0];
+			auto get = GetSeriesPreservingScan(window_child);
+			if (!get) {
+				continue;
+			}
 
-			// Execute HTTP GET request.
+			bool supported = true;
+			for (const auto &partition : window_expr.partitions) {
+				LogicalGet *column_get = nullptr;
 
-			if (url_count == 0) {
-				settings = HttpRequest::ExtractHttpSettings(context, data_url);
-				settings.timeout = 90;
+				if (GetColumnKind(window_child, *partition, column_get) != ColumnKind::DIMENSION ||
+				    column_get != get) {
+					supported = false;
+					break;
+				}
+			}
+			if (!supported) {
+				continue;
 			}
-			url_count++;
 
-			auto response = HttpRequest::ExecuteHttpRequest(settings, data_url, "GET", HttpHeaders(), "", "");
+			const auto &order = window_expr.orders[0];
+			LogicalGet *column_get = nullptr;
 
-			if (response.content_type == "application/xml") {
-				std::string error_msg = EurostatUtils::GetXmlErrorMessage(response.body);
+			if (GetColumnKind(window_child, *order.expression, column_get) != ColumnKind::TIME_PERIOD ||
+			    column_get != get) {
+				continue;
+			}
+			if (order.type == OrderType::DESCENDING) {
+				PushdownObservations(*get, true, count);
+			} else if (order.type == OrderType::ASCENDING) {
+				PushdownObservations(*get, false, count);
+			}
+			return;
+		}
+	}
+
+	//! Checks if the result of an aggregate only depends on the different values of its input (e.g. DISTINCT,
+	//! MIN, MAX), so duplicated or missing repetitions of rows do not change it.
+	static bool IsDuplicateInsensitive(LogicalOperator &op) {
+		if (op.type == LogicalOperatorType::LOGICAL_DISTINCT) {
+			return op.Cast<LogicalDistinct>().distinct_type == DistinctType::DISTINCT;
+		}
+		if (op.type != LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+			return false;
+		}
+		auto &aggregate = op.Cast<LogicalAggregate>();
 
-				EUROSTAT_SCAN_DEBUG_LOG(1, "Failed to fetch a dataset from provider='%s', dataflow='%s': (%d) %s",
-				                        provider_id.c_str(), dataflow_id.c_str(), response.status_code,
-				                        error_msg.c_str());
+		if (aggregate.grouping_sets.size() > 1) {
+			return false;
+		}
+		for (const auto &expr : aggregate.expressions) {
+			if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+				return false;
+			}
+			const auto &aggr = expr->Cast<BoundAggregateExpression>();
 
-				if (response.status_code == 200) {
-					data_table.rows.clear();
-					return global_state;
-				} else {
-					throw IOException("EUROSTAT: Failed to fetch a dataset from provider='%s', dataflow='%s': (%d) %s",
-					                  provider_id.c_str(), dataflow_id.c_str(), response.status_code,
-					                  error_msg.c_str());
-				}
+			if (aggr.filter || aggr.order_bys) {
+				return false;
+			}
+			if (aggr.IsDistinct()) {
+				continue;
 			}
-			if (response.status_code != 200) {
-				throw IOException("EUROSTAT: Failed to fetch a dataset from provider='%s', dataflow='%s': (%d) %s",
-				                  provider_id.c_str(), dataflow_id.c_str(), response.status_code,
-				                  response.error.c_str());
+			const auto &name = aggr.function.name;
+
+			if (name != "min" && name != "max" && name != "any_value" && name != "arbitrary") {
+				return false;
 			}
-			if (!response.error.empty()) {
-				throw IOException("EUROSTAT: " + response.error);
+		}
+		return true;
+	}
+
+	//! Checks if there is any filter between the operator and the scan.
+	static bool HasFilters(LogicalOperator &op) {
+		if (op.type == LogicalOperatorType::LOGICAL_FILTER) {
+			return true;
+		}
+		for (const auto &child : op.children) {
+			if (HasFilters(*child)) {
+				return true;
 			}
+		}
+		return false;
+	}
 
-			// Parse TSV response (Header + Rows).
+	//! Pushdown of aggregates that only need the different values of dimensions (DISTINCT, MIN, MAX).
+	//! A single dimension is answered from the contentconstraint metadata, several dimensions only need
+	//! one observation per series (lastNObservations=1).
+	static void TryPushdownDistinct(LogicalOperator &op) {
+		if (!IsDuplicateInsensitive(op)) {
+			return;
+		}
+		auto &child = *op.children[0];
+		auto get = GetSeriesPreservingScan(child);
+		if (!get) {
+			return;
+		}
+		auto &bind_data = get->bind_data->Cast<BindData>();
 
-			std::istringstream line_stream(response.body);
-			std::string line, token;
-			int64_t line_index = 0;
+		if (bind_data.limit > 0 || bind_data.first_n_observations > 0 || bind_data.last_n_observations > 0) {
+			return;
+		}
 
-			std::vector<string> time_periods;
-			int32_t geo_column_index = -1;
+		// Check the columns read from the scan, only dimensions are allowed.
 
-			while (std::getline(line_stream, line)) {
-				// Do we can stop parsing more rows?
-				if (row_limit > 0 && data_table.rows.size() >= row_limit) {
-					break;
-				}
+		const auto &column_ids = get->GetColumnIds();
+		const auto &data_structure = bind_data.data_structure;
+		bool has_time_period = false;
 
-				if (!line.empty()) {
-					// Parse header line to...
-					if (line_index == 0) {
-						size_t pos = line.find("\\TIME_PERIOD");
+		if (column_ids.empty()) {
+			return;
+		}
+		for (const auto &column_id : column_ids) {
+			if (column_id.IsVirtualColumn() || column_id.GetPrimaryIndex() >= data_structure.size()) {
+				return;
+			}
+			if (data_structure[column_id.GetPrimaryIndex()].name == "time_period") {
+				has_time_period = true;
+			}
+		}
 
-						if (pos == string::npos) {
-							throw IOException("EUROSTAT: TIME_PERIOD not found in TSV header.");
-						}
+		if (column_ids.size() == 1 && bind_data.complex_filters.empty() && !bind_data.empty_result &&
+		    !HasFilters(child)) {
+			bind_data.metadata_column = column_ids[0].GetPrimaryIndex();
+			EUROSTAT_SCAN_DEBUG_LOG(1, "DISTINCT pushdown: metadata of column %zu", bind_data.metadata_column);
+			return;
+		}
+		if (!has_time_period) {
+			PushdownObservations(*get, true, 1);
+		}
+	}
 
-						// Extract dimension column names (before TIME_PERIOD).
+	//! Returns the EUROSTAT_Read scan under the operator, if there are only projections and filters in between, i.e.
+	//! the order of the rows of the scan is kept.
+	static LogicalGet *GetOrderPreservingScan(LogicalOperator &op) {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+		case LogicalOperatorType::LOGICAL_FILTER:
+			return GetOrderPreservingScan(*op.children[0]);
 
-						std::istringstream stream_1(line.substr(0, pos));
-						int32_t token_index = 0;
+		case LogicalOperatorType::LOGICAL_GET:
+			return GetEurostatScan(op);
 
-						while (std::getline(stream_1, token, ',')) {
-							token = StringUtil::Lower(token);
+		default:
+			return nullptr;
+		}
+	}
 
-							// Add GEO_LEVEL virtual dimension.
-							if (token == "geo") {
-								geo_column_index = token_index;
-								break;
-							}
-							token_index++;
-						}
+	//! Remove an ORDER BY over dimensions and time_period (ascending) of a scan whose rows should arrive in that order
+	//! (a single request, see GetSortedColumns), the scan sorts them if they do not. Otherwise DuckDB sorts them.
+	static bool TryElideOrder(unique_ptr<LogicalOperator> &op) {
+		auto &order = op->Cast<LogicalOrder>();
 
-						// Extract time periods (after TIME_PERIOD).
+		if (!order.projection_map.empty() || order.orders.empty()) {
+			return false;
+		}
+		auto &child = *op->children[0];
+		auto get = GetOrderPreservingScan(child);
+		if (!get) {
+			return false;
+		}
+		auto &bind_data = get->bind_data->Cast<BindData>();
+		const auto &data_structure = bind_data.data_structure;
 
-						std::istringstream stream_2(line.substr(pos + strlen("\\TIME_PERIOD") + 1));
+		if (!bind_data.order_columns.empty() || bind_data.metadata_column != DConstants::INVALID_INDEX) {
+			return false;
+		}
 
-						while (std::getline(stream_2, token, '\t')) {
-							StringUtil::Trim(token);
+		// Keys must be dimensions of the dataflow (VARCHAR) or time_period, ascending, in the order of the series
+		// key with time_period last.
 
-							if (!token.empty()) {
-								time_periods.push_back(token);
-							}
-						}
+		std::vector<column_t> order_columns;
 
-					} else {
-						// Add data row.
-						ParseDatarow(data_table, time_periods, geo_column_index, line, row_keys, check_keys, row_limit);
-					}
-					line_index++;
-				}
+		for (const auto &order_node : order.orders) {
+			LogicalGet *column_get = nullptr;
+			const auto column_id = GetScanColumn(child, *order_node.expression, column_get);
+
+			if (column_id == DConstants::INVALID_INDEX || column_get != get || column_id >= data_structure.size() ||
+			    order_node.type != OrderType::ASCENDING ||
+			    order_node.expression->return_type.id() != LogicalTypeId::VARCHAR) {
+				return false;
 			}
+			const auto &dimension = data_structure[column_id];
+
+			if (dimension.position == -1 && dimension.name != "time_period") {
+				return false;
+			}
+			order_columns.push_back(column_id);
+		}
+		if (!IsSortedBy(GetSortedColumns(bind_data), order_columns, false)) {
+			return false;
 		}
 
-		EUROSTAT_SCAN_DEBUG_LOG(1, "Finished fetching data. Total URLs: %d", url_count);
-		EUROSTAT_SCAN_DEBUG_LOG(1, "Total rows: %zu", data_table.rows.size());
+		EUROSTAT_SCAN_DEBUG_LOG(1, "ORDER BY elided, %zu keys in the order of the response", order_columns.size());
 
-		return global_state;
+		bind_data.order_columns = std::move(order_columns);
+		op = std::move(op->children[0]);
+		return true;
 	}
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Optimize (Only LIMIT pushdown is implemented)
-	//------------------------------------------------------------------------------------------------------------------
+	static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+		// Nothing to do if the query does not read from EUROSTAT.
+
+		auto query_state = input.context.registered_state->Get<ES_ReadQueryState>(ES_READ_QUERY_STATE_KEY);
+		if (!query_state || !query_state->has_scans) {
+			return;
+		}
 
-	static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &op) {
+		OptimizePlan(plan);
+	}
+
+	static void OptimizePlan(unique_ptr<LogicalOperator> &op) {
 		// Apply optimizations on the LogicalPlan
 
-		if (op->type == LogicalOperatorType::LOGICAL_LIMIT) {
+		switch (op->type) {
+		case LogicalOperatorType::LOGICAL_LIMIT: {
 			auto &limit = op->Cast<LogicalLimit>();
 
-			// Only push down simple LIMIT without OFFSET, ORDER BY or GROUP BY, and with a constant value,
-			// as it would change the result of the query.
-			if (limit.limit_val.Type() != LimitNodeType::CONSTANT_VALUE) {
-				return;
-			}
-			if (limit.offset_val.Type() != LimitNodeType::UNSET) {
-				return;
+			// Only push down LIMIT with a constant value.
+			if (limit.limit_val.Type() != LimitNodeType::CONSTANT_VALUE || op->children.size() != 1) {
+				break;
 			}
-			for (const auto &child : op->children) {
-				if (child->type == LogicalOperatorType::LOGICAL_ORDER_BY) {
-					return;
-				}
-				if (child->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
-					return;
-				}
-				if (child->type == LogicalOperatorType::LOGICAL_GET) {
-					auto &get = child->Cast<LogicalGet>();
+			auto &child = op->children[0];
 
-					if (StringUtil::Lower(get.function.name) == "eurostat_read") {
-						auto &bind_data = get.bind_data->Cast<BindData>();
-						bind_data.limit = limit.limit_val.GetConstantValue();
-						EUROSTAT_SCAN_DEBUG_LOG(1, "LIMIT pushdown: %zu", bind_data.limit);
-						return;
-					}
+			// LIMIT over ORDER BY, try Top-N pushdown.
+			if (child->type == LogicalOperatorType::LOGICAL_ORDER_BY) {
+				idx_t offset = 0;
+
+				if (limit.offset_val.Type() == LimitNodeType::CONSTANT_VALUE) {
+					offset = limit.offset_val.GetConstantValue();
+				} else if (limit.offset_val.Type() != LimitNodeType::UNSET) {
+					break;
 				}
+				const auto &orders = child->Cast<LogicalOrder>().orders;
+				TryPushdownTopN(*child->children[0], orders, limit.limit_val.GetConstantValue() + offset);
+				break;
+			}
+
+			// Only push down simple LIMIT without ORDER BY, GROUP BY or filters, as it would change the result of
+			// the query. Projections keep the number of rows, so LIMIT can be pushed through them.
+			idx_t offset = 0;
+
+			if (limit.offset_val.Type() == LimitNodeType::CONSTANT_VALUE) {
+				offset = limit.offset_val.GetConstantValue();
+			} else if (limit.offset_val.Type() != LimitNodeType::UNSET) {
+				break;
+			}
+
+			auto scan = child.get();
+			while (scan->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+				scan = scan->children[0].get();
+			}
+			auto get = GetEurostatScan(*scan);
+			if (get) {
+				auto &bind_data = get->bind_data->Cast<BindData>();
+				bind_data.limit = limit.limit_val.GetConstantValue() + offset;
+				EUROSTAT_SCAN_DEBUG_LOG(1, "LIMIT pushdown: %zu", bind_data.limit);
+				return;
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_TOP_N: {
+			auto &top_n = op->Cast<LogicalTopN>();
+			TryPushdownTopN(*op->children[0], top_n.orders, top_n.limit + top_n.offset);
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER:
+			TryPushdownWindowTopN(*op);
+			break;
+		case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		case LogicalOperatorType::LOGICAL_DISTINCT:
+			TryPushdownDistinct(*op);
+			break;
+		case LogicalOperatorType::LOGICAL_ORDER_BY:
+			if (TryElideOrder(op)) {
+				OptimizePlan(op);
+				return;
 			}
+			break;
+		default:
+			break;
 		}
 
 		// Recurse into children
 		for (auto &child : op->children) {
-			Optimize(input, child);
+			OptimizePlan(child);
 		}
 	}
 
@@ -434,50 +2376,151 @@ struct ES_Read {
 	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
 		auto &gstate = input.global_state->Cast<State>();
 
-		// Calculate how many record we can fit in the output
-		const auto output_size = std::min<idx_t>(STANDARD_VECTOR_SIZE, gstate.rows.size() - gstate.current_row);
-		const auto current_row = gstate.current_row;
+		// Load next subset of rows, waiting for the background fetch if needed.
 
-		if (output_size == 0) {
+		if (gstate.scan_offset >= gstate.scan_chunk.size() && !gstate.FetchChunk(context)) {
 			output.SetCardinality(0);
 			return;
 		}
 
-		// Load current subset of rows.
-		for (idx_t row_idx = 0, record_idx = current_row; row_idx < output_size; row_idx++, record_idx++) {
-			const auto &datarow = gstate.rows[record_idx];
-			const DimensionValues &dim_values = gstate.dimensions[datarow.dimension_index];
-			const auto &dim_count = dim_values.values.size();
+		// Partitioned output, emit the rows of the current partition only.
 
-			for (idx_t col_idx = 0; col_idx < gstate.column_ids.size(); col_idx++) {
-				const auto &dim_index = gstate.column_ids[col_idx];
+		const auto offset = gstate.scan_offset;
+		const auto end = gstate.partition_columns.empty() ? gstate.scan_chunk.size() : gstate.GetPartitionEnd(offset);
+		const auto output_size = end - offset;
 
-				if (dim_index == dim_count) {
-					// Set time period.
-					output.data[col_idx].SetValue(row_idx, Value(datarow.time_period));
-				} else if (dim_index == dim_count + 1) {
-					// Set observation value.
-					output.data[col_idx].SetValue(row_idx, Value(datarow.observation_value));
-				} else {
-					// Set dimension value.
-					output.data[col_idx].SetValue(row_idx, Value(dim_values.values[dim_index]));
-				}
+		gstate.scan_offset = end;
+		gstate.batch_index++;
+		gstate.partition_values.clear();
+
+		for (const auto &col_idx : gstate.partition_columns) {
+			gstate.partition_values.push_back(gstate.scan_chunk.GetValue(col_idx, offset));
+		}
+
+		SelectionVector rows_selection;
+		if (output_size < gstate.scan_chunk.size()) {
+			rows_selection.Initialize(output_size);
+
+			for (idx_t row_idx = 0; row_idx < output_size; row_idx++) {
+				rows_selection.set_index(row_idx, offset + row_idx);
 			}
 		}
 
-		// Update the row index.
-		gstate.current_row += output_size;
+		for (idx_t col_idx = 0; col_idx < gstate.output_columns.size(); col_idx++) {
+			const auto &stored_index = gstate.output_columns[col_idx];
+
+			if (stored_index == DConstants::INVALID_INDEX) {
+				// Virtual column, not provided.
+				output.data[col_idx].SetVectorType(VectorType::CONSTANT_VECTOR);
+				ConstantVector::SetNull(output.data[col_idx], true);
+			} else if (gstate.stored_columns[stored_index] > gstate.observation_column) {
+				// Label column, a dictionary vector over the label table of the dimension.
+				const auto column_id = gstate.stored_columns[stored_index];
+				const auto &label_column = *gstate.label_columns[column_id - gstate.observation_column - 1];
+				const auto indexes = FlatVector::GetData<uint32_t>(gstate.scan_chunk.data[stored_index]);
+
+				SelectionVector selection(output_size);
+				for (idx_t row_idx = 0; row_idx < output_size; row_idx++) {
+					selection.set_index(row_idx, indexes[offset + row_idx]);
+				}
+				output.data[col_idx].Slice(label_column.labels, selection, output_size);
+			} else if (rows_selection.data()) {
+				output.data[col_idx].Slice(gstate.scan_chunk.data[stored_index], rows_selection, output_size);
+			} else {
+				output.data[col_idx].Reference(gstate.scan_chunk.data[stored_index]);
+			}
+		}
 
 		// Set the cardinality of the output.
 		output.SetCardinality(output_size);
 	}
 
+	//------------------------------------------------------------------------------------------------------------------
+	// Partitioning
+	//------------------------------------------------------------------------------------------------------------------
+
+	//! The scan can emit chunks with a single value of dimensions of the dataflow when its rows arrive grouped by them
+	//! (a single request, see GetSortedColumns), so DuckDB aggregates grouped by them per partition instead of hashing
+	//! all the rows (checked while the rows are appended, see CheckPartition). Otherwise the rows are streamed as they
+	//! arrive, not partitioned.
+	static TablePartitionInfo GetPartitionInfo(ClientContext &context, TableFunctionPartitionInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		const auto &data_structure = bind_data.data_structure;
+
+		if (input.partition_ids.empty() || !bind_data.order_columns.empty() ||
+		    bind_data.metadata_column != DConstants::INVALID_INDEX) {
+			return TablePartitionInfo::NOT_PARTITIONED;
+		}
+		for (const auto &column_id : input.partition_ids) {
+			if (column_id >= data_structure.size() || data_structure[column_id].position == -1 ||
+			    data_structure[column_id].name == "time_period") {
+				return TablePartitionInfo::NOT_PARTITIONED;
+			}
+		}
+		if (!IsSortedBy(GetSortedColumns(bind_data), input.partition_ids, true)) {
+			return TablePartitionInfo::NOT_PARTITIONED;
+		}
+		bind_data.partition_columns = input.partition_ids;
+
+		EUROSTAT_SCAN_DEBUG_LOG(1, "Partitioned scan by %zu dimensions", bind_data.partition_columns.size());
+		return TablePartitionInfo::SINGLE_VALUE_PARTITIONS;
+	}
+
+	static OperatorPartitionData GetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+		auto &gstate = input.global_state->Cast<State>();
+
+		// Chunks are emitted in order by a single thread, the batch index is the index of the chunk.
+		OperatorPartitionData result(gstate.batch_index);
+
+		if (input.partition_info.RequiresPartitionColumns()) {
+			if (gstate.partition_values.size() != input.partition_info.partition_columns.size()) {
+				throw InternalException("EUROSTAT: Partition columns requested from a scan not partitioned by them");
+			}
+			for (const auto &value : gstate.partition_values) {
+				result.partition_data.emplace_back(value);
+			}
+		}
+		return result;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Statistics
+	//------------------------------------------------------------------------------------------------------------------
+
+	static InsertionOrderPreservingMap<string> DynamicToString(TableFunctionDynamicToStringInput &input) {
+		InsertionOrderPreservingMap<string> result;
+
+		if (input.bind_data) {
+			auto &bind_data = input.bind_data->Cast<BindData>();
+
+			if (bind_data.row_filter) {
+				result.insert("Row Filter", bind_data.row_filter->ToString(bind_data.data_structure));
+			}
+			// Observations per series requested by Top-N pushdown (e.g. "lastNObservations=2").
+			const auto observations_clause = GetObservationsClause(bind_data);
+			if (!observations_clause.empty()) {
+				result.insert("Observations", observations_clause.substr(0, observations_clause.size() - 1));
+			}
+		}
+		if (input.global_state) {
+			auto &gstate = input.global_state->Cast<State>();
+
+			if (gstate.statistics) {
+				gstate.statistics->ToString(result);
+			}
+		}
+		return result;
+	}
+
 	//------------------------------------------------------------------------------------------------------------------
 	// Documentation
 	//------------------------------------------------------------------------------------------------------------------
 
 	static constexpr auto DESCRIPTION = R"(
 		Reads the dataset of an EUROSTAT Dataflow.
+		With 'enum_dimensions := true', dimensions are typed as ENUM over the codes of the dataflow.
+		With 'labels := true', a '<dimension>_label' column is added for each dimension with a codelist, with the
+		labels of its codes in the given 'language' ('en' by default).
 	)";
 
 	static constexpr auto EXAMPLE = R"(
@@ -512,9 +2555,29 @@ struct ES_Read {
 			column_ids.push_back(col_idx.IsVirtualColumn() ? COLUMN_IDENTIFIER_ROW_ID : col_idx.GetPrimaryIndex());
 		}
 
+		// Values allowed by the contentconstraint of the dataflow, to prune the codes and periods that can not
+		// match any row. Pruning is an optimization, the query is not failed if the metadata is not available.
+
+		DimensionValues allowed_values;
+		bool use_constraint = false;
+
+		Value pruning;
+		if (!expressions.empty() && context.TryGetCurrentSetting("eurostat_constraint_pruning", pruning) &&
+		    !pruning.IsNull() && BooleanValue::Get(pruning)) {
+			try {
+				allowed_values =
+				    EurostatUtils::DimensionValuesOf(context, bind_data.provider_id, bind_data.dataflow_id);
+				use_constraint = true;
+			} catch (std::exception &ex) {
+				EUROSTAT_SCAN_DEBUG_LOG(1, "Constraint pruning disabled, failed to fetch the contentconstraint: %s",
+				                        ex.what());
+			}
+		}
+
 		// Encoded filters to be generated from the input expressions.
 
-		auto result = FilterEncoder::EncodeExpression(expressions, bind_data.data_structure, column_ids);
+		auto result = FilterEncoder::EncodeExpression(expressions, bind_data.data_structure, column_ids,
+		                                              use_constraint ? &allowed_values : nullptr, &context);
 		std::vector<std::string> filters;
 
 		if (result.supported) {
@@ -527,6 +2590,21 @@ struct ES_Read {
 
 		// Store encoded filters in bind data.
 		bind_data.complex_filters = std::move(filters);
+		bind_data.empty_result = result.empty;
+
+		// Filters left to DuckDB, evaluate their simple comparisons (e.g. "observation_value > 1000") while parsing
+		// the rows, so rejected rows are not stored. DuckDB still evaluates them.
+
+		bind_data.row_filter = nullptr;
+
+		if (!expressions.empty()) {
+			auto row_filter = RowFilter::Encode(expressions, bind_data.data_structure, column_ids);
+
+			if (!row_filter->IsEmpty()) {
+				EUROSTAT_SCAN_DEBUG_LOG(1, "Row filter: %s", row_filter->ToString(bind_data.data_structure).c_str());
+				bind_data.row_filter = std::move(row_filter);
+			}
+		}
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -548,9 +2626,23 @@ struct ES_Read {
 		// that cannot be represented as simple TableFilter objects
 		func.pushdown_complex_filter = PushdownComplexFilter;
 
+		// Type the dimensions as ENUM over the codes of the contentconstraint
+		func.named_parameters["enum_dimensions"] = LogicalType::BOOLEAN;
+
+		// Add the labels of the codes of the dimensions, in a language
+		func.named_parameters["labels"] = LogicalType::BOOLEAN;
+		func.named_parameters["language"] = LogicalType::VARCHAR;
+
+		// Emit chunks partitioned by dimensions, for aggregates grouped by them
+		func.get_partition_info = GetPartitionInfo;
+		func.get_partition_data = GetPartitionData;
+
+		// Show the statistics of the HTTP requests (e.g. adaptive concurrency limits) in EXPLAIN ANALYZE
+		func.dynamic_to_string = DynamicToString;
+
 		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
 
-		// Register optimizer extension for LIMIT pushdown
+		// Register optimizer extension for LIMIT, Top-N, DISTINCT pushdown and ORDER BY elision
 		auto &db = loader.GetDatabaseInstance();
 		auto &config = DBConfig::GetConfig(db);
 		OptimizerExtension eurostat_optimizer;
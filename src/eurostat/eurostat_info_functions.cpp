@@ -9,6 +9,8 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "yyjson.hpp"
+#include <chrono>
+#include <mutex>
 using namespace duckdb_yyjson; // NOLINT
 
 // LibXml2
@@ -424,27 +426,32 @@ struct ES_Dataflows {
 		bool load_annotations =
 		    std::find(column_ids.begin(), column_ids.end(), INFO_COLUMN_ANNOTATIONS) != column_ids.end();
 
-		// Get the dataflow metadata collection (synchronously for now)
+		// Get the dataflow metadata collection, all requests are sent as one batch
 
 		std::vector<DataflowInfo> rows;
-		HttpSettings settings;
-		idx_t req_count = 0;
+		std::vector<string> urls;
 
 		for (const auto &provider_id : providers) {
 			const auto it = eurostat::ENDPOINTS.find(provider_id);
 
 			for (const auto &dataflow_id : dataflows) {
-				string url = it->second.api_url + "dataflow/" + it->second.source_id + "/" + dataflow_id +
-				             "?format=JSON&compressed=true&lang=" + language;
+				urls.emplace_back(it->second.api_url + "dataflow/" + it->second.source_id + "/" + dataflow_id +
+				                  "?format=JSON&compressed=true&lang=" + language);
+			}
+		}
+		if (urls.empty()) {
+			return make_uniq_base<GlobalTableFunctionState, State>(column_ids, rows);
+		}
 
-				if (req_count == 0) {
-					settings = HttpRequest::ExtractHttpSettings(context, url);
-				}
-				req_count++;
+		// Execute HTTP GET requests
 
-				// Execute HTTP GET request
+		HttpSettings settings = HttpRequest::ExtractHttpSettings(context, urls[0]);
+		auto responses = HttpRequest::ExecuteHttpRequests(settings, urls);
+		idx_t req_index = 0;
 
-				auto response = HttpRequest::ExecuteHttpRequest(settings, url, "GET", HttpHeaders(), "", "");
+		for (const auto &provider_id : providers) {
+			for (const auto &dataflow_id : dataflows) {
+				const auto &response = responses[req_index++];
 
 				if (response.status_code != 200) {
 					throw IOException(
@@ -682,6 +689,7 @@ static constexpr const char *ES_TIME_DIMENSION_PATH = "/m:Structure/m:Structures
 static constexpr const char *ES_CONCEPT_PATH = "/m:Structure/m:Structures/s:Concepts/s:ConceptScheme/s:Concept";
 static constexpr const char *ES_VALUES_PATH =
     "/m:Structure/m:Structures/s:Constraints/s:ContentConstraint/s:CubeRegion/c:KeyValue";
+static constexpr const char *ES_CODELIST_PATH = "/m:Structure/m:Structures/s:Codelists/s:Codelist";
 
 static constexpr const char *ES_ERROR_PATH = "/S:Fault/faultstring";
 
@@ -707,7 +715,7 @@ struct ES_DataStructure {
 		             "/latest?detail=referencepartial&references=descendants";
 
 		HttpSettings settings = HttpRequest::ExtractHttpSettings(context, url);
-		auto response = HttpRequest::ExecuteHttpRequest(settings, url, "GET", HttpHeaders(), "", "");
+		auto response = HttpRequest::ExecuteHttpRequest(settings, url);
 
 		if (response.status_code != 200) {
 			throw IOException("EUROSTAT: Failed to fetch dataflow metadata from provider='%s', dataflow='%s': (%d) %s",
@@ -805,10 +813,118 @@ struct ES_DataStructure {
 		return dimensions;
 	}
 
-	//! Returns the data structure of an EUROSTAT Dataflow.
-	static std::vector<Dimension> GetDataSchema(ClientContext &context, const string &provider_id,
-	                                            const string &dataflow_id, const string &language) {
-		auto dimensions = ES_DataStructure::GetBasicDataSchema(context, provider_id, dataflow_id, language);
+	//! Returns the labels of the codes of each dimension of an EUROSTAT Dataflow (from the codelists of its data
+	//! structure), in the given language.
+	static std::unordered_map<string, std::unordered_map<string, string>>
+	GetCodeLabels(ClientContext &context, const string &provider_id, const string &dataflow_id,
+	              const string &language) {
+		std::unordered_map<string, std::unordered_map<string, string>> dimension_labels;
+
+		// Execute HTTP GET request
+
+		const auto it = eurostat::ENDPOINTS.find(provider_id);
+		string url = it->second.api_url + "dataflow/" + it->second.source_id + "/" + dataflow_id +
+		             "/latest?detail=referencepartial&references=descendants";
+
+		HttpSettings settings = HttpRequest::ExtractHttpSettings(context, url);
+		auto response = HttpRequest::ExecuteHttpRequest(settings, url);
+
+		if (response.status_code != 200) {
+			throw IOException("EUROSTAT: Failed to fetch dataflow metadata from provider='%s', dataflow='%s': (%d) %s",
+			                  provider_id.c_str(), dataflow_id.c_str(), response.status_code, response.error.c_str());
+		}
+		if (!response.error.empty()) {
+			throw IOException("EUROSTAT: " + response.error);
+		}
+
+		// Get the codelist of each dimension from XML response
+
+		XmlDocument document = XmlDocument(response.body);
+		xmlDocPtr doc_obj = document.GetDoc();
+		xmlXPathContextPtr xpath_ctx = document.GetXPathContext();
+		xmlXPathObjectPtr xpath_obj = nullptr;
+
+		std::unordered_map<string, std::vector<string>> codelist_dimensions;
+
+		if ((xpath_obj = xmlXPathEvalExpression(BAD_CAST ES_DIMENSION_PATH, xpath_ctx)) && xpath_obj->nodesetval) {
+			for (int i = 0; i < xpath_obj->nodesetval->nodeNr; i++) {
+				xmlNodePtr node = xpath_obj->nodesetval->nodeTab[i];
+
+				auto dim_id = XmlUtils::GetNodeAttributeValue(node, "id");
+				if (dim_id.empty()) {
+					continue;
+				}
+				xmlXPathContextPtr local_ctx = xmlXPathNewContext(doc_obj);
+				if (local_ctx) {
+					document.RegisterNamespaces(local_ctx);
+					local_ctx->node = node;
+
+					xmlXPathObjectPtr temp_obj = nullptr;
+					if ((temp_obj = xmlXPathEvalExpression(BAD_CAST "./s:LocalRepresentation/s:Enumeration/Ref",
+					                                       local_ctx)) &&
+					    temp_obj->nodesetval && temp_obj->nodesetval->nodeNr > 0) {
+						xmlNodePtr ref_node = temp_obj->nodesetval->nodeTab[0];
+						auto codelist_id = XmlUtils::GetNodeAttributeValue(ref_node, "id");
+						codelist_dimensions[codelist_id].push_back(StringUtil::Lower(dim_id));
+					}
+					if (temp_obj) {
+						xmlXPathFreeObject(temp_obj);
+					}
+					xmlXPathFreeContext(local_ctx);
+				}
+			}
+		}
+		if (xpath_obj) {
+			xmlXPathFreeObject(xpath_obj);
+			xpath_obj = nullptr;
+		}
+
+		// Get the labels of the codes of each codelist
+
+		if ((xpath_obj = xmlXPathEvalExpression(BAD_CAST ES_CODELIST_PATH, xpath_ctx)) && xpath_obj->nodesetval) {
+			for (int i = 0; i < xpath_obj->nodesetval->nodeNr; i++) {
+				xmlNodePtr node = xpath_obj->nodesetval->nodeTab[i];
+
+				auto codelist_it = codelist_dimensions.find(XmlUtils::GetNodeAttributeValue(node, "id"));
+				if (codelist_it == codelist_dimensions.end()) {
+					continue;
+				}
+				std::unordered_map<string, string> labels;
+
+				for (xmlNodePtr code = node->children; code; code = code->next) {
+					if (code->type != XML_ELEMENT_NODE || strcmp((const char *)code->name, "Code") != 0) {
+						continue;
+					}
+					auto &label = labels[XmlUtils::GetNodeAttributeValue(code, "id")];
+
+					for (xmlNodePtr child = code->children; child; child = child->next) {
+						if (child->type == XML_ELEMENT_NODE && strcmp((const char *)child->name, "Name") == 0) {
+							string lang = XmlUtils::GetNodeAttributeValue(child, "lang", language);
+
+							if (lang == language || label.empty()) {
+								label = XmlUtils::GetNodeTextContent(child);
+							}
+						}
+					}
+				}
+				for (const auto &dim_id : codelist_it->second) {
+					dimension_labels[dim_id] = labels;
+				}
+			}
+		}
+		if (xpath_obj) {
+			xmlXPathFreeObject(xpath_obj);
+			xpath_obj = nullptr;
+		}
+
+		return dimension_labels;
+	}
+
+	//! Returns the different values of the dimensions of an EUROSTAT Dataflow (from its contentconstraint).
+	static std::unordered_map<string, std::vector<string>> GetContentConstraint(ClientContext &context,
+	                                                                            const string &provider_id,
+	                                                                            const string &dataflow_id) {
+		std::unordered_map<string, std::vector<string>> dimension_values;
 
 		// Execute HTTP GET request
 
@@ -816,7 +932,7 @@ struct ES_DataStructure {
 		string url = it->second.api_url + "contentconstraint/" + it->second.source_id + "/" + dataflow_id;
 
 		HttpSettings settings = HttpRequest::ExtractHttpSettings(context, url);
-		auto response = HttpRequest::ExecuteHttpRequest(settings, url, "GET", HttpHeaders(), "", "");
+		auto response = HttpRequest::ExecuteHttpRequest(settings, url);
 
 		if (response.status_code != 200) {
 			throw IOException("EUROSTAT: Failed to fetch dataflow metadata from provider='%s', dataflow='%s': (%d) %s",
@@ -838,17 +954,12 @@ struct ES_DataStructure {
 
 				auto dim_id = XmlUtils::GetNodeAttributeValue(node, "id");
 				if (!dim_id.empty()) {
-					dim_id = StringUtil::Lower(dim_id);
+					auto &values = dimension_values[StringUtil::Lower(dim_id)];
 
-					for (auto &dim : dimensions) {
-						if (dim.id == dim_id) {
-							for (xmlNodePtr child = node->children; child; child = child->next) {
-								if (strcmp((const char *)child->name, "Value") == 0) {
-									string code_value = XmlUtils::GetNodeTextContent(child);
-									dim.values.emplace_back(code_value);
-								}
-							}
-							break;
+					for (xmlNodePtr child = node->children; child; child = child->next) {
+						if (strcmp((const char *)child->name, "Value") == 0) {
+							string code_value = XmlUtils::GetNodeTextContent(child);
+							values.emplace_back(code_value);
 						}
 					}
 				}
@@ -859,6 +970,23 @@ struct ES_DataStructure {
 			xpath_obj = nullptr;
 		}
 
+		return dimension_values;
+	}
+
+	//! Returns the data structure of an EUROSTAT Dataflow.
+	static std::vector<Dimension> GetDataSchema(ClientContext &context, const string &provider_id,
+	                                            const string &dataflow_id, const string &language) {
+		auto dimensions = ES_DataStructure::GetBasicDataSchema(context, provider_id, dataflow_id, language);
+		auto dimension_values = ES_DataStructure::GetContentConstraint(context, provider_id, dataflow_id);
+
+		for (auto &dim : dimensions) {
+			auto values_it = dimension_values.find(dim.id);
+
+			if (values_it != dimension_values.end()) {
+				dim.values = std::move(values_it->second);
+			}
+		}
+
 		return dimensions;
 	}
 
@@ -1080,9 +1208,39 @@ struct ES_DataStructure {
 // Register Metadata/Info Functions
 // #####################################################################################################################
 
+//! Data structures of the dataflows, kept for a while by the process.
+struct ES_DataStructureCache {
+	struct Entry {
+		std::vector<eurostat::Dimension> data_structure;
+		std::chrono::steady_clock::time_point expires_at;
+	};
+	std::mutex lock;
+	std::unordered_map<string, Entry> entries;
+
+	static ES_DataStructureCache &Get() {
+		static ES_DataStructureCache instance;
+		return instance;
+	}
+};
+
+// Time to live of the cached data structures, they change rarely
+static constexpr auto ES_DATA_STRUCTURE_TTL = std::chrono::hours(1);
+
 //! Returns the data structure (dimensions) of a given dataflow
 std::vector<eurostat::Dimension> EurostatUtils::DataStructureOf(ClientContext &context, const std::string &provider_id,
                                                                 const std::string &dataflow_id) {
+	auto &cache = ES_DataStructureCache::Get();
+	const auto key = provider_id + "/" + dataflow_id;
+	const auto now = std::chrono::steady_clock::now();
+	{
+		std::lock_guard<std::mutex> guard(cache.lock);
+		auto it = cache.entries.find(key);
+
+		if (it != cache.entries.end() && it->second.expires_at > now) {
+			return it->second.data_structure;
+		}
+	}
+
 	auto dimensions = ES_DataStructure::GetBasicDataSchema(context, provider_id, dataflow_id, "en");
 	std::vector<eurostat::Dimension> data_structure;
 
@@ -1090,9 +1248,169 @@ std::vector<eurostat::Dimension> EurostatUtils::DataStructureOf(ClientContext &c
 		auto d = eurostat::Dimension {dim.position, dim.id, dim.concept_label};
 		data_structure.emplace_back(d);
 	}
+
+	std::lock_guard<std::mutex> guard(cache.lock);
+	cache.entries[key] = ES_DataStructureCache::Entry {data_structure, now + ES_DATA_STRUCTURE_TTL};
 	return data_structure;
 }
 
+//! Different values of the dimensions of the dataflows, kept by the process per update of their data.
+struct ES_ContentConstraintCache {
+	using DimensionValues = std::unordered_map<std::string, std::vector<std::string>>;
+
+	struct Entry {
+		shared_ptr<const DimensionValues> values;
+		std::chrono::steady_clock::time_point expires_at;
+	};
+	std::mutex lock;
+	std::unordered_map<string, Entry> entries;
+
+	static ES_ContentConstraintCache &Get() {
+		static ES_ContentConstraintCache instance;
+		return instance;
+	}
+};
+
+// Time to live of the cached contentconstraints, also bounds their age when the update time is unknown
+static constexpr auto ES_CONTENT_CONSTRAINT_TTL = std::chrono::hours(1);
+
+//! Returns the different values of the dimensions of a given dataflow, from its contentconstraint
+std::unordered_map<std::string, std::vector<std::string>>
+EurostatUtils::DimensionValuesOf(ClientContext &context, const std::string &provider_id,
+                                 const std::string &dataflow_id) {
+	auto &cache = ES_ContentConstraintCache::Get();
+	const auto key = provider_id + "/" + dataflow_id + "@" + DataflowUpdateOf(context, provider_id, dataflow_id);
+	const auto now = std::chrono::steady_clock::now();
+	{
+		std::lock_guard<std::mutex> guard(cache.lock);
+		auto it = cache.entries.find(key);
+
+		if (it != cache.entries.end() && it->second.expires_at > now) {
+			return *it->second.values;
+		}
+	}
+
+	auto values = make_shared_ptr<ES_ContentConstraintCache::DimensionValues>(
+	    ES_DataStructure::GetContentConstraint(context, provider_id, dataflow_id));
+
+	std::lock_guard<std::mutex> guard(cache.lock);
+	cache.entries[key] = ES_ContentConstraintCache::Entry {values, now + ES_CONTENT_CONSTRAINT_TTL};
+	return *values;
+}
+
+//! Labels of the codes of the dimensions of a dataflow, kept for a while by the process.
+struct ES_CodeLabelsCache {
+	struct Entry {
+		shared_ptr<const EurostatUtils::DimensionLabels> labels;
+		std::chrono::steady_clock::time_point expires_at;
+	};
+	std::mutex lock;
+	std::unordered_map<string, Entry> entries;
+
+	static ES_CodeLabelsCache &Get() {
+		static ES_CodeLabelsCache instance;
+		return instance;
+	}
+};
+
+// Time to live of the cached labels of codes, codelists change rarely
+static constexpr auto ES_CODE_LABELS_TTL = std::chrono::hours(1);
+
+//! Returns the labels of the codes of the dimensions of a given dataflow, from the codelists of its data structure
+shared_ptr<const EurostatUtils::DimensionLabels> EurostatUtils::DimensionLabelsOf(ClientContext &context,
+                                                                                  const std::string &provider_id,
+                                                                                  const std::string &dataflow_id,
+                                                                                  const std::string &language) {
+	auto &cache = ES_CodeLabelsCache::Get();
+	const auto key = provider_id + "/" + dataflow_id + "/" + language;
+	const auto now = std::chrono::steady_clock::now();
+	{
+		std::lock_guard<std::mutex> guard(cache.lock);
+		auto it = cache.entries.find(key);
+
+		if (it != cache.entries.end() && it->second.expires_at > now) {
+			return it->second.labels;
+		}
+	}
+
+	shared_ptr<const DimensionLabels> labels =
+	    make_shared_ptr<DimensionLabels>(ES_DataStructure::GetCodeLabels(context, provider_id, dataflow_id, language));
+
+	std::lock_guard<std::mutex> guard(cache.lock);
+	cache.entries[key] = ES_CodeLabelsCache::Entry {labels, now + ES_CODE_LABELS_TTL};
+	return labels;
+}
+
+//! Last update of the data of the dataflows, kept for a short while by the process.
+struct ES_DataflowUpdateCache {
+	struct Entry {
+		string update_data;
+		std::chrono::steady_clock::time_point expires_at;
+	};
+	std::mutex lock;
+	std::unordered_map<string, Entry> entries;
+
+	static ES_DataflowUpdateCache &Get() {
+		static ES_DataflowUpdateCache instance;
+		return instance;
+	}
+};
+
+// Time to live of the cached update times of the dataflows, datasets are updated a few times a day at most
+static constexpr auto ES_DATAFLOW_UPDATE_TTL = std::chrono::minutes(5);
+
+//! Returns the time of the last update of the data of a given dataflow (its 'UPDATE_DATA' annotation)
+std::string EurostatUtils::DataflowUpdateOf(ClientContext &context, const std::string &provider_id,
+                                            const std::string &dataflow_id) {
+	auto &cache = ES_DataflowUpdateCache::Get();
+	const auto key = provider_id + "/" + dataflow_id;
+	const auto now = std::chrono::steady_clock::now();
+	{
+		std::lock_guard<std::mutex> guard(cache.lock);
+		auto it = cache.entries.find(key);
+
+		if (it != cache.entries.end() && it->second.expires_at > now) {
+			return it->second.update_data;
+		}
+	}
+
+	// Execute HTTP GET request, an unknown update time is not an error.
+
+	const auto it = eurostat::ENDPOINTS.find(provider_id);
+	string url = it->second.api_url + "dataflow/" + it->second.source_id + "/" + dataflow_id +
+	             "?format=JSON&compressed=true&lang=en";
+
+	HttpSettings settings = HttpRequest::ExtractHttpSettings(context, url);
+	auto response = HttpRequest::ExecuteHttpRequest(settings, url);
+
+	if (response.status_code != 200 || !response.error.empty()) {
+		return string();
+	}
+	const auto json_data = yyjson_read(response.body.c_str(), response.body.size(), YYJSON_READ_NOFLAG);
+	if (!json_data) {
+		return string();
+	}
+	string update_data;
+
+	try {
+		auto root_val = yyjson_doc_get_root(json_data);
+		bool load_datastructure = false;
+		bool load_annotations = false;
+
+		if (yyjson_is_obj(root_val)) {
+			update_data = ES_Dataflows::ParseDataflow(provider_id, root_val, load_datastructure, load_annotations)
+			                  .update_data;
+		}
+	} catch (std::exception &) {
+		update_data.clear();
+	}
+	yyjson_doc_free(json_data);
+
+	std::lock_guard<std::mutex> guard(cache.lock);
+	cache.entries[key] = ES_DataflowUpdateCache::Entry {update_data, now + ES_DATAFLOW_UPDATE_TTL};
+	return update_data;
+}
+
 //! Extracts the error message of a given Eurostat API response body
 std::string EurostatUtils::GetXmlErrorMessage(const std::string &response_body) {
 	XmlDocument document = XmlDocument(response_body);
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include "duckdb/common/shared_ptr.hpp"
 #include "eurostat.hpp"
 
 namespace duckdb {
@@ -11,10 +13,28 @@ class ExtensionLoader;
 
 struct EurostatUtils {
 public:
-	//! Returns the data structure (dimensions) of a given dataflow
+	//! Labels of the codes of each dimension, keyed by dimension name and code
+	using DimensionLabels = std::unordered_map<std::string, std::unordered_map<std::string, std::string>>;
+
+	//! Returns the data structure (dimensions) of a given dataflow, cached for a while
 	static std::vector<eurostat::Dimension> DataStructureOf(ClientContext &context, const std::string &provider_id,
 	                                                        const std::string &dataflow_id);
 
+	//! Returns the different values of the dimensions of a given dataflow, from its contentconstraint (cached per
+	//! update of the dataflow)
+	static std::unordered_map<std::string, std::vector<std::string>>
+	DimensionValuesOf(ClientContext &context, const std::string &provider_id, const std::string &dataflow_id);
+
+	//! Returns the labels of the codes of the dimensions of a given dataflow in a language (from the codelists of
+	//! its data structure), cached for a while
+	static shared_ptr<const DimensionLabels> DimensionLabelsOf(ClientContext &context, const std::string &provider_id,
+	                                                         const std::string &dataflow_id,
+	                                                         const std::string &language);
+
+	//! Returns the time of the last update of the data of a given dataflow, empty if unknown (cached for a while)
+	static std::string DataflowUpdateOf(ClientContext &context, const std::string &provider_id,
+	                                    const std::string &dataflow_id);
+
 	//! Extracts the error message of a given Eurostat API response body
 	static std::string GetXmlErrorMessage(const std::string &response_body);
 };
@@ -1,4 +1,6 @@
 #include "filter_encoder.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
@@ -9,6 +11,10 @@
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include <algorithm>
 
 // Debug logging controlled by EUROSTAT_DEBUG environment variable
 static int GetDebugLevel() {
@@ -30,31 +36,143 @@ static int GetDebugLevel() {
 namespace duckdb {
 
 //======================================================================================================================
-// EncodedExpression Functions
+// Helper Functions
 //======================================================================================================================
 
-//! Special flag for virtual/special dimensions (e.g., time_period).
-static std::string VIRTUAL_DIMENSION_FLAG = "---";
-
 //! Name for time period dimension in Eurostat data structures.
 static std::string TIME_PERIOD_DIMENSION_NAME = "time_period";
 
-EurostatFilter::EurostatFilter(const std::vector<eurostat::Dimension> &ds) : data_structure(ds) {
-	for (const auto &dim : data_structure) {
-		if (dim.position == -1 || dim.name == TIME_PERIOD_DIMENSION_NAME) {
-			dim_mask.push_back(VIRTUAL_DIMENSION_FLAG);
-		} else {
-			dim_mask.push_back("");
+//! Max length of the mask of a dimension (e.g. built from a generic predicate or merged OR branches), longer URLs are
+//! rejected by the API.
+static constexpr idx_t MAX_MASK_LENGTH = 2000;
+
+//! Max number of filters of a filter set (e.g. the combinations of nested OR expressions), before merging them.
+static constexpr idx_t MAX_FILTER_COUNT = 100000;
+
+//! Virtual/special dimensions (e.g., time_period) are not part of the dimension filters.
+static bool IsVirtualDimension(const eurostat::Dimension &dimension) {
+	return dimension.position == -1 || dimension.name == TIME_PERIOD_DIMENSION_NAME;
+}
+
+//======================================================================================================================
+// CodeSet & CodeDictionary
+//======================================================================================================================
+
+bool CodeSet::IsEmpty() const {
+	for (const auto &word : bits) {
+		if (word != 0) {
+			return false;
 		}
 	}
+	return true;
+}
+
+bool CodeSet::Contains(uint32_t id) const {
+	const auto word = id / 64;
+	return word < bits.size() && (bits[word] & (UINT64_C(1) << (id % 64))) != 0;
+}
+
+void CodeSet::Add(uint32_t id) {
+	const auto word = id / 64;
+	if (word >= bits.size()) {
+		bits.resize(word + 1, 0);
+	}
+	bits[word] |= UINT64_C(1) << (id % 64);
+}
+
+void CodeSet::Union(const CodeSet &other) {
+	if (other.bits.size() > bits.size()) {
+		bits.resize(other.bits.size(), 0);
+	}
+	for (idx_t i = 0; i < other.bits.size(); i++) {
+		bits[i] |= other.bits[i];
+	}
+}
+
+void CodeSet::Intersect(const CodeSet &other) {
+	if (bits.size() > other.bits.size()) {
+		bits.resize(other.bits.size());
+	}
+	for (idx_t i = 0; i < bits.size(); i++) {
+		bits[i] &= other.bits[i];
+	}
+}
+
+hash_t CodeSet::Hash() const {
+	hash_t result = 0;
+	for (idx_t i = 0; i < bits.size(); i++) {
+		if (bits[i] != 0) {
+			result = CombineHash(result, CombineHash(duckdb::Hash(i), duckdb::Hash(bits[i])));
+		}
+	}
+	return result;
+}
+
+bool CodeSet::operator==(const CodeSet &other) const {
+	const auto &longest = bits.size() >= other.bits.size() ? bits : other.bits;
+	const auto &shortest = bits.size() >= other.bits.size() ? other.bits : bits;
+
+	for (idx_t i = 0; i < longest.size(); i++) {
+		if (longest[i] != (i < shortest.size() ? shortest[i] : 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+CodeDictionary::CodeDictionary(idx_t dimension_count) : ids(dimension_count), codes(dimension_count) {
+}
+
+uint32_t CodeDictionary::Intern(idx_t dim_index, const std::string &code) {
+	auto &dimension_ids = ids[dim_index];
+	const auto it = dimension_ids.find(code);
+
+	if (it != dimension_ids.end()) {
+		return it->second;
+	}
+	const auto id = static_cast<uint32_t>(codes[dim_index].size());
+	dimension_ids.emplace(code, id);
+	codes[dim_index].push_back(code);
+	return id;
+}
+
+const std::string &CodeDictionary::GetCode(idx_t dim_index, uint32_t id) const {
+	return codes[dim_index][id];
+}
+
+std::string CodeDictionary::GetMask(idx_t dim_index, const CodeSet &code_set) const {
+	std::string mask;
+	mask.reserve(GetMaskLength(dim_index, code_set));
+
+	code_set.ForEach([&](uint32_t id) {
+		if (!mask.empty()) {
+			mask += "+";
+		}
+		mask += codes[dim_index][id];
+	});
+	return mask;
+}
+
+idx_t CodeDictionary::GetMaskLength(idx_t dim_index, const CodeSet &code_set) const {
+	idx_t length = 0;
+	code_set.ForEach([&](uint32_t id) { length += codes[dim_index][id].size() + 1; });
+	return length > 0 ? length - 1 : 0;
+}
+
+//======================================================================================================================
+// EncodedExpression Functions
+//======================================================================================================================
+
+EurostatFilter::EurostatFilter(const std::vector<eurostat::Dimension> &ds, const CodeDictionary &dictionary)
+    : data_structure(ds), dictionary(dictionary), dim_codes(ds.size()) {
 }
 
 bool EurostatFilter::IsEmpty() const {
 	if (!start_period.empty() || !end_period.empty()) {
 		return false;
 	}
-	for (const auto &m : dim_mask) {
-		if (!m.empty() && m != VIRTUAL_DIMENSION_FLAG) {
+	for (const auto &codes : dim_codes) {
+		if (!codes.IsEmpty()) {
 			return false;
 		}
 	}
@@ -66,18 +184,14 @@ std::string EurostatFilter::GetFilterString() const {
 
 	// Dimension filters part (e.g., "A.B+X.C.D+Y").
 
-	for (size_t i = 0; i < dim_mask.size(); i++) {
-		const auto &m = dim_mask[i];
-
-		if (m == VIRTUAL_DIMENSION_FLAG) {
+	for (size_t i = 0; i < dim_codes.size(); i++) {
+		if (IsVirtualDimension(data_structure[i])) {
 			continue;
 		}
 		if (filter_clause.empty()) {
 			filter_clause += "/";
 		}
-		if (!m.empty()) {
-			filter_clause += m;
-		}
+		filter_clause += dictionary.GetMask(i, dim_codes[i]);
 		filter_clause += ".";
 	}
 	if (!filter_clause.empty()) {
@@ -101,8 +215,303 @@ std::string EurostatFilter::GetFilterString() const {
 }
 
 void EurostatFilterSet::PushEmptyFilter() {
-	EurostatFilter new_filter(data_structure);
-	filters.emplace_back(std::move(new_filter));
+	filters.emplace_back(data_structure, *dictionary);
+}
+
+void EurostatFilterSet::RestrictCodes(idx_t dim_index, const CodeSet &codes) {
+	for (auto &filter : filters) {
+		auto &dim_codes = filter.dim_codes[dim_index];
+
+		if (dim_codes.IsEmpty()) {
+			dim_codes = codes;
+			continue;
+		}
+		dim_codes.Intersect(codes);
+
+		if (dim_codes.IsEmpty()) {
+			filter.never_matches = true;
+		}
+	}
+}
+
+void EurostatFilterSet::SetPeriods(const std::string &start_period, const std::string &end_period) {
+	for (auto &filter : filters) {
+		if (!start_period.empty()) {
+			filter.start_period = start_period;
+		}
+		if (!end_period.empty()) {
+			filter.end_period = end_period;
+		}
+	}
+}
+
+bool EurostatFilterSet::EncodeDisjunction(idx_t child_count, const std::function<bool(idx_t)> &encode_child) {
+	// Each child is encoded over a copy of the current filters, the result is the union of the filters of all of
+	// them (e.g. "A AND (B OR C)" is encoded as "(A AND B) OR (A AND C)").
+
+	std::vector<EurostatFilter> base_filters;
+	std::vector<EurostatFilter> result_filters;
+	std::swap(base_filters, filters);
+
+	for (idx_t child_idx = 0; child_idx < child_count; child_idx++) {
+		filters.clear();
+		for (const auto &filter : base_filters) {
+			filters.push_back(filter);
+		}
+		if (!encode_child(child_idx)) {
+			return false;
+		}
+		for (auto &filter : filters) {
+			if (!filter.never_matches) {
+				result_filters.push_back(std::move(filter));
+			}
+		}
+		if (result_filters.size() > MAX_FILTER_COUNT) {
+			supported = false;
+			return false;
+		}
+	}
+	filters.clear();
+	std::swap(filters, result_filters);
+
+	// No child can match any row.
+	if (filters.empty()) {
+		PushEmptyFilter();
+		filters.back().never_matches = true;
+	}
+	return true;
+}
+
+//======================================================================================================================
+// Constraint Pruning
+//======================================================================================================================
+
+//! Returns the year of a time period (e.g. 2020 for "2020", "2020-Q1", "2020-12" or "2020-W05"), -1 if unknown.
+//! Periods of different frequencies do not sort as strings ("2020-Q1" > "2020-12"), so they are compared by year.
+static int64_t GetPeriodYear(const std::string &period) {
+	if (period.size() < 4 || (period.size() > 4 && period[4] != '-')) {
+		return -1;
+	}
+	int64_t year = 0;
+
+	for (idx_t i = 0; i < 4; i++) {
+		if (!StringUtil::CharacterIsDigit(period[i])) {
+			return -1;
+		}
+		year = year * 10 + (period[i] - '0');
+	}
+	return year;
+}
+
+//! Returns the value of a period clause (e.g. "2020" for "startPeriod=2020").
+static std::string GetPeriodValue(const std::string &period_clause) {
+	const auto pos = period_clause.find('=');
+	return pos == std::string::npos ? std::string() : period_clause.substr(pos + 1);
+}
+
+bool FilterEncoder::PruneFilter(EurostatFilter &filter, const std::vector<CodeSet> &allowed_codes,
+                                const DimensionValues &allowed_values) {
+	const auto &data_structure = filter.data_structure;
+
+	// Keep the codes allowed by the contentconstraint in each dimension mask (e.g. "AL+XX" -> "AL").
+
+	for (size_t i = 0; i < filter.dim_codes.size(); i++) {
+		auto &codes = filter.dim_codes[i];
+
+		if (codes.IsEmpty() || IsVirtualDimension(data_structure[i]) || allowed_codes[i].IsEmpty()) {
+			continue;
+		}
+		if (GetDebugLevel() >= 1) {
+			codes.ForEach([&](uint32_t id) {
+				if (!allowed_codes[i].Contains(id)) {
+					EUROSTAT_SCAN_DEBUG_LOG(1, "Pruned code '%s' of dimension '%s', not in the contentconstraint",
+					                        filter.dictionary.GetCode(i, id).c_str(), data_structure[i].name.c_str());
+				}
+			});
+		}
+		codes.Intersect(allowed_codes[i]);
+
+		if (codes.IsEmpty()) {
+			return false;
+		}
+	}
+
+	// Check the period range against the available time periods.
+
+	const auto it = allowed_values.find(TIME_PERIOD_DIMENSION_NAME);
+
+	if (it != allowed_values.end() && !it->second.empty()) {
+		int64_t min_year = NumericLimits<int64_t>::Maximum();
+		int64_t max_year = NumericLimits<int64_t>::Minimum();
+
+		for (const auto &period : it->second) {
+			const auto year = GetPeriodYear(period);
+
+			// Unknown format, the period range can not be checked.
+			if (year < 0) {
+				return true;
+			}
+			min_year = MinValue(min_year, year);
+			max_year = MaxValue(max_year, year);
+		}
+		const auto start_year = GetPeriodYear(GetPeriodValue(filter.start_period));
+		const auto end_year = GetPeriodYear(GetPeriodValue(filter.end_period));
+
+		if (start_year >= 0 && start_year > max_year) {
+			return false;
+		}
+		if (end_year >= 0 && end_year < min_year) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void FilterEncoder::BuildFilters(EurostatFilterSet &filter_set, const DimensionValues *allowed_values,
+                                 FilterEncoderResult &result) {
+	idx_t filter_count = 0;
+
+	// Codes allowed by the contentconstraint, interned once for all the filters.
+
+	std::vector<CodeSet> allowed_codes(filter_set.data_structure.size());
+
+	if (allowed_values) {
+		for (size_t i = 0; i < filter_set.data_structure.size(); i++) {
+			const auto it = allowed_values->find(filter_set.data_structure[i].name);
+
+			if (IsVirtualDimension(filter_set.data_structure[i]) || it == allowed_values->end()) {
+				continue;
+			}
+			for (const auto &code : it->second) {
+				allowed_codes[i].Add(filter_set.dictionary->Intern(i, code));
+			}
+		}
+	}
+
+	std::vector<EurostatFilter *> filters;
+
+	for (auto &out_filter : filter_set.filters) {
+		if (out_filter.never_matches) {
+			filter_count++;
+			continue;
+		}
+		// A filter without restriction matches all the rows, nothing to push down.
+		if (out_filter.IsEmpty()) {
+			result.supported = false;
+			return;
+		}
+		filter_count++;
+
+		// Skip the filters (e.g. OR branches) that can not match any row.
+		if (allowed_values && !PruneFilter(out_filter, allowed_codes, *allowed_values)) {
+			EUROSTAT_SCAN_DEBUG_LOG(1, "Pruned filter '%s', it can not match any row",
+			                        out_filter.GetFilterString().c_str());
+			continue;
+		}
+		filters.push_back(&out_filter);
+	}
+
+	// Send fewer requests, merging the filters differing in one dimension.
+
+	MergeFilters(filters);
+
+	for (const auto &out_filter : filters) {
+		result.filters.emplace_back(out_filter->GetFilterString());
+	}
+
+	// Nothing can match, no request is needed at all.
+	result.empty = filter_count > 0 && result.filters.empty();
+	result.supported = result.filters.size() > 0 || result.empty;
+}
+
+//! Hash of a filter ignoring the codes of one of its dimensions.
+static hash_t HashFilter(const EurostatFilter &filter, idx_t skip_dim_index) {
+	hash_t result = CombineHash(Hash(filter.start_period.c_str()), Hash(filter.end_period.c_str()));
+
+	for (idx_t i = 0; i < filter.dim_codes.size(); i++) {
+		if (i != skip_dim_index) {
+			result = CombineHash(result, CombineHash(Hash(i), filter.dim_codes[i].Hash()));
+		}
+	}
+	return result;
+}
+
+//! Check if two filters are equal ignoring the codes of one of their dimensions.
+static bool EqualFilters(const EurostatFilter &a, const EurostatFilter &b, idx_t skip_dim_index) {
+	if (a.start_period != b.start_period || a.end_period != b.end_period) {
+		return false;
+	}
+	for (idx_t i = 0; i < a.dim_codes.size(); i++) {
+		if (i != skip_dim_index && !(a.dim_codes[i] == b.dim_codes[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void FilterEncoder::MergeFilters(std::vector<EurostatFilter *> &filters) {
+	if (filters.size() < 2) {
+		return;
+	}
+	const auto &data_structure = filters[0]->data_structure;
+	const auto &dictionary = filters[0]->dictionary;
+
+	for (idx_t dim_index = 0; dim_index < data_structure.size(); dim_index++) {
+		if (IsVirtualDimension(data_structure[dim_index])) {
+			continue;
+		}
+
+		// Group the filters equal in the other dimensions, merging the codes of this one into the first filter of
+		// the group, until its mask is too long.
+
+		std::unordered_map<hash_t, std::vector<idx_t>> groups;
+		std::vector<EurostatFilter *> merged_filters;
+		std::vector<idx_t> mask_lengths;
+
+		for (auto filter : filters) {
+			auto &group = groups[HashFilter(*filter, dim_index)];
+			bool merged = false;
+
+			for (const auto &merged_index : group) {
+				auto &target = *merged_filters[merged_index];
+
+				if (!EqualFilters(target, *filter, dim_index)) {
+					continue;
+				}
+
+				// An empty set does not filter the dimension, the union does not either.
+				auto &target_codes = target.dim_codes[dim_index];
+				const auto &codes = filter->dim_codes[dim_index];
+
+				if (target_codes.IsEmpty() || codes.IsEmpty()) {
+					target_codes.bits.clear();
+					mask_lengths[merged_index] = 0;
+					merged = true;
+					break;
+				}
+				const auto length = dictionary.GetMaskLength(dim_index, codes);
+
+				if (mask_lengths[merged_index] + 1 + length > MAX_MASK_LENGTH) {
+					continue;
+				}
+				target_codes.Union(codes);
+				mask_lengths[merged_index] = dictionary.GetMaskLength(dim_index, target_codes);
+				merged = true;
+				break;
+			}
+			if (!merged) {
+				group.push_back(merged_filters.size());
+				merged_filters.push_back(filter);
+				mask_lengths.push_back(dictionary.GetMaskLength(dim_index, filter->dim_codes[dim_index]));
+			}
+		}
+
+		if (merged_filters.size() < filters.size()) {
+			EUROSTAT_SCAN_DEBUG_LOG(1, "Merged %zu filters into %zu over dimension '%s'", filters.size(),
+			                        merged_filters.size(), data_structure[dim_index].name.c_str());
+		}
+		filters = std::move(merged_filters);
+	}
 }
 
 //======================================================================================================================
@@ -155,20 +564,18 @@ bool FilterEncoder::EncodeConstantComparison(const ConstantFilter &filter, const
 		return false;
 	}
 
-	auto &out_filter = out_result.GetCurrentFilter();
-
 	if (dimension.name == TIME_PERIOD_DIMENSION_NAME) {
 		if (filter.comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
-			out_filter.start_period = "startPeriod=" + filter.constant.ToString();
+			out_result.SetPeriods("startPeriod=" + filter.constant.ToString(), "");
 			return true;
 		}
 		if (filter.comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO) {
-			out_filter.end_period = "endPeriod=" + filter.constant.ToString();
+			out_result.SetPeriods("", "endPeriod=" + filter.constant.ToString());
 			return true;
 		}
 		if (filter.comparison_type == ExpressionType::COMPARE_EQUAL) {
-			out_filter.start_period = "startPeriod=" + filter.constant.ToString();
-			out_filter.end_period = "endPeriod=" + filter.constant.ToString();
+			out_result.SetPeriods("startPeriod=" + filter.constant.ToString(),
+			                      "endPeriod=" + filter.constant.ToString());
 			return true;
 		}
 		out_result.supported = false;
@@ -176,15 +583,15 @@ bool FilterEncoder::EncodeConstantComparison(const ConstantFilter &filter, const
 	}
 
 	std::string op;
-	if (!GetComparisonOperator(filter.comparison_type, op)) {
+	if (!GetComparisonOperator(filter.comparison_type, op) || IsVirtualDimension(dimension)) {
 		out_result.supported = false;
 		return false;
 	}
 
-	// Append the constant value to the current dimension mask.
-	std::string mask_v = out_filter.dim_mask[dim_index];
-	mask_v = mask_v.empty() ? filter.constant.ToString() : mask_v + "+" + filter.constant.ToString();
-	out_filter.dim_mask[dim_index] = mask_v;
+	// Restrict the dimension to the constant value.
+	CodeSet codes;
+	codes.Add(out_result.dictionary->Intern(dim_index, filter.constant.ToString()));
+	out_result.RestrictCodes(dim_index, codes);
 
 	return true;
 }
@@ -196,14 +603,30 @@ bool FilterEncoder::EncodeInFilter(const InFilter &filter, const eurostat::Dimen
 		out_result.supported = false;
 		return false;
 	}
-	for (idx_t i = 0; i < filter.values.size(); i++) {
-		ConstantFilter const_f(ExpressionType::COMPARE_EQUAL, filter.values[i]);
+	if (dimension.name == TIME_PERIOD_DIMENSION_NAME || filter.values.size() == 1) {
+		ConstantFilter const_f(ExpressionType::COMPARE_EQUAL, filter.values[0]);
+		return FilterEncoder::EncodeConstantComparison(const_f, dimension, dim_index, out_result);
+	}
+	if (IsVirtualDimension(dimension)) {
+		out_result.supported = false;
+		return false;
+	}
 
-		if (!FilterEncoder::EncodeConstantComparison(const_f, dimension, dim_index, out_result)) {
-			out_result.supported = false;
-			return false;
+	// Restrict the dimension to any of the values.
+	CodeSet codes;
+
+	for (const auto &value : filter.values) {
+		if (value.IsNull()) {
+			continue;
 		}
+		codes.Add(out_result.dictionary->Intern(dim_index, value.ToString()));
+	}
+	if (codes.IsEmpty()) {
+		out_result.supported = false;
+		return false;
 	}
+	out_result.RestrictCodes(dim_index, codes);
+
 	return true;
 }
 
@@ -232,19 +655,20 @@ bool FilterEncoder::EncodeConjunctionOr(const ConjunctionOrFilter &filter, const
 		return false;
 	}
 
-	for (const auto &child : filter.child_filters) {
-		if (!FilterEncoder::EncodeFilter(*child, dimension, dim_index, out_result)) {
-			out_result.supported = false;
-			return false;
-		}
-		out_result.PushEmptyFilter();
+	const auto encode_child = [&](idx_t child_idx) {
+		return FilterEncoder::EncodeFilter(*filter.child_filters[child_idx], dimension, dim_index, out_result);
+	};
+	if (!out_result.EncodeDisjunction(filter.child_filters.size(), encode_child)) {
+		out_result.supported = false;
+		return false;
 	}
 	return true;
 }
 
 FilterEncoderResult FilterEncoder::Encode(const TableFilterSet *filters,
                                           const std::vector<eurostat::Dimension> &data_structure,
-                                          const std::vector<column_t> &column_ids) {
+                                          const std::vector<column_t> &column_ids,
+                                          const DimensionValues *allowed_values) {
 	FilterEncoderResult result;
 	result.supported = true;
 
@@ -307,13 +731,7 @@ FilterEncoderResult FilterEncoder::Encode(const TableFilterSet *filters,
 	// Everything was encoded? build the final API Eurostat filter clauses.
 
 	if (result.supported) {
-		for (const auto &out_filter : filter_set.filters) {
-			if (!out_filter.IsEmpty()) {
-				std::string filter_clause = out_filter.GetFilterString();
-				result.filters.emplace_back(filter_clause);
-			}
-		}
-		result.supported = result.filters.size() > 0;
+		BuildFilters(filter_set, allowed_values, result);
 	}
 	return result;
 }
@@ -324,7 +742,8 @@ FilterEncoderResult FilterEncoder::Encode(const TableFilterSet *filters,
 
 FilterEncoderResult FilterEncoder::EncodeExpression(vector<unique_ptr<Expression>> &expressions,
                                                     const std::vector<eurostat::Dimension> &data_structure,
-                                                    const std::vector<column_t> &column_ids) {
+                                                    const std::vector<column_t> &column_ids,
+                                                    const DimensionValues *allowed_values, ClientContext *context) {
 	FilterEncoderResult result;
 	result.supported = true;
 
@@ -337,30 +756,47 @@ FilterEncoderResult FilterEncoder::EncodeExpression(vector<unique_ptr<Expression
 	// Encode each expression.
 
 	EurostatFilterSet filter_set(data_structure);
+	filter_set.supported = true;
+	filter_set.context = context;
+	filter_set.allowed_values = allowed_values;
+
+	vector<unique_ptr<Expression>> encoded_expressions;
+	vector<unique_ptr<Expression>> residual_expressions;
+
+	for (auto &expr : expressions) {
+		// Check the expression alone first, the ones not supported are left to DuckDB.
+		EurostatFilterSet probe_set(data_structure);
+		probe_set.context = context;
+		probe_set.allowed_values = allowed_values;
 
-	for (const auto &expr : expressions) {
+		if (!EncodeExpressionNode(*expr, data_structure, column_ids, probe_set)) {
+			residual_expressions.push_back(std::move(expr));
+			continue;
+		}
+		// Not supported combined with the previous ones, the filter set is partially updated, nothing is encoded.
 		if (!EncodeExpressionNode(*expr, data_structure, column_ids, filter_set)) {
-			result.supported = false;
-			return result;
+			residual_expressions.push_back(std::move(expr));
+			filter_set.supported = false;
+			continue;
 		}
+		encoded_expressions.push_back(std::move(expr));
 	}
 
-	// Everything was encoded? build the final API Eurostat filter clauses.
+	// Build the final API Eurostat filter clauses of the encoded expressions.
 
-	if (result.supported) {
-		for (const auto &out_filter : filter_set.filters) {
-			if (!out_filter.IsEmpty()) {
-				std::string filter_clause = out_filter.GetFilterString();
-				result.filters.emplace_back(filter_clause);
-			}
-		}
-		result.supported = result.filters.size() > 0;
+	if (!encoded_expressions.empty() && filter_set.supported) {
+		BuildFilters(filter_set, allowed_values, result);
+	} else {
+		result.supported = false;
+	}
 
-		// Remove the expressions we handled.
-		if (result.supported) {
-			expressions.clear();
+	// Remove the expressions we handled.
+	if (!result.supported) {
+		for (auto &expr : encoded_expressions) {
+			residual_expressions.push_back(std::move(expr));
 		}
 	}
+	expressions = std::move(residual_expressions);
 
 	return result;
 }
@@ -398,7 +834,8 @@ bool FilterEncoder::EncodeExpressionNode(const Expression &expr, const std::vect
 		if (op.left->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF &&
 		    op.right->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
 			int dim_idx = GetDimensionIndexFromColumnRef(*op.left, data_structure, column_ids);
-			if (dim_idx != -1) {
+			if (dim_idx != -1 && (op.type == ExpressionType::COMPARE_EQUAL ||
+			                      data_structure[dim_idx].name == TIME_PERIOD_DIMENSION_NAME)) {
 				const auto &dimension = data_structure[dim_idx];
 
 				const auto &const_expr = op.right->Cast<BoundConstantExpression>();
@@ -408,8 +845,8 @@ bool FilterEncoder::EncodeExpressionNode(const Expression &expr, const std::vect
 			}
 		}
 
-		out_result.supported = false;
-		return false;
+		// Other comparisons (e.g. "geo <> 'EU27_2020'").
+		return EncodePredicate(expr, data_structure, column_ids, out_result);
 	}
 	case ExpressionClass::BOUND_OPERATOR: {
 		const auto &op = expr.Cast<BoundOperatorExpression>();
@@ -417,8 +854,8 @@ bool FilterEncoder::EncodeExpressionNode(const Expression &expr, const std::vect
 		// Handle column IN (values) comparisons.
 
 		if (expr.GetExpressionType() != ExpressionType::COMPARE_IN) {
-			out_result.supported = false;
-			return false;
+			// Other operators (e.g. "sex NOT IN ('F', 'M')").
+			return EncodePredicate(expr, data_structure, column_ids, out_result);
 		}
 		if (op.children.size() < 2) {
 			throw InvalidInputException("Operator needs at least two children");
@@ -468,13 +905,13 @@ bool FilterEncoder::EncodeExpressionNode(const Expression &expr, const std::vect
 			return true;
 		}
 		if (conjunction.type == ExpressionType::CONJUNCTION_OR) {
-			// For OR, create separate dimension filter for each child.
-			for (const auto &child : conjunction.children) {
-				if (!EncodeExpressionNode(*child, data_structure, column_ids, out_result)) {
-					out_result.supported = false;
-					return false;
-				}
-				out_result.PushEmptyFilter();
+			// For OR, create separate dimension filters for each child.
+			const auto encode_child = [&](idx_t child_idx) {
+				return EncodeExpressionNode(*conjunction.children[child_idx], data_structure, column_ids, out_result);
+			};
+			if (!out_result.EncodeDisjunction(conjunction.children.size(), encode_child)) {
+				out_result.supported = false;
+				return false;
 			}
 			return true;
 		}
@@ -503,22 +940,149 @@ bool FilterEncoder::EncodeExpressionNode(const Expression &expr, const std::vect
 				const auto &lower_const = op.lower->Cast<BoundConstantExpression>();
 				const auto &upper_const = op.upper->Cast<BoundConstantExpression>();
 
-				auto &out_filter = out_result.GetCurrentFilter();
-				out_filter.start_period = "startPeriod=" + lower_const.value.ToString();
-				out_filter.end_period = "endPeriod=" + upper_const.value.ToString();
+				out_result.SetPeriods("startPeriod=" + lower_const.value.ToString(),
+				                      "endPeriod=" + upper_const.value.ToString());
 				return true;
 			}
 		}
 
+		return EncodePredicate(expr, data_structure, column_ids, out_result);
+	}
+	default:
+		// Other expressions (e.g. "geo LIKE 'DE%'", "regexp_matches(nace_r2, '^C')").
+		return EncodePredicate(expr, data_structure, column_ids, out_result);
+	}
+}
+
+//======================================================================================================================
+// Generic Predicate Encoding
+//======================================================================================================================
+
+//! Collect the column references of an expression, returns false if it can not be evaluated alone (e.g. subqueries
+//! or parameters).
+static bool CollectColumnRefs(const Expression &expr, vector<const BoundColumnRefExpression *> &column_refs) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COLUMN_REF:
+		column_refs.push_back(&expr.Cast<BoundColumnRefExpression>());
+		return true;
+	case ExpressionClass::BOUND_SUBQUERY:
+	case ExpressionClass::BOUND_PARAMETER:
+	case ExpressionClass::BOUND_REF:
+	case ExpressionClass::BOUND_AGGREGATE:
+	case ExpressionClass::BOUND_WINDOW:
+		return false;
+	default:
+		break;
+	}
+	bool result = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		result = result && CollectColumnRefs(child, column_refs);
+	});
+	return result;
+}
+
+//! Replace the column references of an expression by references to the first column of a chunk.
+static void ReplaceColumnRefs(unique_ptr<Expression> &expr) {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		expr = make_uniq<BoundReferenceExpression>(expr->return_type, 0);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) { ReplaceColumnRefs(child); });
+}
+
+bool FilterEncoder::EncodePredicate(const Expression &expr, const std::vector<eurostat::Dimension> &data_structure,
+                                    const std::vector<column_t> &column_ids, EurostatFilterSet &out_result) {
+	if (!out_result.context || !out_result.allowed_values || expr.IsVolatile()) {
 		out_result.supported = false;
 		return false;
 	}
-	default:
-		EUROSTAT_SCAN_DEBUG_LOG(1, "EncodeExpressionNode: Class %d not supported", (int)expr.GetExpressionClass());
 
+	// The predicate must reference a single dimension with known values.
+
+	vector<const BoundColumnRefExpression *> column_refs;
+
+	if (!CollectColumnRefs(expr, column_refs) || column_refs.empty()) {
 		out_result.supported = false;
 		return false;
 	}
+	const auto dim_idx = GetDimensionIndexFromColumnRef(*column_refs[0], data_structure, column_ids);
+
+	for (const auto &column_ref : column_refs) {
+		if (dim_idx == -1 || column_ref->binding != column_refs[0]->binding) {
+			out_result.supported = false;
+			return false;
+		}
+	}
+	const auto &dimension = data_structure[dim_idx];
+	const auto values_it = out_result.allowed_values->find(dimension.name);
+
+	if (dimension.position == -1 || dimension.name == TIME_PERIOD_DIMENSION_NAME ||
+	    values_it == out_result.allowed_values->end() || values_it->second.empty()) {
+		out_result.supported = false;
+		return false;
+	}
+	const auto &codes = values_it->second;
+	const auto &column_type = column_refs[0]->return_type;
+
+	// Evaluate the predicate against the allowed values of the dimension.
+
+	std::vector<std::string> matches;
+
+	try {
+		auto predicate = expr.Copy();
+		ReplaceColumnRefs(predicate);
+
+		ExpressionExecutor executor(*out_result.context, *predicate);
+		SelectionVector selection(STANDARD_VECTOR_SIZE);
+		DataChunk chunk;
+		chunk.Initialize(Allocator::DefaultAllocator(), {column_type});
+
+		for (idx_t offset = 0; offset < codes.size(); offset += STANDARD_VECTOR_SIZE) {
+			const auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, codes.size() - offset);
+			chunk.Reset();
+
+			for (idx_t i = 0; i < count; i++) {
+				chunk.SetValue(0, i, Value(codes[offset + i]).DefaultCastAs(column_type));
+			}
+			chunk.SetCardinality(count);
+
+			const auto match_count = executor.SelectExpression(chunk, selection);
+			for (idx_t i = 0; i < match_count; i++) {
+				matches.push_back(codes[offset + selection.get_index(i)]);
+			}
+		}
+	} catch (std::exception &ex) {
+		EUROSTAT_SCAN_DEBUG_LOG(1, "EncodePredicate: Failed to evaluate '%s': %s", expr.ToString().c_str(), ex.what());
+
+		out_result.supported = false;
+		return false;
+	}
+
+	EUROSTAT_SCAN_DEBUG_LOG(1, "EncodePredicate: '%s' matches %zu of %zu codes", expr.ToString().c_str(),
+	                        matches.size(), codes.size());
+
+	// Use the matching codes as IN mask, intersected with the mask already set for the dimension (AND).
+
+	if (matches.size() == codes.size()) {
+		// Always true, nothing to filter.
+		return true;
+	}
+	CodeSet match_codes;
+	for (const auto &code : matches) {
+		match_codes.Add(out_result.dictionary->Intern(dim_idx, code));
+	}
+	if (!matches.empty() && out_result.dictionary->GetMaskLength(dim_idx, match_codes) > MAX_MASK_LENGTH) {
+		out_result.supported = false;
+		return false;
+	}
+	if (matches.empty()) {
+		for (auto &filter : out_result.filters) {
+			filter.never_matches = true;
+		}
+		return true;
+	}
+	out_result.RestrictCodes(dim_idx, match_codes);
+	return true;
 }
 
 } // namespace duckdb
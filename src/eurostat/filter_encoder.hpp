@@ -4,25 +4,83 @@
 #include "duckdb.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/common/bit_utils.hpp"
+#include <functional>
 
 namespace duckdb {
 
+//! Values allowed for each dimension of a dataflow (from its contentconstraint), keyed by dimension name.
+using DimensionValues = std::unordered_map<std::string, std::vector<std::string>>;
+
+/**
+ * Set of codes of a dimension, as a bitset over the ids of the codes interned in a CodeDictionary.
+ * An empty set does not filter the dimension.
+ */
+struct CodeSet {
+	//! Bits of the code ids, trailing words may be missing (all zero).
+	std::vector<uint64_t> bits;
+
+	bool IsEmpty() const;
+	bool Contains(uint32_t id) const;
+	void Add(uint32_t id);
+	//! Union and intersection with another set of the same dimension.
+	void Union(const CodeSet &other);
+	void Intersect(const CodeSet &other);
+	hash_t Hash() const;
+	bool operator==(const CodeSet &other) const;
+
+	//! Call a function for each code id of the set, in increasing order.
+	template <class FUNC>
+	void ForEach(FUNC &&func) const {
+		for (idx_t word = 0; word < bits.size(); word++) {
+			for (uint64_t value = bits[word]; value != 0; value &= value - 1) {
+				func(static_cast<uint32_t>(word * 64 + CountZeros<uint64_t>::Trailing(value)));
+			}
+		}
+	}
+};
+
+/**
+ * Codes of the dimensions interned as dense ids (per dimension), shared by the filters of a filter set.
+ */
+class CodeDictionary {
+public:
+	explicit CodeDictionary(idx_t dimension_count);
+
+	//! Get the id of a code of a dimension, adding it if needed.
+	uint32_t Intern(idx_t dim_index, const std::string &code);
+	//! Get the code of an id of a dimension.
+	const std::string &GetCode(idx_t dim_index, uint32_t id) const;
+
+	//! Get the mask of a set of codes (e.g., "DE+FR"), and its length without building it.
+	std::string GetMask(idx_t dim_index, const CodeSet &codes) const;
+	idx_t GetMaskLength(idx_t dim_index, const CodeSet &codes) const;
+
+private:
+	std::vector<std::unordered_map<std::string, uint32_t>> ids;
+	std::vector<std::vector<std::string>> codes;
+};
+
 /**
  * Result of encoding a single T-SQL expression or filter to an Eurostat filter.
  */
 struct EurostatFilter {
 	//! Reference to a data structure of dimensions.
 	const std::vector<eurostat::Dimension> &data_structure;
+	//! Dictionary of the codes of the dimension filters.
+	const CodeDictionary &dictionary;
 
-	//! Dimension filter mask (e.g., "A.B+X.C.D+Y").
-	std::vector<std::string> dim_mask;
+	//! Dimension filter codes, rendered as a mask (e.g., "A.B+X.C.D+Y").
+	std::vector<CodeSet> dim_codes;
 	//! Start period filter.
 	std::string start_period;
 	//! End period filter.
 	std::string end_period;
+	//! True if no row can match the filter (e.g. a predicate without matching code).
+	bool never_matches = false;
 
 	//! Constructor.
-	EurostatFilter(const std::vector<eurostat::Dimension> &ds);
+	EurostatFilter(const std::vector<eurostat::Dimension> &ds, const CodeDictionary &dictionary);
 
 	//! Check if the expression is empty.
 	bool IsEmpty() const;
@@ -37,24 +95,33 @@ struct EurostatFilter {
 struct EurostatFilterSet {
 	//! Reference to a data structure of dimensions.
 	const std::vector<eurostat::Dimension> &data_structure;
+	//! Dictionary of the codes of the filters.
+	unique_ptr<CodeDictionary> dictionary;
 
-	//! Set of encoded Eurostat filters.
+	//! Set of encoded Eurostat filters, any of them can match a row (OR).
 	std::vector<EurostatFilter> filters;
 	//! True if filter was encoded.
 	bool supported = false;
 
+	//! Optional, context and allowed values of the dimensions to evaluate generic predicates (see EncodePredicate).
+	ClientContext *context = nullptr;
+	const DimensionValues *allowed_values = nullptr;
+
 	//! Constructor.
-	EurostatFilterSet(const std::vector<eurostat::Dimension> &ds) : data_structure(ds) {
+	EurostatFilterSet(const std::vector<eurostat::Dimension> &ds)
+	    : data_structure(ds), dictionary(make_uniq<CodeDictionary>(ds.size())) {
 		PushEmptyFilter();
 	}
 
 	//! Add a new empty Eurostat filter.
 	void PushEmptyFilter();
 
-	//! Get the current Eurostat filter, the last one in the stack.
-	EurostatFilter &GetCurrentFilter() {
-		return filters.back();
-	}
+	//! Restrict a dimension of all the filters to a set of codes (AND).
+	void RestrictCodes(idx_t dim_index, const CodeSet &codes);
+	//! Set the start and/or end period of all the filters (AND), empty values are ignored.
+	void SetPeriods(const std::string &start_period, const std::string &end_period);
+	//! Encode an OR of children into the filters, 'encode_child' encodes a child into all the filters of the set.
+	bool EncodeDisjunction(idx_t child_count, const std::function<bool(idx_t)> &encode_child);
 };
 
 /**
@@ -65,6 +132,8 @@ struct FilterEncoderResult {
 	std::vector<std::string> filters;
 	//! True if entire filter was fully encoded
 	bool supported = false;
+	//! True if no row can match the filter (e.g. codes not allowed by the contentconstraint).
+	bool empty = false;
 };
 
 /**
@@ -78,20 +147,48 @@ class FilterEncoder {
 public:
 	/**
 	 * Encode a TableFilterSet to Eurostat filter clauses.
+	 * If the allowed values of the dimensions are given, the clauses are pruned with them (see PruneFilter).
 	 */
 	static FilterEncoderResult Encode(const TableFilterSet *filters,
 	                                  const std::vector<eurostat::Dimension> &data_structure,
-	                                  const std::vector<column_t> &column_ids);
+	                                  const std::vector<column_t> &column_ids,
+	                                  const DimensionValues *allowed_values = nullptr);
 
 	/**
 	 * Encode a complex T-SQL Expression to a set of Eurostat API filter clauses.
 	 * Handles BoundComparisonExpression, BoundConjunctionExpression, etc.
+	 * The encoded expressions are removed, the ones not supported are kept to be evaluated by DuckDB.
+	 * If the allowed values of the dimensions are given, the clauses are pruned with them (see PruneFilter), and
+	 * other predicates over a single dimension are evaluated against them when a context is given (see
+	 * EncodePredicate).
 	 */
 	static FilterEncoderResult EncodeExpression(vector<unique_ptr<Expression>> &expressions,
 	                                            const std::vector<eurostat::Dimension> &data_structure,
-	                                            const std::vector<column_t> &column_ids);
+	                                            const std::vector<column_t> &column_ids,
+	                                            const DimensionValues *allowed_values = nullptr,
+	                                            ClientContext *context = nullptr);
 
 private:
+	/**
+	 * Build the final Eurostat filter clauses of a filter set.
+	 */
+	static void BuildFilters(EurostatFilterSet &filter_set, const DimensionValues *allowed_values,
+	                         FilterEncoderResult &result);
+
+	/**
+	 * Remove the codes not allowed by the contentconstraint from the dimension masks of a filter.
+	 * Returns false if the filter can not match any row (no allowed code left, or period out of range).
+	 */
+	static bool PruneFilter(EurostatFilter &filter, const std::vector<CodeSet> &allowed_codes,
+	                        const DimensionValues &allowed_values);
+
+	/**
+	 * Merge the filters which only differ in the codes of one dimension (e.g. OR branches "geo=DE AND sex=F" and
+	 * "geo=FR AND sex=F" become "geo IN (DE, FR) AND sex=F"), so fewer requests are sent. Linear in the number of
+	 * filters for each dimension, merged masks are kept shorter than the URL limits.
+	 */
+	static void MergeFilters(std::vector<EurostatFilter *> &filters);
+
 	/**
 	 * Get comparison operator given a DuckDB ExpressionType.
 	 */
@@ -144,6 +241,13 @@ private:
 	                                          const std::vector<eurostat::Dimension> &data_structure,
 	                                          const std::vector<column_t> &column_ids);
 
+	/**
+	 * Encode a deterministic predicate referencing a single dimension (e.g. "geo LIKE 'DE%'", "sex <> 'T'"),
+	 * evaluating it against the allowed values of the dimension: the matching codes become an IN mask.
+	 */
+	static bool EncodePredicate(const Expression &expr, const std::vector<eurostat::Dimension> &data_structure,
+	                            const std::vector<column_t> &column_ids, EurostatFilterSet &out_result);
+
 	/**
 	 * Encode a complex Expression node.
 	 */
@@ -1,13 +1,16 @@
 #include "http_request.hpp"
+#include "circuit_breaker.hpp"
+#include "curl_http_client.hpp"
+#include "eurostat.hpp"
+#include "negative_cache.hpp"
 
 #include "duckdb/common/file_opener.hpp"
-#include "duckdb/common/gzip_file_system.hpp"
 #include "duckdb/common/http_util.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_context_file_opener.hpp"
 #include "duckdb/main/settings.hpp"
-#include "zstd.h"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -18,43 +21,9 @@ namespace duckdb {
 // Default max concurrent HTTP requests per scalar function call
 static constexpr idx_t DEFAULT_HTTP_MAX_CONCURRENT = 32;
 
-// Zstd magic number: 0xFD2FB528 (little-endian: 28 B5 2F FD)
-static constexpr uint8_t ZSTD_MAGIC_1 = 0x28;
-static constexpr uint8_t ZSTD_MAGIC_2 = 0xB5;
-static constexpr uint8_t ZSTD_MAGIC_3 = 0x2F;
-static constexpr uint8_t ZSTD_MAGIC_4 = 0xFD;
-
-// Check if data is Zstd compressed by looking at magic number
-static bool CheckIsZstd(const char *data, idx_t size) {
-	if (size < 4) {
-		return false;
-	}
-	return static_cast<uint8_t>(data[0]) == ZSTD_MAGIC_1 && static_cast<uint8_t>(data[1]) == ZSTD_MAGIC_2 &&
-	       static_cast<uint8_t>(data[2]) == ZSTD_MAGIC_3 && static_cast<uint8_t>(data[3]) == ZSTD_MAGIC_4;
-}
-
-// Decompress Zstd compressed data
-static string DecompressZstd(const string &compressed) {
-	unsigned long long decompressed_size = duckdb_zstd::ZSTD_getFrameContentSize(compressed.data(), compressed.size());
-
-	if (decompressed_size == ZSTD_CONTENTSIZE_ERROR) {
-		throw IOException("Invalid zstd compressed data");
-	}
-
-	if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN) {
-		decompressed_size = compressed.size() * 10;
-	}
-
-	vector<char> buffer(decompressed_size);
-
-	size_t actual_size =
-	    duckdb_zstd::ZSTD_decompress(buffer.data(), buffer.size(), compressed.data(), compressed.size());
-
-	if (duckdb_zstd::ZSTD_isError(actual_size)) {
-		throw IOException("Zstd decompression failed: %s", duckdb_zstd::ZSTD_getErrorName(actual_size));
-	}
-
-	return string(buffer.data(), actual_size);
+// Decode the (optionally GZip or Zstd compressed) body of a response, the raw body is returned if it can not be decoded
+static string DecodeContent(string &&raw_body, Allocator *allocator) {
+	return ContentDecoder::Decode(std::move(raw_body), allocator ? *allocator : Allocator::DefaultAllocator());
 }
 
 // Parse URL into host and path components
@@ -76,116 +45,121 @@ static void ParseUrl(const string &url, string &proto_host_port, string &path) {
 	}
 }
 
-// Parse a single Set-Cookie header value into a struct
-static Value ParseSetCookieHeader(const string &cookie_str) {
-	child_list_t<Value> cookie_values;
-	string name, value, expires, path, domain, samesite;
-	Value max_age = Value(LogicalType::INTEGER); // NULL by default
-	bool secure = false, httponly = false;
-
-	// Split by ';'
-	vector<string> parts;
-	idx_t start = 0;
-	for (idx_t i = 0; i <= cookie_str.size(); i++) {
-		if (i == cookie_str.size() || cookie_str[i] == ';') {
-			if (i > start) {
-				string part = cookie_str.substr(start, i - start);
-				StringUtil::Trim(part);
-				if (!part.empty()) {
-					parts.push_back(part);
-				}
-			}
-			start = i + 1;
-		}
+//======================================================================================================================
+// HttpStatistics Implementation
+//======================================================================================================================
+
+void HttpStatistics::RecordRequest(bool failed) {
+	std::lock_guard<std::mutex> guard(lock);
+	requests++;
+	failed_requests += failed ? 1 : 0;
+}
+
+void HttpStatistics::RecordLimit(const string &host, idx_t limit, const string &reason) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto &host_limit = host_limits[host];
+
+	if (limit > host_limit.limit && host_limit.limit > 0) {
+		host_limit.increases++;
+	} else if (limit < host_limit.limit) {
+		host_limit.decreases++;
 	}
+	host_limit.limit = limit;
 
-	// First part is name=value
-	if (!parts.empty()) {
-		auto eq_pos = parts[0].find('=');
-		if (eq_pos != string::npos) {
-			name = parts[0].substr(0, eq_pos);
-			value = parts[0].substr(eq_pos + 1);
-			StringUtil::Trim(name);
-			StringUtil::Trim(value);
-		} else {
-			name = parts[0];
-		}
+	if (!reason.empty()) {
+		host_limit.reason = reason;
 	}
+}
 
-	// Parse remaining attributes
-	for (idx_t i = 1; i < parts.size(); i++) {
-		string &part = parts[i];
-		auto eq_pos = part.find('=');
-		string attr_name, attr_value;
-		if (eq_pos != string::npos) {
-			attr_name = part.substr(0, eq_pos);
-			attr_value = part.substr(eq_pos + 1);
-			StringUtil::Trim(attr_name);
-			StringUtil::Trim(attr_value);
-		} else {
-			attr_name = part;
-			StringUtil::Trim(attr_name);
-		}
+void HttpStatistics::RecordHedge(bool won) {
+	std::lock_guard<std::mutex> guard(lock);
 
-		// Case-insensitive attribute matching
-		if (StringUtil::CIEquals(attr_name, "expires")) {
-			expires = attr_value;
-		} else if (StringUtil::CIEquals(attr_name, "max-age")) {
-			try {
-				max_age = Value::INTEGER(std::stoi(attr_value));
-			} catch (...) {
-				// Invalid max-age, keep NULL
-			}
-		} else if (StringUtil::CIEquals(attr_name, "path")) {
-			path = attr_value;
-		} else if (StringUtil::CIEquals(attr_name, "domain")) {
-			domain = attr_value;
-		} else if (StringUtil::CIEquals(attr_name, "secure")) {
-			secure = true;
-		} else if (StringUtil::CIEquals(attr_name, "httponly")) {
-			httponly = true;
-		} else if (StringUtil::CIEquals(attr_name, "samesite")) {
-			samesite = attr_value;
-		}
+	if (won) {
+		hedges_won++;
+	} else {
+		hedged_requests++;
 	}
+}
 
-	cookie_values.push_back(make_pair("name", Value(name)));
-	cookie_values.push_back(make_pair("value", Value(value)));
-	cookie_values.push_back(make_pair("expires", expires.empty() ? Value(LogicalType::VARCHAR) : Value(expires)));
-	cookie_values.push_back(make_pair("max_age", max_age));
-	cookie_values.push_back(make_pair("path", path.empty() ? Value(LogicalType::VARCHAR) : Value(path)));
-	cookie_values.push_back(make_pair("domain", domain.empty() ? Value(LogicalType::VARCHAR) : Value(domain)));
-	cookie_values.push_back(make_pair("secure", Value::BOOLEAN(secure)));
-	cookie_values.push_back(make_pair("httponly", Value::BOOLEAN(httponly)));
-	cookie_values.push_back(make_pair("samesite", samesite.empty() ? Value(LogicalType::VARCHAR) : Value(samesite)));
-
-	return Value::STRUCT(std::move(cookie_values));
+void HttpStatistics::EnableHedging() {
+	std::lock_guard<std::mutex> guard(lock);
+	hedging = true;
 }
 
-// Normalize HTTP header name to Title-Case (e.g., "content-type" -> "Content-Type")
-// Per HTTP convention, header names are case-insensitive but commonly written in Title-Case
-static string NormalizeHeaderName(const string &name) {
-	string result;
-	result.reserve(name.size());
-	bool capitalize_next = true;
-	for (char c : name) {
-		if (c == '-') {
-			result += c;
-			capitalize_next = true;
-		} else if (capitalize_next) {
-			result += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
-			capitalize_next = false;
-		} else {
-			result += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+void HttpStatistics::RecordCacheHit(const string &cache) {
+	std::lock_guard<std::mutex> guard(lock);
+	cache_hits[cache]++;
+}
+
+void HttpStatistics::ToString(InsertionOrderPreservingMap<string> &result) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	result["HTTP Requests"] = StringUtil::Format("%llu (%llu failed)", requests, failed_requests);
+
+	if (hedging || hedged_requests > 0) {
+		result["HTTP Hedged Requests"] =
+		    StringUtil::Format("%llu (%llu won by the hedge)", hedged_requests, hedges_won);
+	}
+
+	string limits;
+	for (const auto &entry : host_limits) {
+		const auto &host_limit = entry.second;
+
+		if (!limits.empty()) {
+			limits += "\n";
+		}
+		limits += StringUtil::Format("%s: %llu (+%llu/-%llu", entry.first, host_limit.limit, host_limit.increases,
+		                             host_limit.decreases);
+		limits += host_limit.reason.empty() ? ")" : ", last " + host_limit.reason + ")";
+	}
+	if (!limits.empty()) {
+		result["HTTP Concurrency"] = limits;
+	}
+
+	string hits;
+	for (const auto &entry : cache_hits) {
+		if (!hits.empty()) {
+			hits += "\n";
 		}
+		hits += StringUtil::Format("%s: %llu", entry.first, entry.second);
+	}
+	if (!hits.empty()) {
+		result["Cached Responses"] = hits;
 	}
-	return result;
 }
 
 //======================================================================================================================
 // HttpRequest Implementation
 //======================================================================================================================
 
+// Get the host (and port) of an URL
+string HttpRequest::GetUrlHost(const string &url) {
+	string proto_host_port, path;
+	ParseUrl(url, proto_host_port, path);
+	return proto_host_port;
+}
+
+string HttpRequest::GetUrlEndpoint(const string &url) {
+	string endpoint;
+
+	for (const auto &entry : eurostat::ENDPOINTS) {
+		const auto &api_url = entry.second.api_url;
+
+		if (api_url.size() > endpoint.size() && StringUtil::StartsWith(url, api_url)) {
+			endpoint = api_url;
+		}
+	}
+	return endpoint.empty() ? GetUrlHost(url) : endpoint;
+}
+
+// Whether a response shows that its endpoint is down
+bool HttpRequest::IsEndpointFailure(const HttpResponseData &response) {
+	if (response.status_code == 0) {
+		return !response.error.empty();
+	}
+	return response.status_code == 502 || response.status_code == 503 || response.status_code == 504;
+}
+
 // Extract HTTP settings from context (call from main thread)
 HttpSettings HttpRequest::ExtractHttpSettings(ClientContext &context, const string &url) {
 	HttpSettings settings;
@@ -197,6 +171,8 @@ HttpSettings HttpRequest::ExtractHttpSettings(ClientContext &context, const stri
 	settings.max_concurrency = DEFAULT_HTTP_MAX_CONCURRENT;
 	settings.use_cache = true;
 	settings.follow_redirects = true;
+	settings.allocator = &BufferAllocator::Get(context);
+	settings.transport = HttpTransport::HTTPLIB;
 
 	ClientContextFileOpener opener(context);
 	FileOpenerInfo info;
@@ -208,6 +184,14 @@ HttpSettings HttpRequest::ExtractHttpSettings(ClientContext &context, const stri
 	FileOpener::TryGetCurrentSetting(&opener, "http_request_cache", settings.use_cache, &info);
 	FileOpener::TryGetCurrentSetting(&opener, "http_follow_redirects", settings.follow_redirects, &info);
 
+	string transport;
+	if (FileOpener::TryGetCurrentSetting(&opener, "eurostat_http_transport", transport, &info) &&
+	    StringUtil::CIEquals(transport, "curl")) {
+		settings.transport = HttpTransport::CURL;
+	}
+	FileOpener::TryGetCurrentSetting(&opener, "eurostat_http_hedging", settings.hedging, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "eurostat_negative_cache_ttl", settings.negative_cache_ttl, &info);
+
 	auto &http_proxy_setting = db.config.options.http_proxy;
 	if (!http_proxy_setting.empty()) {
 		idx_t port;
@@ -248,14 +232,10 @@ HttpSettings HttpRequest::ExtractHttpSettings(ClientContext &context, const stri
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 
-// Execute HTTP request using synchronous XHR (works in Web Worker context where duckdb-wasm always runs).
+// Execute HTTP GET request using synchronous XHR (works in Web Worker context where duckdb-wasm always runs).
 // Uses arraybuffer to safely receive binary/compressed responses, then applies C++ decompression.
-HttpResponseData HttpRequest::ExecuteHttpRequest(const HttpSettings &settings, const string &url, const string &method,
-                                                 const HttpHeaders &headers, const string &request_body,
-                                                 const string &content_type) {
-	HttpResponseData result;
-	result.status_code = 0;
-	result.content_length = -1;
+static void ExecuteSingleRequest(const HttpSettings &settings, HttpStreamRequest &request) {
+	auto &result = request.response;
 
 	try {
 		int32_t status_code = 0;
@@ -266,30 +246,29 @@ HttpResponseData HttpRequest::ExecuteHttpRequest(const HttpSettings &settings, c
 		    {
 			    try {
 				    var url = UTF8ToString($0);
-				    var method = UTF8ToString($1);
 				    var xhr = new XMLHttpRequest();
-				    xhr.open(method, url, false); // false = synchronous
+				    xhr.open('GET', url, false); // false = synchronous
 				    xhr.responseType = 'arraybuffer';
 				    xhr.send(null);
-				    HEAP32[$2 >> 2] = xhr.status;
+				    HEAP32[$1 >> 2] = xhr.status;
 				    if (xhr.response && xhr.response.byteLength > 0) {
 					    var bytes = new Uint8Array(xhr.response);
 					    var len = bytes.length;
-					    HEAP32[$3 >> 2] = len;
+					    HEAP32[$2 >> 2] = len;
 					    var ptr = _malloc(len + 1);
 					    HEAPU8.set(bytes, ptr);
 					    HEAPU8[ptr + len] = 0;
 					    return ptr;
 				    }
-				    HEAP32[$3 >> 2] = 0;
+				    HEAP32[$2 >> 2] = 0;
 				    return 0;
 			    } catch (e) {
+				    HEAP32[$1 >> 2] = 0;
 				    HEAP32[$2 >> 2] = 0;
-				    HEAP32[$3 >> 2] = 0;
 				    return 0;
 			    }
 		    },
-		    url.c_str(), method.c_str(), &status_code, &body_len);
+		    request.url.c_str(), &status_code, &body_len);
 
 		result.status_code = status_code;
 		if (result.status_code == 0) {
@@ -299,144 +278,250 @@ HttpResponseData HttpRequest::ExecuteHttpRequest(const HttpSettings &settings, c
 			string raw_body(body_ptr, static_cast<size_t>(body_len));
 			free(body_ptr);
 			// Auto-decompress (same logic as native path)
-			try {
-				if (GZipFileSystem::CheckIsZip(raw_body.data(), raw_body.size())) {
-					result.body = GZipFileSystem::UncompressGZIPString(raw_body);
-				} else if (CheckIsZstd(raw_body.data(), raw_body.size())) {
-					result.body = DecompressZstd(raw_body);
-				} else {
-					result.body = std::move(raw_body);
-				}
-			} catch (...) {
-				result.body = std::move(raw_body);
-			}
+			result.body = DecodeContent(std::move(raw_body), settings.allocator);
 		} else if (body_ptr) {
 			free(body_ptr);
 		}
+
+		// The body is received at once by XHR, send it to the content receiver if requested.
+		if (result.error.empty() && request.response_handler && request.response_handler(result)) {
+			request.content_receiver(result.body.data(), result.body.size());
+			result.body.clear();
+		}
 	} catch (std::exception &e) {
 		result.error = e.what();
 	}
-
-	return result;
 }
 
 #else
 
-// Execute HTTP request with given settings
-HttpResponseData HttpRequest::ExecuteHttpRequest(const HttpSettings &settings, const string &url, const string &method,
-                                                 const HttpHeaders &headers, const string &request_body,
-                                                 const string &content_type) {
-	HttpResponseData result;
-	result.status_code = 0;
-	result.content_length = -1;
+// Configure a HTTP client with given settings
+static void ConfigureHttpClient(duckdb_httplib_openssl::Client &client, const HttpSettings &settings) {
+	client.set_follow_location(settings.follow_redirects);
+	client.set_decompress(false);
+	client.enable_server_certificate_verification(false);
+
+	auto timeout_sec = static_cast<time_t>(settings.timeout);
+	client.set_read_timeout(timeout_sec, 0);
+	client.set_write_timeout(timeout_sec, 0);
+	client.set_connection_timeout(timeout_sec, 0);
+	client.set_keep_alive(settings.keep_alive);
+
+	if (!settings.proxy.empty()) {
+		string proxy_host;
+		idx_t proxy_port = settings.proxy_port > 0 ? settings.proxy_port : 80;
+		string proxy_copy = settings.proxy;
+		HTTPUtil::ParseHTTPProxyHost(proxy_copy, proxy_host, proxy_port);
+		client.set_proxy(proxy_host, static_cast<int>(proxy_port));
+		if (!settings.proxy_username.empty()) {
+			client.set_proxy_basic_auth(settings.proxy_username, settings.proxy_password);
+		}
+	}
+}
+
+// Execute HTTP GET request with cpp-httplib, streaming the decompressed body to the content receiver if requested
+static void ExecuteSingleRequest(const HttpSettings &settings, HttpStreamRequest &request) {
+	auto &result = request.response;
 
 	try {
 		string proto_host_port, path;
-		ParseUrl(url, proto_host_port, path);
+		ParseUrl(request.url, proto_host_port, path);
 
 		duckdb_httplib_openssl::Client client(proto_host_port);
-		client.set_follow_location(settings.follow_redirects);
-		client.set_decompress(false);
-		client.enable_server_certificate_verification(false);
-
-		auto timeout_sec = static_cast<time_t>(settings.timeout);
-		client.set_read_timeout(timeout_sec, 0);
-		client.set_write_timeout(timeout_sec, 0);
-		client.set_connection_timeout(timeout_sec, 0);
-		client.set_keep_alive(settings.keep_alive);
-
-		if (!settings.proxy.empty()) {
-			string proxy_host;
-			idx_t proxy_port = settings.proxy_port > 0 ? settings.proxy_port : 80;
-			string proxy_copy = settings.proxy;
-			HTTPUtil::ParseHTTPProxyHost(proxy_copy, proxy_host, proxy_port);
-			client.set_proxy(proxy_host, static_cast<int>(proxy_port));
-			if (!settings.proxy_username.empty()) {
-				client.set_proxy_basic_auth(settings.proxy_username, settings.proxy_password);
-			}
-		}
+		ConfigureHttpClient(client, settings);
 
 		duckdb_httplib_openssl::Headers req_headers;
-		for (auto &h : headers) {
+		for (auto &h : request.headers) {
 			req_headers.insert({h.first, h.second});
 		}
 		if (req_headers.find("User-Agent") == req_headers.end()) {
 			req_headers.insert({"User-Agent", settings.user_agent});
 		}
 
-		duckdb_httplib_openssl::Result res(nullptr, duckdb_httplib_openssl::Error::Unknown);
-
-		if (StringUtil::CIEquals(method, "HEAD")) {
-			res = client.Head(path, req_headers);
-		} else if (StringUtil::CIEquals(method, "DELETE")) {
-			res = client.Delete(path, req_headers);
-		} else if (StringUtil::CIEquals(method, "POST")) {
-			string ct = content_type.empty() ? "application/octet-stream" : content_type;
-			res = client.Post(path, req_headers, request_body, ct);
-		} else if (StringUtil::CIEquals(method, "PUT")) {
-			string ct = content_type.empty() ? "application/octet-stream" : content_type;
-			res = client.Put(path, req_headers, request_body, ct);
-		} else if (StringUtil::CIEquals(method, "PATCH")) {
-			string ct = content_type.empty() ? "application/octet-stream" : content_type;
-			res = client.Patch(path, req_headers, request_body, ct);
-		} else {
-			res = client.Get(path, req_headers);
+		bool stream_body = false;
+		bool canceled = false;
+		bool interrupted = false;
+		string response_body;
+		ContentDecoder decoder(request.content_receiver,
+		                       settings.allocator ? *settings.allocator : Allocator::DefaultAllocator());
+
+		auto res = client.Get(
+		    path, req_headers,
+		    [&](const duckdb_httplib_openssl::Response &response) {
+			    result.status_code = response.status;
+			    result.content_type = response.get_header_value("Content-Type");
+			    if (response.has_header("Content-Length")) {
+				    try {
+					    result.content_length = std::stoll(response.get_header_value("Content-Length"));
+				    } catch (...) {
+				    }
+			    }
+			    if (request.read_headers) {
+				    for (auto &header : response.headers) {
+					    result.headers[header.first] = header.second;
+				    }
+			    }
+			    stream_body = request.response_handler && request.response_handler(result);
+			    return true;
+		    },
+		    [&](const char *data, size_t data_length) {
+			    if (!stream_body) {
+				    response_body.append(data, data_length);
+				    return true;
+			    }
+			    if (!decoder.Write(data, data_length)) {
+				    canceled = true;
+				    return false;
+			    }
+			    return true;
+		    },
+		    [&](uint64_t, uint64_t) {
+			    interrupted = HttpRequest::IsCanceled(settings);
+			    return !interrupted;
+		    });
+
+		if (interrupted) {
+			result.error = "HTTP request canceled";
+			return;
 		}
-
-		if (res.error() != duckdb_httplib_openssl::Error::Success) {
+		if (res.error() != duckdb_httplib_openssl::Error::Success &&
+		    !(canceled && res.error() == duckdb_httplib_openssl::Error::Canceled)) {
 			result.error = "HTTP request failed: " + to_string(res.error());
-			return result;
+			return;
+		}
+		if (stream_body && !canceled) {
+			decoder.Finish();
 		}
 
-		result.status_code = res->status;
-		string response_body = res->body;
-
-		for (auto &header : res->headers) {
-			if (StringUtil::CIEquals(header.first, "Set-Cookie")) {
-				result.cookies.push_back(ParseSetCookieHeader(header.second));
-			} else {
-				string normalized_key = NormalizeHeaderName(header.first);
-				if (StringUtil::CIEquals(header.first, "Content-Type")) {
-					result.content_type = header.second;
-				} else if (StringUtil::CIEquals(header.first, "Content-Length")) {
-					try {
-						result.content_length = std::stoll(header.second);
-					} catch (...) {
-					}
-				}
-				bool found = false;
-				for (idx_t i = 0; i < result.header_keys.size(); i++) {
-					if (StringUtil::CIEquals(result.header_keys[i].GetValue<string>(), normalized_key)) {
-						result.header_values[i] = Value(header.second);
-						found = true;
-						break;
-					}
-				}
-				if (!found) {
-					result.header_keys.push_back(Value(normalized_key));
-					result.header_values.push_back(Value(header.second));
-				}
+		// Auto-decompress the body that was not streamed
+		result.body = DecodeContent(std::move(response_body), settings.allocator);
+
+	} catch (std::exception &e) {
+		result.error = e.what();
+	}
+}
+
+#endif // __EMSCRIPTEN__
+
+// Execute HTTP GET request with given settings
+HttpResponseData HttpRequest::ExecuteHttpRequest(const HttpSettings &settings, const string &url,
+                                                 const HttpHeaders &headers, bool read_headers) {
+	vector<HttpStreamRequest> requests;
+	requests.emplace_back(url);
+	requests[0].headers = headers;
+	requests[0].read_headers = read_headers;
+
+	StreamHttpRequests(settings, requests);
+	return std::move(requests[0].response);
+}
+
+// Execute HTTP GET request streaming the decompressed body to the content receiver
+HttpResponseData HttpRequest::StreamHttpRequest(const HttpSettings &settings, const string &url,
+                                                const HttpHeaders &headers, const HttpResponseHandler &response_handler,
+                                                const HttpContentReceiver &content_receiver) {
+	vector<HttpStreamRequest> requests;
+	requests.emplace_back(url);
+	requests[0].headers = headers;
+	requests[0].response_handler = response_handler;
+	requests[0].content_receiver = content_receiver;
+
+	StreamHttpRequests(settings, requests);
+	return std::move(requests[0].response);
+}
+
+// Send a batch of HTTP GET requests with the transport of the settings
+static void SendHttpRequests(const HttpSettings &settings, vector<HttpStreamRequest> &requests) {
+#ifndef __EMSCRIPTEN__
+	if (settings.transport == HttpTransport::CURL) {
+		CurlHttpClient::StreamHttpRequests(settings, requests);
+		return;
+	}
+#endif
+	auto &breaker = CircuitBreaker::Get();
+
+	for (auto &request : requests) {
+		const auto endpoint = HttpRequest::GetUrlEndpoint(request.url);
+
+		// Fail fast when the endpoint is down.
+		if (!breaker.AllowRequest(endpoint, request.response.error)) {
+			continue;
+		}
+		{
+			RequestSlot slot(settings.priority, settings.max_concurrency);
+			ExecuteSingleRequest(settings, request);
+		}
+		// Canceled requests tell nothing about the endpoint.
+		if (HttpRequest::IsCanceled(settings)) {
+			if (request.response.error.empty()) {
+				request.response.error = "HTTP request canceled";
 			}
+			continue;
 		}
+		breaker.Record(endpoint, HttpRequest::IsEndpointFailure(request.response));
 
-		// Auto-decompress
-		result.body = response_body;
-		try {
-			if (GZipFileSystem::CheckIsZip(response_body.data(), response_body.size())) {
-				result.body = GZipFileSystem::UncompressGZIPString(response_body);
-			} else if (CheckIsZstd(response_body.data(), response_body.size())) {
-				result.body = DecompressZstd(response_body);
-			}
-		} catch (...) {
+		if (settings.statistics) {
+			const auto &response = request.response;
+			settings.statistics->RecordRequest(!response.error.empty() || response.status_code >= 400);
 		}
+	}
+}
 
-	} catch (std::exception &e) {
-		result.error = e.what();
+// Execute a batch of HTTP GET requests streaming their bodies
+void HttpRequest::StreamHttpRequests(const HttpSettings &settings, vector<HttpStreamRequest> &requests) {
+	auto &cache = NegativeCache::Get();
+	const auto cache_ttl = settings.use_cache ? settings.negative_cache_ttl : 0;
+
+	if (cache_ttl == 0) {
+		SendHttpRequests(settings, requests);
+		return;
+	}
+
+	// Answer the requests of recent negative results locally, send the other ones.
+
+	vector<idx_t> indexes;
+	vector<HttpStreamRequest> batch;
+
+	for (idx_t i = 0; i < requests.size(); i++) {
+		if (!cache.Lookup(requests[i].url, requests[i].response)) {
+			indexes.push_back(i);
+			batch.push_back(std::move(requests[i]));
+		}
+	}
+	if (batch.empty()) {
+		return;
 	}
+	SendHttpRequests(settings, batch);
 
-	return result;
+	for (idx_t i = 0; i < batch.size(); i++) {
+		auto &request = requests[indexes[i]];
+		request = std::move(batch[i]);
+
+		const auto &response = request.response;
+		const auto negative = request.negative_result ? request.negative_result(response)
+		                                              : response.status_code == 404 && response.error.empty();
+		if (negative) {
+			cache.Insert(request.url, response, cache_ttl);
+		}
+	}
 }
 
-#endif // __EMSCRIPTEN__
+// Execute a batch of HTTP GET requests
+vector<HttpResponseData> HttpRequest::ExecuteHttpRequests(const HttpSettings &settings, const vector<string> &urls) {
+	vector<HttpStreamRequest> requests;
+	requests.reserve(urls.size());
+
+	for (const auto &url : urls) {
+		requests.emplace_back(url);
+	}
+	StreamHttpRequests(settings, requests);
+
+	vector<HttpResponseData> responses;
+	responses.reserve(requests.size());
+
+	for (auto &request : requests) {
+		responses.push_back(std::move(request.response));
+	}
+	return responses;
+}
 
 } // namespace duckdb
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "content_decoder.hpp"
+#include "request_scheduler.hpp"
+#include <atomic>
+#include <map>
+#include <mutex>
 
 #ifndef __EMSCRIPTEN__
 // Use httplib directly for full HTTP method support
@@ -15,6 +20,43 @@ namespace duckdb {
 // 	https://github.com/midwork-finds-jobs/duckdb_http_request
 // 	Thanks a lot to Onni Hakala (onnimonni) for open sourcing it!
 
+//! Transport used to execute HTTP requests
+enum class HttpTransport : uint8_t {
+	HTTPLIB, // cpp-httplib, one request per connection, requests of a batch are executed one after another
+	CURL     // libcurl multi interface, requests of a batch are multiplexed over a few HTTP/2 connections per host
+};
+
+//! Statistics of the HTTP requests of a scan (thread-safe), shown by EXPLAIN ANALYZE
+struct HttpStatistics {
+	//! Concurrency limit of a host and the reason of its last change
+	struct HostLimit {
+		idx_t limit = 0;
+		idx_t increases = 0;
+		idx_t decreases = 0;
+		string reason;
+	};
+
+	void RecordRequest(bool failed);
+	//! Record the concurrency limit of a host after a request, and the reason of its change (empty if unchanged).
+	void RecordLimit(const string &host, idx_t limit, const string &reason);
+	void RecordHedge(bool won);
+	//! Show the hedged requests even when there are none, the requests can be hedged.
+	void EnableHedging();
+	//! Record a response read from a cache instead of the API (e.g. "memory", "shared").
+	void RecordCacheHit(const string &cache);
+	void ToString(InsertionOrderPreservingMap<string> &result);
+
+private:
+	std::mutex lock;
+	idx_t requests = 0;
+	idx_t failed_requests = 0;
+	idx_t hedged_requests = 0;
+	idx_t hedges_won = 0;
+	bool hedging = false;
+	std::map<string, HostLimit> host_limits;
+	std::map<string, idx_t> cache_hits;
+};
+
 //! Struct to hold HTTP settings extracted from context (thread-safe to pass to workers)
 struct HttpSettings {
 	uint64_t timeout;
@@ -27,6 +69,13 @@ struct HttpSettings {
 	uint64_t max_concurrency;
 	bool use_cache;
 	bool follow_redirects;
+	HttpTransport transport = HttpTransport::HTTPLIB;
+	bool hedging = false; // Hedge slow requests (curl transport only)
+	RequestPriority priority = RequestPriority::METADATA; // Priority class of the requests in the scheduler
+	uint64_t negative_cache_ttl = 0; // Time to live of the cached negative results, in seconds (0 = disabled)
+	shared_ptr<HttpStatistics> statistics; // Optional, statistics of the requests
+	const std::atomic<bool> *canceled = nullptr; // Optional, aborts the requests when set (e.g. interrupted scan)
+	Allocator *allocator = nullptr; // Allocator of the response buffers, accounted in the DuckDB 'memory_limit'
 };
 
 //! Struct to hold HTTP headers map
@@ -37,22 +86,69 @@ struct HttpResponseData {
 	int32_t status_code;
 	string content_type;
 	int64_t content_length;
-	vector<Value> header_keys;
-	vector<Value> header_values;
-	vector<Value> cookies;
+	HttpHeaders headers; // Raw response headers, only filled if requested
 	string body;
 	string error; // Non-empty if request failed
 };
 
+//! Callback to inspect the status and headers of a response before its body is received, returns true to stream the
+//! body to the content receiver, or false to keep it in the body of the response (e.g. error messages).
+using HttpResponseHandler = std::function<bool(const HttpResponseData &response)>;
+
+//! HTTP GET request of a batch, its body is streamed to the content receiver if the response handler accepts it,
+//! otherwise it is kept (decompressed) in the body of the response.
+struct HttpStreamRequest {
+	string url;
+	HttpHeaders headers;
+	HttpResponseHandler response_handler;
+	HttpContentReceiver content_receiver;
+	bool read_headers = false; // Keep the raw response headers
+	//! Optional, tells if a response is a negative result (e.g. no data) that can be answered locally by the next
+	//! requests of the URL for a while. By default, only 404 responses are.
+	HttpResponseHandler negative_result;
+	HttpResponseData response;
+
+	explicit HttpStreamRequest(string url_p) : url(std::move(url_p)) {
+		response.status_code = 0;
+		response.content_length = -1;
+	}
+};
+
 //! Represents an HTTP request
 struct HttpRequest {
 	// Extract HTTP settings from context
 	static HttpSettings ExtractHttpSettings(ClientContext &context, const string &url);
 
-	// Execute HTTP request with given settings
-	static HttpResponseData ExecuteHttpRequest(const HttpSettings &settings, const string &url, const string &method,
-	                                           const HttpHeaders &headers, const string &request_body,
-	                                           const string &content_type);
+	// Get the host (and port) of an URL, e.g. "https://ec.europa.eu"
+	static string GetUrlHost(const string &url);
+	// Get the endpoint of an URL: the API URL of its provider (several providers share a host), or its host
+	static string GetUrlEndpoint(const string &url);
+
+	// Whether a response shows that its endpoint is down (unreachable host, timeout, gateway errors)
+	static bool IsEndpointFailure(const HttpResponseData &response);
+	// Whether the requests of the settings were canceled by their caller
+	static bool IsCanceled(const HttpSettings &settings) {
+		return settings.canceled && *settings.canceled;
+	}
+
+	// Execute HTTP GET request with given settings, the body is decompressed. Response headers are only kept when
+	// 'read_headers' is set.
+	static HttpResponseData ExecuteHttpRequest(const HttpSettings &settings, const string &url,
+	                                           const HttpHeaders &headers = HttpHeaders(), bool read_headers = false);
+
+	// Execute HTTP GET request streaming the decompressed body to the content receiver. The transfer stops early
+	// when the receiver returns false, that is not considered an error.
+	static HttpResponseData StreamHttpRequest(const HttpSettings &settings, const string &url,
+	                                          const HttpHeaders &headers, const HttpResponseHandler &response_handler,
+	                                          const HttpContentReceiver &content_receiver);
+
+	// Execute a batch of HTTP GET requests streaming their bodies (see StreamHttpRequest), returns when all of them
+	// are completed. Requests run concurrently with the 'curl' transport, one after another otherwise. Recent
+	// negative results (see HttpStreamRequest::negative_result) are answered locally.
+	static void StreamHttpRequests(const HttpSettings &settings, vector<HttpStreamRequest> &requests);
+
+	// Execute a batch of HTTP GET requests, responses are returned in the order of the URLs.
+	static vector<HttpResponseData> ExecuteHttpRequests(const HttpSettings &settings, const vector<string> &urls);
 };
 
 } // namespace duckdb
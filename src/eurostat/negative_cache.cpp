@@ -0,0 +1,71 @@
+#include "negative_cache.hpp"
+
+#include <iterator>
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Max number of cached negative results
+static constexpr idx_t NEGATIVE_CACHE_CAPACITY = 1024;
+
+//======================================================================================================================
+// NegativeCache Implementation
+//======================================================================================================================
+
+NegativeCache &NegativeCache::Get() {
+	static NegativeCache instance;
+	return instance;
+}
+
+bool NegativeCache::Lookup(const string &url, HttpResponseData &response) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto it = entries.find(url);
+
+	if (it == entries.end()) {
+		return false;
+	}
+	if (it->second.expires_at <= std::chrono::steady_clock::now()) {
+		entries.erase(it);
+		return false;
+	}
+	response.status_code = it->second.status_code;
+	response.content_type = it->second.content_type;
+	response.content_length = static_cast<int64_t>(it->second.body.size());
+	response.body = it->second.body;
+	response.error.clear();
+	return true;
+}
+
+void NegativeCache::Insert(const string &url, const HttpResponseData &response, uint64_t ttl) {
+	const auto now = std::chrono::steady_clock::now();
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (entries.size() >= NEGATIVE_CACHE_CAPACITY) {
+		Evict(now);
+	}
+	auto &entry = entries[url];
+	entry.status_code = response.status_code;
+	entry.content_type = response.content_type;
+	entry.body = response.body;
+	entry.expires_at = now + std::chrono::seconds(ttl);
+}
+
+void NegativeCache::Evict(std::chrono::steady_clock::time_point now) {
+	for (auto it = entries.begin(); it != entries.end();) {
+		it = it->second.expires_at <= now ? entries.erase(it) : std::next(it);
+	}
+	while (entries.size() >= NEGATIVE_CACHE_CAPACITY) {
+		auto oldest = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.expires_at < oldest->second.expires_at) {
+				oldest = it;
+			}
+		}
+		entries.erase(oldest);
+	}
+}
+
+} // namespace duckdb
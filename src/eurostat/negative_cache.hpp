@@ -0,0 +1,37 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "http_request.hpp"
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+//! Cache of the recent negative results (unknown dataflows, queries without data...) per URL, so repeated misses
+//! are answered locally for a short time instead of hitting the API again. Shared by all the requests of the process.
+class NegativeCache {
+public:
+	static NegativeCache &Get();
+
+	//! Fill the response of the URL if it is a cached negative result.
+	bool Lookup(const string &url, HttpResponseData &response);
+	//! Cache the negative result of the URL for the given time to live, in seconds.
+	void Insert(const string &url, const HttpResponseData &response, uint64_t ttl);
+
+private:
+	struct Entry {
+		int32_t status_code;
+		string content_type;
+		string body;
+		std::chrono::steady_clock::time_point expires_at;
+	};
+
+	//! Remove the expired entries, and the ones expiring first if the cache is still full.
+	void Evict(std::chrono::steady_clock::time_point now);
+
+	std::mutex lock;
+	std::unordered_map<string, Entry> entries;
+};
+
+} // namespace duckdb
@@ -0,0 +1,191 @@
+#include "parsed_response.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Initial number of items of the arrays of a builder
+static constexpr idx_t BUILDER_INITIAL_CAPACITY = 1024;
+
+//======================================================================================================================
+// ParsedResponse Implementation
+//======================================================================================================================
+
+idx_t ParsedResponse::GetMemoryUsage() const {
+	idx_t result = series_codes.GetSize() + series_offsets.GetSize() + observation_periods.GetSize() +
+	               observation_values.GetSize();
+
+	for (const auto &dictionary : dictionaries) {
+		for (const auto &code : dictionary) {
+			result += code.size() + sizeof(string);
+		}
+	}
+	for (const auto &time_period : time_periods) {
+		result += time_period.size() + sizeof(string);
+	}
+	return result;
+}
+
+//======================================================================================================================
+// ParsedResponseBuilder Implementation
+//======================================================================================================================
+
+ParsedResponseBuilder::ParsedResponseBuilder(Allocator &allocator, idx_t memory_limit)
+    : allocator(allocator), memory_limit(memory_limit) {
+}
+
+template <class T>
+void ParsedResponseBuilder::Array<T>::Resize(ParsedResponseBuilder &builder, idx_t new_count) {
+	if (new_count * sizeof(T) > data.GetSize()) {
+		const auto capacity = MaxValue<idx_t>(MaxValue<idx_t>(count * 2, new_count), BUILDER_INITIAL_CAPACITY);
+		const auto old_size = data.GetSize();
+
+		builder.memory_usage += capacity * sizeof(T) - old_size;
+		if (builder.memory_usage > builder.memory_limit) {
+			builder.Discard();
+			return;
+		}
+		auto new_data = builder.allocator.Allocate(capacity * sizeof(T));
+		if (count > 0) {
+			memcpy(new_data.get(), data.get(), count * sizeof(T));
+		}
+		data = std::move(new_data);
+	}
+	count = new_count;
+}
+
+void ParsedResponseBuilder::Discard() {
+	discarded = true;
+	response.reset();
+	code_ids.clear();
+	series_codes = Array<uint32_t>();
+	series_offsets = Array<idx_t>();
+	observation_periods = Array<uint32_t>();
+	observation_values = Array<double>();
+}
+
+void ParsedResponseBuilder::SetHeader(const std::vector<string> &dimension_names,
+                                      const std::vector<string> &time_periods) {
+	if (discarded) {
+		return;
+	}
+	response->dimension_names = dimension_names;
+	response->dictionaries.resize(dimension_names.size());
+	response->time_periods = time_periods;
+	code_ids.resize(dimension_names.size());
+}
+
+void ParsedResponseBuilder::AddSeries() {
+	if (discarded) {
+		return;
+	}
+	series_offsets.Push(*this, observation_values.count);
+	if (discarded) {
+		return;
+	}
+	const auto codes_start = series_codes.count;
+	series_codes.Resize(*this, codes_start + code_ids.size());
+	if (discarded) {
+		return;
+	}
+	memset(series_codes.Get() + codes_start, 0, code_ids.size() * sizeof(uint32_t));
+}
+
+void ParsedResponseBuilder::AddCode(idx_t dim_index, const string &code) {
+	if (discarded) {
+		return;
+	}
+	auto &ids = code_ids[dim_index];
+	auto it = ids.find(code);
+
+	if (it == ids.end()) {
+		it = ids.emplace(code, static_cast<uint32_t>(ids.size())).first;
+		response->dictionaries[dim_index].push_back(code);
+		memory_usage += code.size() + sizeof(string);
+	}
+	series_codes.Get()[series_codes.count - code_ids.size() + dim_index] = it->second;
+}
+
+void ParsedResponseBuilder::AddObservation(uint32_t period_index, double value) {
+	if (discarded) {
+		return;
+	}
+	observation_periods.Push(*this, period_index);
+	if (discarded) {
+		return;
+	}
+	observation_values.Push(*this, value);
+}
+
+shared_ptr<ParsedResponse> ParsedResponseBuilder::Finish() {
+	if (discarded) {
+		return nullptr;
+	}
+	response->series_count = series_offsets.count;
+	response->observation_count = observation_values.count;
+	series_offsets.Push(*this, observation_values.count);
+	if (discarded) {
+		return nullptr;
+	}
+
+	// The arrays are kept with their spare capacity (half of them at most), not copied again.
+	response->series_codes = std::move(series_codes.data);
+	response->series_offsets = std::move(series_offsets.data);
+	response->observation_periods = std::move(observation_periods.data);
+	response->observation_values = std::move(observation_values.data);
+	return std::move(response);
+}
+
+//======================================================================================================================
+// ParsedResponseCache Implementation
+//======================================================================================================================
+
+shared_ptr<const ParsedResponse> ParsedResponseCache::Lookup(const string &key) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto it = entries.find(key);
+
+	if (it == entries.end()) {
+		return nullptr;
+	}
+	it->second.last_access = ++access_tick;
+	return it->second.response;
+}
+
+void ParsedResponseCache::Insert(const string &key, shared_ptr<const ParsedResponse> response, idx_t memory_limit) {
+	const auto response_size = response->GetMemoryUsage();
+
+	if (response_size > memory_limit) {
+		return;
+	}
+	std::lock_guard<std::mutex> guard(lock);
+	auto it = entries.find(key);
+
+	if (it != entries.end()) {
+		memory_usage -= it->second.response->GetMemoryUsage();
+		entries.erase(it);
+	}
+
+	// Evict the least recently used responses.
+
+	while (!entries.empty() && memory_usage + response_size > memory_limit) {
+		auto oldest = entries.begin();
+		for (auto entry_it = entries.begin(); entry_it != entries.end(); entry_it++) {
+			if (entry_it->second.last_access < oldest->second.last_access) {
+				oldest = entry_it;
+			}
+		}
+		memory_usage -= oldest->second.response->GetMemoryUsage();
+		entries.erase(oldest);
+	}
+
+	auto &entry = entries[key];
+	entry.response = std::move(response);
+	entry.last_access = ++access_tick;
+	memory_usage += response_size;
+}
+
+} // namespace duckdb
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+//! Columnar representation of a parsed TSV response: dictionaries of the codes of the dimensions of the series key,
+//! table of the time periods, and the observations of each series. The arrays are allocated by the DuckDB buffer
+//! allocator, so they are accounted in the 'memory_limit'.
+struct ParsedResponse {
+	//! Names of the dimensions of the series key (in the order of the TSV header), and their codes.
+	std::vector<string> dimension_names;
+	std::vector<std::vector<string>> dictionaries;
+	//! Time periods of the TSV header.
+	std::vector<string> time_periods;
+
+	idx_t series_count = 0;
+	idx_t observation_count = 0;
+	//! Code ids of the dimensions of each series (uint32_t, 'series_count' x dimensions).
+	AllocatedData series_codes;
+	//! Offset of the first observation of each series, and of the end (idx_t, 'series_count' + 1).
+	AllocatedData series_offsets;
+	//! Period index (uint32_t) and value (double) of each observation.
+	AllocatedData observation_periods;
+	AllocatedData observation_values;
+
+	const uint32_t *GetSeriesCodes(idx_t series_idx) const {
+		return reinterpret_cast<const uint32_t *>(series_codes.get()) + series_idx * dimension_names.size();
+	}
+	const idx_t *GetSeriesOffsets() const {
+		return reinterpret_cast<const idx_t *>(series_offsets.get());
+	}
+	const uint32_t *GetObservationPeriods() const {
+		return reinterpret_cast<const uint32_t *>(observation_periods.get());
+	}
+	const double *GetObservationValues() const {
+		return reinterpret_cast<const double *>(observation_values.get());
+	}
+
+	//! Memory used by the response, in bytes.
+	idx_t GetMemoryUsage() const;
+};
+
+//! Builds a ParsedResponse while a TSV response is parsed. Its arrays grow in memory of the given allocator (the
+//! buffer allocator, accounted in the 'memory_limit'), and the response is discarded as soon as it is larger than
+//! the memory limit of the cache, which would not keep it.
+class ParsedResponseBuilder {
+public:
+	ParsedResponseBuilder(Allocator &allocator, idx_t memory_limit);
+
+	//! Set the dimensions and time periods of the TSV header.
+	void SetHeader(const std::vector<string> &dimension_names, const std::vector<string> &time_periods);
+	//! Add a series, then the codes of its dimensions and its observations.
+	void AddSeries();
+	void AddCode(idx_t dim_index, const string &code);
+	void AddObservation(uint32_t period_index, double value);
+
+	//! Get the parsed response, nullptr if it was discarded.
+	shared_ptr<ParsedResponse> Finish();
+
+private:
+	//! Array of the allocator, doubled when full.
+	template <class T>
+	struct Array {
+		AllocatedData data;
+		idx_t count = 0;
+
+		T *Get() {
+			return reinterpret_cast<T *>(data.get());
+		}
+		void Resize(ParsedResponseBuilder &builder, idx_t new_count);
+		void Push(ParsedResponseBuilder &builder, const T &value) {
+			Resize(builder, count + 1);
+			if (!builder.discarded) {
+				Get()[count - 1] = value;
+			}
+		}
+	};
+
+	//! Discard the response, freeing its memory.
+	void Discard();
+
+	Allocator &allocator;
+	idx_t memory_limit;
+	//! Memory of the arrays and dictionaries, in bytes.
+	idx_t memory_usage = 0;
+	bool discarded = false;
+
+	shared_ptr<ParsedResponse> response = make_shared_ptr<ParsedResponse>();
+	std::vector<std::unordered_map<string, uint32_t>> code_ids;
+	Array<uint32_t> series_codes;
+	Array<idx_t> series_offsets;
+	Array<uint32_t> observation_periods;
+	Array<double> observation_values;
+};
+
+//! Cache of the parsed responses of a database, keyed by request URL and update time of the dataflow, so repeated
+//! reads skip the download, the decompression and the parsing. Registered in the object cache of the database.
+class ParsedResponseCache : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "eurostat_parsed_responses";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+	optional_idx GetEstimatedCacheMemory() const override {
+		return optional_idx(memory_usage.load());
+	}
+
+	//! Get the cached response of a key, nullptr if missing.
+	shared_ptr<const ParsedResponse> Lookup(const string &key);
+	//! Cache the response of a key, evicting the least recently used responses above the memory limit (in bytes).
+	void Insert(const string &key, shared_ptr<const ParsedResponse> response, idx_t memory_limit);
+
+private:
+	struct Entry {
+		shared_ptr<const ParsedResponse> response;
+		idx_t last_access = 0;
+	};
+
+	std::mutex lock;
+	std::unordered_map<string, Entry> entries;
+	std::atomic<idx_t> memory_usage {0};
+	idx_t access_tick = 0;
+};
+
+} // namespace duckdb
@@ -0,0 +1,103 @@
+#include "request_scheduler.hpp"
+
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Slots reserved to the metadata requests, as a fraction of all slots
+static constexpr idx_t METADATA_RESERVED_DIVISOR = 8;
+
+// Max slots taken by the bulk requests, as a fraction of all slots
+static constexpr idx_t BULK_QUOTA_DIVISOR = 2;
+
+//======================================================================================================================
+// RequestScheduler Implementation
+//======================================================================================================================
+
+RequestScheduler &RequestScheduler::Get() {
+	static RequestScheduler instance;
+	return instance;
+}
+
+RequestPriority RequestScheduler::ParseDataPriority(const string &name) {
+	const auto priority = StringUtil::Lower(name);
+
+	if (priority == "interactive") {
+		return RequestPriority::INTERACTIVE;
+	}
+	if (priority == "bulk") {
+		return RequestPriority::BULK;
+	}
+	throw InvalidInputException("EUROSTAT: Unknown request priority '%s', expected 'interactive' or 'bulk'.", name);
+}
+
+bool RequestScheduler::CanAcquire(RequestPriority priority, idx_t max_slots) const {
+	const auto index = static_cast<idx_t>(priority);
+	max_slots = MaxValue<idx_t>(max_slots, 1);
+
+	// Strict priority: requests of higher classes waiting for a slot go first.
+	for (idx_t i = 0; i < index; i++) {
+		if (waiting[i] > 0) {
+			return false;
+		}
+	}
+
+	const auto total_in_use = in_use[0] + in_use[1] + in_use[2];
+	if (total_in_use >= max_slots) {
+		return false;
+	}
+
+	// Per-class quotas.
+	if (priority != RequestPriority::METADATA) {
+		const auto reserved = max_slots > 2 ? MaxValue<idx_t>(1, max_slots / METADATA_RESERVED_DIVISOR) : 0;
+
+		if (in_use[1] + in_use[2] >= max_slots - reserved) {
+			return false;
+		}
+	}
+	if (priority == RequestPriority::BULK) {
+		if (in_use[2] >= MaxValue<idx_t>(1, max_slots / BULK_QUOTA_DIVISOR)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void RequestScheduler::Acquire(RequestPriority priority, idx_t max_slots) {
+	const auto index = static_cast<idx_t>(priority);
+	std::unique_lock<std::mutex> guard(lock);
+
+	waiting[index]++;
+	slot_released.wait(guard, [&]() {
+		// Do not block on the waiters of our own class, CanAcquire only checks the higher ones.
+		return CanAcquire(priority, max_slots);
+	});
+	waiting[index]--;
+	in_use[index]++;
+}
+
+bool RequestScheduler::TryAcquire(RequestPriority priority, idx_t max_slots) {
+	const auto index = static_cast<idx_t>(priority);
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (waiting[index] > 0 || !CanAcquire(priority, max_slots)) {
+		return false;
+	}
+	in_use[index]++;
+	return true;
+}
+
+void RequestScheduler::Release(RequestPriority priority) {
+	const auto index = static_cast<idx_t>(priority);
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		in_use[index]--;
+	}
+	slot_released.notify_all();
+}
+
+} // namespace duckdb
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <condition_variable>
+#include <mutex>
+
+namespace duckdb {
+
+//! Priority class of a HTTP request, lower values are served first.
+enum class RequestPriority : uint8_t {
+	METADATA = 0,    // Dataflows, data structures and constraints, needed to bind queries
+	INTERACTIVE = 1, // Datasets read by interactive queries
+	BULK = 2         // Datasets read by bulk loads (e.g. nightly syncs)
+};
+
+//! Process-wide scheduler of the HTTP requests, with priority classes and per-class quotas of the concurrent
+//! requests. Metadata requests always have some slots reserved, and bulk loads can take only half of the slots, so
+//! binding queries stays fast while large datasets are downloaded.
+class RequestScheduler {
+public:
+	static RequestScheduler &Get();
+
+	//! Wait for a request slot of the given class.
+	void Acquire(RequestPriority priority, idx_t max_slots);
+	//! Take a request slot of the given class if available, never before the requests already waiting for one of
+	//! the same or higher priority.
+	bool TryAcquire(RequestPriority priority, idx_t max_slots);
+	//! Release a request slot.
+	void Release(RequestPriority priority);
+
+	//! Parse the name of a priority class of the data requests ('interactive' or 'bulk').
+	static RequestPriority ParseDataPriority(const string &name);
+
+private:
+	static constexpr idx_t PRIORITY_COUNT = 3;
+
+	bool CanAcquire(RequestPriority priority, idx_t max_slots) const;
+
+	std::mutex lock;
+	std::condition_variable slot_released;
+	idx_t in_use[PRIORITY_COUNT] = {0, 0, 0};
+	idx_t waiting[PRIORITY_COUNT] = {0, 0, 0};
+};
+
+//! Request slot held during the scope of the object.
+class RequestSlot {
+public:
+	RequestSlot(RequestPriority priority, idx_t max_slots) : priority(priority) {
+		RequestScheduler::Get().Acquire(priority, max_slots);
+	}
+	~RequestSlot() {
+		RequestScheduler::Get().Release(priority);
+	}
+
+private:
+	RequestPriority priority;
+};
+
+} // namespace duckdb
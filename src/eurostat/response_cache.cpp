@@ -0,0 +1,349 @@
+#include "response_cache.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+//! Parse the year of a period (e.g. "2010", "2010-Q1", "2010-01"), returns false if it does not start with one.
+//! With 'exact', the period must be a year.
+static bool ParseYear(const string &period, bool exact, int64_t &year) {
+	if (period.size() < 4 || (exact && period.size() != 4)) {
+		return false;
+	}
+	year = 0;
+
+	for (idx_t i = 0; i < 4; i++) {
+		if (!StringUtil::CharacterIsDigit(period[i])) {
+			return false;
+		}
+		year = year * 10 + (period[i] - '0');
+	}
+	return true;
+}
+
+//! Split a string keeping the empty parts (e.g. "A..B" has three parts).
+static vector<string> SplitParts(const string &input, char delimiter) {
+	vector<string> result;
+	idx_t start = 0;
+
+	for (idx_t i = 0; i <= input.size(); i++) {
+		if (i == input.size() || input[i] == delimiter) {
+			result.push_back(input.substr(start, i - start));
+			start = i + 1;
+		}
+	}
+	return result;
+}
+
+//======================================================================================================================
+// DataQuery Implementation
+//======================================================================================================================
+
+bool DataQuery::Parse(const string &filter_clause, DataQuery &result) {
+	result = DataQuery();
+
+	const auto query_pos = filter_clause.find('?');
+	const auto mask = filter_clause.substr(0, query_pos);
+
+	// Dimension masks (e.g. "/A.DE+FR..").
+
+	if (!mask.empty()) {
+		if (mask[0] != '/') {
+			return false;
+		}
+		for (const auto &dim_mask : SplitParts(mask.substr(1), '.')) {
+			std::vector<string> codes;
+
+			if (!dim_mask.empty()) {
+				for (auto &code : SplitParts(dim_mask, '+')) {
+					codes.push_back(std::move(code));
+				}
+				std::sort(codes.begin(), codes.end());
+				codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+			}
+			result.dim_codes.push_back(std::move(codes));
+		}
+	}
+
+	// Range of periods (e.g. "startPeriod=2010&endPeriod=2020&"), only years can be compared with cached responses.
+
+	if (query_pos == string::npos) {
+		return true;
+	}
+	for (const auto &parameter : SplitParts(filter_clause.substr(query_pos + 1), '&')) {
+		if (parameter.empty()) {
+			continue;
+		}
+		const auto eq_pos = parameter.find('=');
+
+		if (eq_pos == string::npos) {
+			return false;
+		}
+		const auto name = parameter.substr(0, eq_pos);
+		const auto value = parameter.substr(eq_pos + 1);
+
+		if (name == "startPeriod" && ParseYear(value, true, result.start_year)) {
+			continue;
+		}
+		if (name == "endPeriod" && ParseYear(value, true, result.end_year)) {
+			continue;
+		}
+		return false;
+	}
+	return true;
+}
+
+string DataQuery::GetFilterClause() const {
+	string filter_clause;
+
+	// Dimension filters part (e.g., "A.B+X.C.D+Y").
+
+	if (!dim_codes.empty()) {
+		filter_clause += "/";
+
+		for (idx_t i = 0; i < dim_codes.size(); i++) {
+			if (i > 0) {
+				filter_clause += ".";
+			}
+			filter_clause += StringUtil::Join(dim_codes[i], "+");
+		}
+	}
+	filter_clause += "?";
+
+	// Time period filters part (e.g., "startPeriod=2020&endPeriod=2021&").
+
+	if (start_year != NumericLimits<int64_t>::Minimum()) {
+		filter_clause += "startPeriod=" + std::to_string(start_year) + "&";
+	}
+	if (end_year != NumericLimits<int64_t>::Maximum()) {
+		filter_clause += "endPeriod=" + std::to_string(end_year) + "&";
+	}
+	return filter_clause;
+}
+
+bool DataQuery::CoversSeries(const DataQuery &other) const {
+	for (idx_t i = 0; i < dim_codes.size(); i++) {
+		if (dim_codes[i].empty()) {
+			continue;
+		}
+		if (i >= other.dim_codes.size() || other.dim_codes[i].empty()) {
+			return false;
+		}
+		if (!std::includes(dim_codes[i].begin(), dim_codes[i].end(), other.dim_codes[i].begin(),
+		                   other.dim_codes[i].end())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool DataQuery::MatchesCode(idx_t dim_index, const string &code) const {
+	if (dim_index >= dim_codes.size() || dim_codes[dim_index].empty()) {
+		return true;
+	}
+	return std::binary_search(dim_codes[dim_index].begin(), dim_codes[dim_index].end(), code);
+}
+
+bool DataQuery::MatchesPeriod(const string &time_period) const {
+	if (start_year == NumericLimits<int64_t>::Minimum() && end_year == NumericLimits<int64_t>::Maximum()) {
+		return true;
+	}
+	int64_t year;
+
+	if (!ParseYear(time_period, false, year)) {
+		return false;
+	}
+	return year >= start_year && year <= end_year;
+}
+
+bool DataQuery::operator==(const DataQuery &other) const {
+	return dim_codes == other.dim_codes && start_year == other.start_year && end_year == other.end_year;
+}
+
+//======================================================================================================================
+// BodyWriter Implementation
+//======================================================================================================================
+
+ResponseCache::BodyWriter::BodyWriter(idx_t memory_limit) : memory_limit(memory_limit), dropped(false) {
+	encoder = make_uniq<ContentEncoder>([this](const char *data, size_t data_length) {
+		if (!dropped) {
+			body.append(data, data_length);
+		}
+		return true;
+	});
+}
+
+void ResponseCache::BodyWriter::Append(const char *data, idx_t data_length) {
+	if (dropped) {
+		return;
+	}
+	encoder->Write(data, data_length);
+
+	if (body.size() > memory_limit) {
+		dropped = true;
+		body.clear();
+		body.shrink_to_fit();
+	}
+}
+
+string ResponseCache::BodyWriter::Finish() {
+	if (dropped) {
+		return string();
+	}
+	encoder->Finish();
+	return body.size() > memory_limit ? string() : std::move(body);
+}
+
+//======================================================================================================================
+// ResponseCache Implementation
+//======================================================================================================================
+
+ResponseCache &ResponseCache::Get() {
+	static ResponseCache instance;
+	return instance;
+}
+
+void ResponseCache::Lookup(const string &dataflow_key, const DataQuery &query, vector<Slice> &slices,
+                           vector<DataQuery> &gaps) {
+	const auto now = std::chrono::steady_clock::now();
+	vector<shared_ptr<const Entry>> candidates;
+
+	// Cached responses covering the series of the query, and some of its years.
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entries.find(dataflow_key);
+
+		if (it != entries.end()) {
+			for (const auto &entry : it->second) {
+				if (entry->expires_at > now && entry->query.start_year <= query.end_year &&
+				    entry->query.end_year >= query.start_year && entry->query.CoversSeries(query)) {
+					entry->last_access = ++access_tick;
+					candidates.push_back(entry);
+				}
+			}
+		}
+	}
+
+	// Cover the years of the query with the fewest cached responses (the one reaching the farthest year among the
+	// ones starting before the first uncovered year), the uncovered ranges are downloaded.
+
+	auto cursor = query.start_year;
+
+	while (true) {
+		shared_ptr<const Entry> best;
+		auto next_start = NumericLimits<int64_t>::Maximum();
+
+		for (const auto &entry : candidates) {
+			if (entry->query.end_year < cursor) {
+				continue;
+			}
+			if (entry->query.start_year <= cursor) {
+				if (!best || entry->query.end_year > best->query.end_year) {
+					best = entry;
+				}
+			} else {
+				next_start = MinValue(next_start, entry->query.start_year);
+			}
+		}
+
+		if (!best) {
+			DataQuery gap = query;
+			gap.start_year = cursor;
+			gap.end_year = next_start == NumericLimits<int64_t>::Maximum() ? query.end_year : next_start - 1;
+			gaps.push_back(std::move(gap));
+
+			if (next_start == NumericLimits<int64_t>::Maximum()) {
+				break;
+			}
+			cursor = next_start;
+			continue;
+		}
+
+		Slice slice;
+		slice.entry = best;
+		slice.query = query;
+		slice.query.start_year = cursor;
+		slice.query.end_year = MinValue(best->query.end_year, query.end_year);
+		slice.filtered = !(slice.query == best->query);
+		slices.push_back(std::move(slice));
+
+		if (best->query.end_year >= query.end_year) {
+			break;
+		}
+		cursor = best->query.end_year + 1;
+	}
+}
+
+void ResponseCache::Insert(const string &dataflow_key, const DataQuery &query, string body, uint64_t ttl,
+                           idx_t memory_limit) {
+	if (body.size() > memory_limit) {
+		return;
+	}
+	const auto now = std::chrono::steady_clock::now();
+
+	auto entry = make_shared_ptr<Entry>();
+	entry->query = query;
+	entry->body = std::move(body);
+	entry->expires_at = now + std::chrono::seconds(ttl);
+
+	std::lock_guard<std::mutex> guard(lock);
+	auto &dataflow_entries = entries[dataflow_key];
+
+	// Replace the response of the same query.
+	for (auto it = dataflow_entries.begin(); it != dataflow_entries.end(); it++) {
+		if ((*it)->query == query) {
+			memory_usage -= (*it)->body.size();
+			dataflow_entries.erase(it);
+			break;
+		}
+	}
+	entry->last_access = ++access_tick;
+	memory_usage += entry->body.size();
+	dataflow_entries.push_back(std::move(entry));
+
+	Evict(now, memory_limit);
+}
+
+void ResponseCache::Evict(std::chrono::steady_clock::time_point now, idx_t memory_limit) {
+	for (auto &dataflow_entries : entries) {
+		auto &list = dataflow_entries.second;
+
+		for (auto it = list.begin(); it != list.end();) {
+			if ((*it)->expires_at <= now) {
+				memory_usage -= (*it)->body.size();
+				it = list.erase(it);
+			} else {
+				it++;
+			}
+		}
+	}
+	while (memory_usage > memory_limit) {
+		vector<shared_ptr<Entry>> *oldest_list = nullptr;
+		idx_t oldest_index = 0;
+
+		for (auto &dataflow_entries : entries) {
+			auto &list = dataflow_entries.second;
+
+			for (idx_t i = 0; i < list.size(); i++) {
+				if (!oldest_list || list[i]->last_access < (*oldest_list)[oldest_index]->last_access) {
+					oldest_list = &list;
+					oldest_index = i;
+				}
+			}
+		}
+		if (!oldest_list) {
+			break;
+		}
+		memory_usage -= (*oldest_list)[oldest_index]->body.size();
+		oldest_list->erase(oldest_list->begin() + NumericCast<int64_t>(oldest_index));
+	}
+	for (auto it = entries.begin(); it != entries.end();) {
+		it = it->second.empty() ? entries.erase(it) : std::next(it);
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "content_decoder.hpp"
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+//! Query of a data request of a dataflow, as sent to the API: codes of the dimensions of the series key and range
+//! of years of the periods (e.g. "/A.DE+FR..?startPeriod=2010&endPeriod=2020&").
+struct DataQuery {
+	//! Sorted codes of each dimension of the series key, empty for any code.
+	std::vector<std::vector<string>> dim_codes;
+	//! Range of years of the periods, inclusive.
+	int64_t start_year = NumericLimits<int64_t>::Minimum();
+	int64_t end_year = NumericLimits<int64_t>::Maximum();
+
+	//! Parse a filter clause, returns false if it can not be answered from cached responses (e.g. periods which are
+	//! not years).
+	static bool Parse(const string &filter_clause, DataQuery &result);
+	//! Get the filter clause of the query.
+	string GetFilterClause() const;
+
+	//! Check if the series of the query are a superset of the ones of another query.
+	bool CoversSeries(const DataQuery &other) const;
+	//! Check a code of a dimension (by position in the series key), and a time period.
+	bool MatchesCode(idx_t dim_index, const string &code) const;
+	bool MatchesPeriod(const string &time_period) const;
+
+	bool operator==(const DataQuery &other) const;
+};
+
+//! Cache of the responses of the data requests, keyed by dataflow and query. A new query is answered from the cached
+//! responses of queries covering its series, filtered locally, and only the ranges of years they miss are downloaded
+//! (e.g. 2021-2024 after 2010-2020 was cached). Shared by all the scans of the process. Responses are kept compressed
+//! with a fast Zstd level (a fraction of the size of the TSV), and decoded while they are parsed.
+class ResponseCache {
+public:
+	struct Entry {
+		DataQuery query;
+		//! TSV response, Zstd compressed.
+		string body;
+		std::chrono::steady_clock::time_point expires_at;
+		//! Tick of the last lookup using the entry, the least recently used entries are evicted first.
+		idx_t last_access = 0;
+	};
+
+	//! Cached response answering a part of a query, its rows are filtered by the query of the slice.
+	struct Slice {
+		shared_ptr<const Entry> entry;
+		DataQuery query;
+		//! False if the slice is the whole cached response, no filter is needed.
+		bool filtered = true;
+	};
+
+	//! Body of a response to cache, compressed while it is received and dropped if it gets larger than the cache.
+	class BodyWriter {
+	public:
+		explicit BodyWriter(idx_t memory_limit);
+
+		void Append(const char *data, idx_t data_length);
+		//! Get the compressed body, empty if dropped.
+		string Finish();
+
+	private:
+		idx_t memory_limit;
+		string body;
+		bool dropped;
+		unique_ptr<ContentEncoder> encoder;
+	};
+
+	static ResponseCache &Get();
+
+	//! Answer a query of a dataflow: returns the cached slices covering it, and the queries of the missing ranges
+	//! of years to download.
+	void Lookup(const string &dataflow_key, const DataQuery &query, vector<Slice> &slices, vector<DataQuery> &gaps);
+	//! Cache the compressed response of a query for the given time to live (in seconds), evicting the least recently
+	//! used entries above the memory limit (in bytes).
+	void Insert(const string &dataflow_key, const DataQuery &query, string body, uint64_t ttl, idx_t memory_limit);
+
+private:
+	//! Remove the expired entries, and the least recently used ones while the cache is above the memory limit.
+	void Evict(std::chrono::steady_clock::time_point now, idx_t memory_limit);
+
+	std::mutex lock;
+	std::unordered_map<string, vector<shared_ptr<Entry>>> entries;
+	idx_t memory_usage = 0;
+	idx_t access_tick = 0;
+};
+
+} // namespace duckdb
@@ -0,0 +1,286 @@
+#include "row_filter.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include <algorithm>
+
+namespace duckdb {
+
+//======================================================================================================================
+// RowPredicate
+//======================================================================================================================
+
+//! Compare a value with the constant of a comparison, with the semantics of DuckDB (e.g. NaN is the largest value).
+template <class T>
+static bool CompareValues(ExpressionType comparison_type, const T &value, const T &constant) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return Equals::Operation(value, constant);
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return NotEquals::Operation(value, constant);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return LessThan::Operation(value, constant);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return LessThanEquals::Operation(value, constant);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return GreaterThan::Operation(value, constant);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return GreaterThanEquals::Operation(value, constant);
+	default:
+		return true;
+	}
+}
+
+bool RowPredicate::Matches(const string &value) const {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_IN:
+		return values.find(value) != values.end();
+	case ExpressionType::COMPARE_NOT_IN:
+		return values.find(value) == values.end();
+	default:
+		return CompareValues(comparison_type, string_t(value), string_t(text));
+	}
+}
+
+bool RowPredicate::Matches(double value) const {
+	return CompareValues(comparison_type, value, number);
+}
+
+string RowPredicate::ToString(const std::vector<eurostat::Dimension> &data_structure) const {
+	const auto name = column_id < data_structure.size() ? data_structure[column_id].name : "observation_value";
+
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_IN:
+	case ExpressionType::COMPARE_NOT_IN: {
+		std::vector<string> items(values.begin(), values.end());
+		std::sort(items.begin(), items.end());
+		return StringUtil::Format("%s %s ('%s')", name, comparison_type == ExpressionType::COMPARE_IN ? "IN" : "NOT IN",
+		                          StringUtil::Join(items, "', '"));
+	}
+	default: {
+		const auto constant = column_id < data_structure.size() ? "'" + text + "'" : Value::DOUBLE(number).ToString();
+		return StringUtil::Format("%s %s %s", name, ExpressionTypeToOperator(comparison_type), constant);
+	}
+	}
+}
+
+//======================================================================================================================
+// RowFilter
+//======================================================================================================================
+
+shared_ptr<RowFilter> RowFilter::Encode(const vector<unique_ptr<Expression>> &expressions,
+                                        const std::vector<eurostat::Dimension> &data_structure,
+                                        const std::vector<column_t> &column_ids) {
+	auto result = make_shared_ptr<RowFilter>();
+
+	// Unsupported conjuncts are ignored, the filter only has to keep all the rows matching the query.
+	for (const auto &expr : expressions) {
+		result->EncodeExpression(*expr, data_structure, column_ids);
+	}
+	return result;
+}
+
+column_t RowFilter::GetColumn(const Expression &expr, const std::vector<eurostat::Dimension> &data_structure,
+                              const std::vector<column_t> &column_ids) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return DConstants::INVALID_INDEX;
+	}
+	const auto &column_ref = expr.Cast<BoundColumnRefExpression>();
+	const auto binding_index = column_ref.binding.column_index;
+
+	if (binding_index >= column_ids.size() || column_ids[binding_index] > data_structure.size()) {
+		return DConstants::INVALID_INDEX;
+	}
+	return column_ids[binding_index];
+}
+
+bool RowFilter::AddComparison(ExpressionType comparison_type, const Expression &column, const Expression &constant,
+                              const std::vector<eurostat::Dimension> &data_structure,
+                              const std::vector<column_t> &column_ids) {
+	const auto column_id = GetColumn(column, data_structure, column_ids);
+
+	if (column_id == DConstants::INVALID_INDEX || constant.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return false;
+	}
+	const auto &value = constant.Cast<BoundConstantExpression>().value;
+
+	if (value.IsNull()) {
+		return false;
+	}
+	RowPredicate predicate;
+	predicate.column_id = column_id;
+	predicate.comparison_type = comparison_type;
+
+	// Observation value, numeric comparison.
+
+	if (column_id == data_structure.size()) {
+		Value number;
+		string error;
+
+		if (!value.type().IsNumeric() || !value.DefaultTryCastAs(LogicalType::DOUBLE, number, &error)) {
+			return false;
+		}
+		predicate.number = DoubleValue::Get(number);
+		AddPredicate(std::move(predicate), data_structure);
+		return true;
+	}
+
+	// Dimensions and periods, ordering comparisons only over VARCHAR (ENUM values are ordered by position).
+
+	const auto &column_type = column.return_type;
+
+	if (value.type().id() != LogicalTypeId::VARCHAR && value.type().id() != LogicalTypeId::ENUM) {
+		return false;
+	}
+	if (column_type.id() != LogicalTypeId::VARCHAR && comparison_type != ExpressionType::COMPARE_EQUAL &&
+	    comparison_type != ExpressionType::COMPARE_NOTEQUAL) {
+		return false;
+	}
+	predicate.text = value.ToString();
+	AddPredicate(std::move(predicate), data_structure);
+	return true;
+}
+
+void RowFilter::AddPredicate(RowPredicate predicate, const std::vector<eurostat::Dimension> &data_structure) {
+	if (predicate.column_id == data_structure.size()) {
+		value_predicates.push_back(std::move(predicate));
+	} else if (predicate.column_id == data_structure.size() - 1) {
+		period_predicates.push_back(std::move(predicate));
+	} else {
+		series_predicates.push_back(std::move(predicate));
+	}
+}
+
+bool RowFilter::EncodeExpression(const Expression &expr, const std::vector<eurostat::Dimension> &data_structure,
+                                 const std::vector<column_t> &column_ids) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COMPARISON: {
+		const auto &op = expr.Cast<BoundComparisonExpression>();
+
+		switch (op.type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOTEQUAL:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			break;
+		default:
+			return false;
+		}
+
+		// Handle "column OP constant" and "constant OP column" comparisons.
+
+		if (op.left->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+			return AddComparison(op.type, *op.left, *op.right, data_structure, column_ids);
+		}
+		return AddComparison(FlipComparisonExpression(op.type), *op.right, *op.left, data_structure, column_ids);
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
+		const auto &op = expr.Cast<BoundBetweenExpression>();
+
+		const auto lower_type = op.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                           : ExpressionType::COMPARE_GREATERTHAN;
+		const auto upper_type =
+		    op.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
+
+		const auto lower = AddComparison(lower_type, *op.input, *op.lower, data_structure, column_ids);
+		const auto upper = AddComparison(upper_type, *op.input, *op.upper, data_structure, column_ids);
+		return lower && upper;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		const auto &op = expr.Cast<BoundOperatorExpression>();
+
+		// Handle "column [NOT] IN (values)" over dimensions and periods.
+
+		if ((op.type != ExpressionType::COMPARE_IN && op.type != ExpressionType::COMPARE_NOT_IN) ||
+		    op.children.size() < 2) {
+			return false;
+		}
+		const auto column_id = GetColumn(*op.children[0], data_structure, column_ids);
+
+		if (column_id == DConstants::INVALID_INDEX || column_id == data_structure.size()) {
+			return false;
+		}
+		RowPredicate predicate;
+		predicate.column_id = column_id;
+		predicate.comparison_type = op.type;
+
+		for (idx_t i = 1; i < op.children.size(); i++) {
+			const auto &child = *op.children[i];
+
+			if (child.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+				return false;
+			}
+			const auto &value = child.Cast<BoundConstantExpression>().value;
+
+			if (value.IsNull() ||
+			    (value.type().id() != LogicalTypeId::VARCHAR && value.type().id() != LogicalTypeId::ENUM)) {
+				return false;
+			}
+			predicate.values.insert(value.ToString());
+		}
+		AddPredicate(std::move(predicate), data_structure);
+		return true;
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		const auto &op = expr.Cast<BoundConjunctionExpression>();
+
+		if (op.type != ExpressionType::CONJUNCTION_AND) {
+			return false;
+		}
+		bool result = true;
+		for (const auto &child : op.children) {
+			result = EncodeExpression(*child, data_structure, column_ids) && result;
+		}
+		return result;
+	}
+	default:
+		return false;
+	}
+}
+
+bool RowFilter::MatchesSeries(const std::vector<string> &values) const {
+	for (const auto &predicate : series_predicates) {
+		if (!predicate.Matches(values[predicate.column_id])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool RowFilter::MatchesPeriod(const string &time_period) const {
+	for (const auto &predicate : period_predicates) {
+		if (!predicate.Matches(time_period)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool RowFilter::MatchesValue(double value) const {
+	for (const auto &predicate : value_predicates) {
+		if (!predicate.Matches(value)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+string RowFilter::ToString(const std::vector<eurostat::Dimension> &data_structure) const {
+	std::vector<string> items;
+
+	for (const auto predicates : {&series_predicates, &period_predicates, &value_predicates}) {
+		for (const auto &predicate : *predicates) {
+			items.push_back(predicate.ToString(data_structure));
+		}
+	}
+	return StringUtil::Join(items, " AND ");
+}
+
+} // namespace duckdb
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "eurostat.hpp"
+#include "duckdb.hpp"
+#include "duckdb/planner/expression.hpp"
+#include <unordered_set>
+
+namespace duckdb {
+
+//! Comparison of a column of the rows with constant values (e.g. "observation_value > 1000",
+//! "time_period IN ('2010', '2015')").
+struct RowPredicate {
+	//! Column of the data structure, the size of the data structure for the observation value.
+	column_t column_id;
+	//! Comparison (EQUAL, NOT_EQUAL, LESSTHAN..., COMPARE_IN or COMPARE_NOT_IN).
+	ExpressionType comparison_type;
+	//! Constant of the comparisons of dimensions and periods.
+	string text;
+	//! Constant of the comparisons of the observation value.
+	double number = 0;
+	//! Constants of IN comparisons.
+	std::unordered_set<string> values;
+
+	bool Matches(const string &value) const;
+	bool Matches(double value) const;
+	string ToString(const std::vector<eurostat::Dimension> &data_structure) const;
+};
+
+//! Simple residual predicates of the filters of a query that can not be sent to the API, evaluated while parsing the
+//! response so the rows they reject are never stored. DuckDB still evaluates the original filters.
+class RowFilter {
+public:
+	//! Compile the supported conjuncts of the filter expressions, the other ones are ignored.
+	static shared_ptr<RowFilter> Encode(const vector<unique_ptr<Expression>> &expressions,
+	                                    const std::vector<eurostat::Dimension> &data_structure,
+	                                    const std::vector<column_t> &column_ids);
+
+	//! Check the dimension values of a series, indexed by column of the data structure.
+	bool MatchesSeries(const std::vector<string> &values) const;
+	//! Check a time period.
+	bool MatchesPeriod(const string &time_period) const;
+	//! Check an observation value.
+	bool MatchesValue(double value) const;
+
+	bool IsEmpty() const {
+		return series_predicates.empty() && period_predicates.empty() && value_predicates.empty();
+	}
+	string ToString(const std::vector<eurostat::Dimension> &data_structure) const;
+
+private:
+	//! Compile an expression, returns false if it is not supported.
+	bool EncodeExpression(const Expression &expr, const std::vector<eurostat::Dimension> &data_structure,
+	                      const std::vector<column_t> &column_ids);
+	//! Add a comparison of a column with a constant.
+	bool AddComparison(ExpressionType comparison_type, const Expression &column, const Expression &constant,
+	                   const std::vector<eurostat::Dimension> &data_structure, const std::vector<column_t> &column_ids);
+	//! Get the column of the data structure referenced by an expression, INVALID_INDEX if not supported.
+	static column_t GetColumn(const Expression &expr, const std::vector<eurostat::Dimension> &data_structure,
+	                          const std::vector<column_t> &column_ids);
+	void AddPredicate(RowPredicate predicate, const std::vector<eurostat::Dimension> &data_structure);
+
+private:
+	std::vector<RowPredicate> series_predicates;
+	std::vector<RowPredicate> period_predicates;
+	std::vector<RowPredicate> value_predicates;
+};
+
+} // namespace duckdb
@@ -0,0 +1,379 @@
+#include "shared_cache.hpp"
+
+#include "duckdb/common/allocator.hpp"
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <thread>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <cerrno>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+//======================================================================================================================
+// Helper Functions
+//======================================================================================================================
+
+// Signature of the first line of the cached files, followed by the key of the response
+static constexpr const char *SHARED_CACHE_SIGNATURE = "EUROSTAT-CACHE\t1\t";
+
+// Size of the read buffer of the cached files
+static constexpr idx_t SHARED_CACHE_BUFFER_SIZE = 256 * 1024;
+
+// Zstd level of the cached files, fast enough to compress while downloading
+static constexpr int SHARED_CACHE_ZSTD_LEVEL = 1;
+
+// Interval between the refreshes of the heartbeat of a lease, and age of the heartbeat after which the lease is
+// considered abandoned (longer than the HTTP timeout of the data requests, which refresh it when data arrives)
+static constexpr auto SHARED_CACHE_HEARTBEAT_INTERVAL = std::chrono::seconds(10);
+static constexpr int64_t SHARED_CACHE_HEARTBEAT_TIMEOUT = 2 * 60;
+
+// Interval between the checks of a lease held by another process
+static constexpr auto SHARED_CACHE_WAIT_INTERVAL = std::chrono::milliseconds(100);
+
+static int64_t GetProcessId() {
+#ifdef _WIN32
+	return static_cast<int64_t>(_getpid());
+#else
+	return static_cast<int64_t>(getpid());
+#endif
+}
+
+//! Check if a process of the PID namespace is running.
+static bool IsProcessRunning(int64_t pid) {
+#ifdef _WIN32
+	return true;
+#else
+	return pid <= 0 || kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+#endif
+}
+
+// Namespace of the processes whose PID namespace is unknown, their PIDs are never checked
+static constexpr const char *SHARED_CACHE_UNKNOWN_NAMESPACE = "-";
+
+//! Get the identifier of the PID namespace of the process (boot of the host, and namespace of its container).
+//! Processes of other namespaces (e.g. containers of a host sharing the directory) can not see each other.
+static const string &GetProcessNamespace() {
+	static const string process_namespace = []() {
+		string result;
+#ifdef __linux__
+		std::ifstream boot_id("/proc/sys/kernel/random/boot_id");
+		std::getline(boot_id, result);
+
+		char link[128];
+		const auto link_length = readlink("/proc/self/ns/pid", link, sizeof(link));
+		if (!result.empty() && link_length > 0) {
+			return result + "/" + string(link, NumericCast<idx_t>(link_length));
+		}
+#endif
+		return string(SHARED_CACHE_UNKNOWN_NAMESPACE);
+	}();
+	return process_namespace;
+}
+
+//! Get the content of a lease file: its holder ("<namespace>\t<pid>\t<serial>") and its heartbeat (time of its last
+//! refresh), always written with the same length so it can be rewritten in place.
+static string GetLeaseContent(const string &owner) {
+	return owner + "\t" + StringUtil::Format("%020lld", static_cast<long long>(std::time(nullptr))) + "\n";
+}
+
+//======================================================================================================================
+// SharedCacheDirectory Implementation
+//======================================================================================================================
+
+SharedCacheDirectory::SharedCacheDirectory(FileSystem &fs, string directory_p, optional_ptr<FileOpener> opener)
+    : fs(fs), directory(std::move(directory_p)), opener(opener), remote(FileSystem::IsRemoteFile(directory)) {
+	if (!remote && !fs.DirectoryExists(directory, opener)) {
+		fs.CreateDirectory(directory, opener);
+	}
+}
+
+string SharedCacheDirectory::GetPath(const string &key, const string &extension) const {
+	const auto hash = Hash(key.c_str(), key.size());
+	return fs.JoinPath(directory, StringUtil::Format("%016llx", static_cast<unsigned long long>(hash)) + extension);
+}
+
+bool SharedCacheDirectory::Read(const string &key, const HttpContentReceiver &receiver) {
+	auto handle = fs.OpenFile(GetPath(key, ".tsv.zst"),
+	                          FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS, opener);
+
+	if (!handle) {
+		return false;
+	}
+	auto buffer = Allocator::DefaultAllocator().Allocate(SHARED_CACHE_BUFFER_SIZE);
+	auto data = reinterpret_cast<char *>(buffer.get());
+
+	// Check the key of the file (hash collisions), then decode its content.
+
+	const string signature = SHARED_CACHE_SIGNATURE + key + "\n";
+	idx_t data_length = 0;
+
+	while (data_length < signature.size()) {
+		const auto read_bytes = handle->Read(data + data_length, SHARED_CACHE_BUFFER_SIZE - data_length);
+
+		if (read_bytes <= 0) {
+			return false;
+		}
+		data_length += NumericCast<idx_t>(read_bytes);
+	}
+	if (memcmp(data, signature.data(), signature.size()) != 0) {
+		return false;
+	}
+
+	ContentDecoder decoder(receiver);
+
+	if (!decoder.Write(data + signature.size(), data_length - signature.size())) {
+		return true;
+	}
+	while (true) {
+		const auto read_bytes = handle->Read(data, SHARED_CACHE_BUFFER_SIZE);
+
+		if (read_bytes <= 0) {
+			break;
+		}
+		if (!decoder.Write(data, NumericCast<idx_t>(read_bytes))) {
+			return true;
+		}
+	}
+	decoder.Finish();
+	return true;
+}
+
+unique_ptr<SharedCacheDirectory::Lease> SharedCacheDirectory::TryLease(const string &key) {
+	const auto lease_path = GetPath(key, ".lease");
+
+	for (idx_t attempt = 0; attempt < 2; attempt++) {
+		auto handle = fs.OpenFile(lease_path,
+		                          FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_EXCLUSIVE_CREATE |
+		                              FileFlags::FILE_FLAGS_NULL_IF_EXISTS,
+		                          opener);
+		if (handle) {
+			static std::atomic<idx_t> lease_counter {0};
+
+			auto owner = GetProcessNamespace() + "\t" + std::to_string(GetProcessId()) + "\t" +
+			             std::to_string(lease_counter++);
+			auto content = GetLeaseContent(owner);
+			handle->Write(const_cast<char *>(content.data()), content.size());
+			handle->Close();
+			return make_uniq<Lease>(*this, lease_path, std::move(owner));
+		}
+
+		// Take over the leases of the dead (or stuck) processes.
+		const auto content = ReadLease(lease_path);
+		if (!IsStaleLease(content) || !RemoveStaleLease(lease_path, content)) {
+			return nullptr;
+		}
+	}
+	return nullptr;
+}
+
+void SharedCacheDirectory::WaitLease(const string &key, const std::atomic<bool> &canceled) {
+	const auto lease_path = GetPath(key, ".lease");
+
+	while (!canceled && fs.FileExists(lease_path, opener)) {
+		const auto content = ReadLease(lease_path);
+
+		if (IsStaleLease(content)) {
+			RemoveStaleLease(lease_path, content);
+			return;
+		}
+		std::this_thread::sleep_for(SHARED_CACHE_WAIT_INTERVAL);
+	}
+}
+
+string SharedCacheDirectory::ReadLease(const string &lease_path) {
+	auto handle =
+	    fs.OpenFile(lease_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS, opener);
+
+	if (!handle) {
+		return string();
+	}
+	char content[256];
+	const auto read_bytes = handle->Read(content, sizeof(content) - 1);
+	return string(content, NumericCast<idx_t>(MaxValue<int64_t>(read_bytes, 0)));
+}
+
+bool SharedCacheDirectory::RemoveStaleLease(const string &lease_path, const string &content) {
+	static std::atomic<idx_t> stale_counter {0};
+
+	// Rename the lease to a unique name first, so a single process takes it over, then check it is still the stale
+	// one: another process may have taken it over and created a fresh lease meanwhile, which is put back.
+
+	const auto stale_path =
+	    lease_path + "." + std::to_string(GetProcessId()) + "." + std::to_string(stale_counter++) + ".stale";
+	try {
+		fs.MoveFile(lease_path, stale_path, opener);
+	} catch (std::exception &) {
+		return false;
+	}
+	if (ReadLease(stale_path) != content) {
+		try {
+			if (!fs.FileExists(lease_path, opener)) {
+				fs.MoveFile(stale_path, lease_path, opener);
+				return false;
+			}
+		} catch (std::exception &) {
+		}
+	}
+	fs.TryRemoveFile(stale_path, opener);
+	return true;
+}
+
+bool SharedCacheDirectory::IsStaleLease(const string &content) {
+	// Missing, or being written, not stale yet.
+	const auto parts = StringUtil::Split(content, '\t');
+	if (parts.size() < 4 || content.back() != '\n') {
+		return false;
+	}
+	const auto heartbeat = std::strtoll(parts[3].c_str(), nullptr, 10);
+
+	if (std::time(nullptr) - heartbeat > SHARED_CACHE_HEARTBEAT_TIMEOUT) {
+		return true;
+	}
+
+	// The PID of the holder is only meaningful in its namespace (PIDs of other containers are unknown here), then a
+	// dead process does not need to wait for the heartbeat timeout. A reused PID is caught by the heartbeat.
+	const auto &process_namespace = GetProcessNamespace();
+	return process_namespace != SHARED_CACHE_UNKNOWN_NAMESPACE && parts[0] == process_namespace &&
+	       !IsProcessRunning(std::strtoll(parts[1].c_str(), nullptr, 10));
+}
+
+unique_ptr<SharedCacheDirectory::Writer> SharedCacheDirectory::CreateWriter(const string &key) {
+	static std::atomic<idx_t> temp_counter {0};
+
+	const auto path = GetPath(key, ".tsv.zst");
+	const auto temp_path = path + "." + std::to_string(GetProcessId()) + "." + std::to_string(temp_counter++) + ".tmp";
+	try {
+		return make_uniq<Writer>(*this, key, temp_path, path);
+	} catch (std::exception &) {
+		return nullptr;
+	}
+}
+
+//======================================================================================================================
+// Lease Implementation
+//======================================================================================================================
+
+SharedCacheDirectory::Lease::Lease(SharedCacheDirectory &directory, string path_p, string owner_p)
+    : directory(directory), path(std::move(path_p)), owner(std::move(owner_p)),
+      refreshed_at(std::chrono::steady_clock::now()) {
+}
+
+SharedCacheDirectory::Lease::~Lease() {
+	try {
+		// Taken over as stale (e.g. no data received for the heartbeat timeout), the lease is not ours anymore.
+		if (IsHeld()) {
+			directory.fs.TryRemoveFile(path, directory.opener);
+		}
+	} catch (...) {
+	}
+}
+
+bool SharedCacheDirectory::Lease::IsHeld() {
+	return StringUtil::StartsWith(directory.ReadLease(path), owner + "\t");
+}
+
+void SharedCacheDirectory::Lease::Refresh() {
+	const auto now = std::chrono::steady_clock::now();
+
+	if (now - refreshed_at < SHARED_CACHE_HEARTBEAT_INTERVAL) {
+		return;
+	}
+	refreshed_at = now;
+
+	// Rewrite the heartbeat in place (same length), readers never see a truncated lease.
+	try {
+		if (!IsHeld()) {
+			return;
+		}
+		auto content = GetLeaseContent(owner);
+		auto handle = directory.fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE, directory.opener);
+		handle->Write(const_cast<char *>(content.data()), content.size(), 0);
+		handle->Close();
+	} catch (...) {
+	}
+}
+
+//======================================================================================================================
+// Writer Implementation
+//======================================================================================================================
+
+SharedCacheDirectory::Writer::Writer(SharedCacheDirectory &directory, const string &key, string temp_path_p,
+                                     string path_p)
+    : directory(directory), temp_path(std::move(temp_path_p)), path(std::move(path_p)), committed(false),
+      failed(false) {
+	handle = directory.fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW,
+	                               directory.opener);
+
+	// The destructor does not run when the constructor throws, remove the temporary file here.
+	try {
+		auto signature = SHARED_CACHE_SIGNATURE + key + "\n";
+		handle->Write(const_cast<char *>(signature.data()), signature.size());
+
+		auto &file = *handle;
+		encoder = make_uniq<ContentEncoder>(
+		    [&file](const char *data, size_t data_length) {
+			    file.Write(const_cast<char *>(data), data_length);
+			    return true;
+		    },
+		    SHARED_CACHE_ZSTD_LEVEL);
+	} catch (...) {
+		try {
+			handle.reset();
+			directory.fs.TryRemoveFile(temp_path, directory.opener);
+		} catch (...) {
+		}
+		throw;
+	}
+}
+
+SharedCacheDirectory::Writer::~Writer() {
+	if (!committed) {
+		try {
+			handle.reset();
+			directory.fs.TryRemoveFile(temp_path, directory.opener);
+		} catch (...) {
+		}
+	}
+}
+
+void SharedCacheDirectory::Writer::Append(const char *data, idx_t data_length) {
+	if (failed) {
+		return;
+	}
+	try {
+		encoder->Write(data, data_length);
+	} catch (std::exception &) {
+		failed = true;
+	}
+}
+
+bool SharedCacheDirectory::Writer::Commit() {
+	if (failed) {
+		return false;
+	}
+	try {
+		encoder->Finish();
+		if (!directory.remote) {
+			handle->Sync();
+		}
+		handle->Close();
+		handle.reset();
+
+		// Publish the file atomically, readers see the whole response or nothing.
+		directory.fs.MoveFile(temp_path, path, directory.opener);
+		committed = true;
+	} catch (std::exception &) {
+		failed = true;
+	}
+	return committed;
+}
+
+} // namespace duckdb
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "content_decoder.hpp"
+#include <atomic>
+#include <chrono>
+
+namespace duckdb {
+
+//! Directory of the responses of the data requests, shared by the DuckDB processes of a host (e.g. workers behind an
+//! API). Each response is an immutable file named by the hash of its key, compressed with Zstd and published
+//! atomically (written to a temporary file, then renamed), so readers never see partial files and need no index.
+//! A lease file, created exclusively, lets a single process download a missing response while the others wait.
+//! The directory can also be remote (any path of the DuckDB file systems, e.g. "s3://bucket/eurostat"), shared by
+//! the nodes of a cluster, leases are then not used.
+class SharedCacheDirectory {
+public:
+	SharedCacheDirectory(FileSystem &fs, string directory, optional_ptr<FileOpener> opener = nullptr);
+
+	//! Lease of a key held by this process, removed when destroyed (unless another process took it over). Its
+	//! heartbeat must be refreshed while the response is downloaded, otherwise the lease becomes stale.
+	class Lease {
+	public:
+		Lease(SharedCacheDirectory &directory, string path, string owner);
+		~Lease();
+
+		//! Refresh the heartbeat of the lease, at most once per heartbeat interval (cheap to call for every chunk).
+		void Refresh();
+
+	private:
+		//! Whether the lease file is still held by this lease.
+		bool IsHeld();
+
+		SharedCacheDirectory &directory;
+		string path;
+		//! Holder of the lease, the first fields of the lease file (see TryLease).
+		string owner;
+		std::chrono::steady_clock::time_point refreshed_at;
+	};
+
+	//! Writer of a response, compressed while it is received and published when committed (removed otherwise).
+	//! Write errors (e.g. a full disk) are not reported, the response is just not published.
+	class Writer {
+	public:
+		Writer(SharedCacheDirectory &directory, const string &key, string temp_path, string path);
+		~Writer();
+
+		void Append(const char *data, idx_t data_length);
+		//! Publish the response, returns false if it could not be written.
+		bool Commit();
+
+	private:
+		SharedCacheDirectory &directory;
+		string temp_path;
+		string path;
+		unique_ptr<FileHandle> handle;
+		unique_ptr<ContentEncoder> encoder;
+		bool committed;
+		bool failed;
+	};
+
+	//! Stream the cached response of a key to the receiver, returns false if it is missing.
+	bool Read(const string &key, const HttpContentReceiver &receiver);
+
+	//! Take the lease to download a key, nullptr if another process holds it.
+	unique_ptr<Lease> TryLease(const string &key);
+	//! Wait until the lease of a key is released by its holder, or is stale (the holder died or stopped refreshing
+	//! its heartbeat).
+	void WaitLease(const string &key, const std::atomic<bool> &canceled);
+
+	//! Create the writer of the response of a key, nullptr if its temporary file can not be created.
+	unique_ptr<Writer> CreateWriter(const string &key);
+
+private:
+	//! Get the path of a file of a key (e.g. "<directory>/<hash>.tsv.zst").
+	string GetPath(const string &key, const string &extension) const;
+	//! Read the content of a lease file, empty if it is missing.
+	string ReadLease(const string &lease_path);
+	//! Check if the content of a lease file is stale: its heartbeat is older than the heartbeat timeout, or its
+	//! process is not running anymore (only known for the processes of the same PID namespace).
+	static bool IsStaleLease(const string &content);
+	//! Remove a stale lease file if it still has the given content, returns false if another process took it over.
+	bool RemoveStaleLease(const string &lease_path, const string &content);
+
+	FileSystem &fs;
+	string directory;
+	//! Opener of the files, to read the settings and secrets of remote file systems.
+	optional_ptr<FileOpener> opener;
+	//! Remote file systems can not sync files.
+	bool remote;
+};
+
+} // namespace duckdb
@@ -4,16 +4,104 @@
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
 
 // EUROSTAT
 #include "eurostat/eurostat_data_functions.hpp"
 #include "eurostat/eurostat_info_functions.hpp"
 #include "eurostat/eurostat_scalar_functions.hpp"
+#include "eurostat/request_scheduler.hpp"
 
 namespace duckdb {
 
+static void SetHttpTransport(ClientContext &context, SetScope scope, Value &parameter) {
+	const auto transport = StringUtil::Lower(StringValue::Get(parameter));
+
+	if (transport != "httplib" && transport != "curl") {
+		throw InvalidInputException("EUROSTAT: Unknown HTTP transport '%s', expected 'httplib' or 'curl'.", transport);
+	}
+}
+
+static void SetRequestPriority(ClientContext &context, SetScope scope, Value &parameter) {
+	RequestScheduler::ParseDataPriority(StringValue::Get(parameter));
+}
+
+static void SetResponseCacheSize(ClientContext &context, SetScope scope, Value &parameter) {
+	DBConfig::ParseMemoryLimit(StringValue::Get(parameter));
+}
+
+static void SetParsedCacheSize(ClientContext &context, SetScope scope, Value &parameter) {
+	const auto cache_size = DBConfig::ParseMemoryLimit(StringValue::Get(parameter));
+	const auto memory_limit = BufferManager::GetBufferManager(context).GetMaxMemory();
+
+	// Parsed responses are kept in the memory of the database.
+	if (cache_size > memory_limit) {
+		throw InvalidInputException("EUROSTAT: The parsed cache size (%s) can not exceed the memory_limit (%s).",
+		                            StringUtil::BytesToHumanReadableString(cache_size),
+		                            StringUtil::BytesToHumanReadableString(memory_limit));
+	}
+}
+
+static void RegisterSettings(ExtensionLoader &loader) {
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+
+	config.AddExtensionOption("eurostat_http_transport",
+	                          "HTTP transport used to fetch EUROSTAT data: 'httplib' (one request per connection) or "
+	                          "'curl' (requests multiplexed over HTTP/2 connections)",
+	                          LogicalType::VARCHAR, Value("httplib"), SetHttpTransport);
+
+	config.AddExtensionOption("eurostat_http_hedging",
+	                          "Hedge EUROSTAT requests without response after a high percentile of the recent "
+	                          "latencies of their host, the first response wins (curl transport only)",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+
+	config.AddExtensionOption("eurostat_request_priority",
+	                          "Priority class of the EUROSTAT data requests of the session: 'interactive' or 'bulk' "
+	                          "(e.g. nightly syncs). Metadata requests are always served first",
+	                          LogicalType::VARCHAR, Value("interactive"), SetRequestPriority);
+
+	config.AddExtensionOption("eurostat_negative_cache_ttl",
+	                          "Time to live, in seconds, of the cached negative results of EUROSTAT requests (unknown "
+	                          "dataflows, filters without data), answered locally meanwhile. 0 disables the cache",
+	                          LogicalType::UBIGINT, Value::UBIGINT(60));
+
+	config.AddExtensionOption("eurostat_response_cache_ttl",
+	                          "Time to live, in seconds, of the cached responses of EUROSTAT_Read, used to answer the "
+	                          "requests whose data they cover. 0 disables the cache",
+	                          LogicalType::UBIGINT, Value::UBIGINT(3600));
+
+	config.AddExtensionOption("eurostat_response_cache_size",
+	                          "Maximum memory of the cached responses of EUROSTAT_Read (e.g. '256MB'), kept compressed "
+	                          "and shared by all the connections of the process",
+	                          LogicalType::VARCHAR, Value("256MB"), SetResponseCacheSize);
+
+	config.AddExtensionOption("eurostat_parsed_cache_size",
+	                          "Maximum memory of the parsed responses of EUROSTAT_Read kept by the database (e.g. "
+	                          "'256MB'), read again without download nor parsing while the dataflow is not updated",
+	                          LogicalType::VARCHAR, Value("256MB"), SetParsedCacheSize);
+
+	config.AddExtensionOption("eurostat_cache_directory",
+	                          "Directory of the responses of EUROSTAT_Read shared by the processes of the host (e.g. "
+	                          "workers of an API), a single process downloads each response. Empty disables it",
+	                          LogicalType::VARCHAR, Value(""));
+
+	config.AddExtensionOption("eurostat_remote_cache_directory",
+	                          "Second-level directory of the responses of EUROSTAT_Read, any path of the DuckDB file "
+	                          "systems (e.g. 's3://bucket/eurostat' or NFS) shared by a cluster. Empty disables it",
+	                          LogicalType::VARCHAR, Value(""));
+
+	config.AddExtensionOption("eurostat_constraint_pruning",
+	                          "Check the filters of EUROSTAT_Read against the contentconstraint of the dataflow, "
+	                          "skipping the requests that can not match any code or period",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+}
+
 static void LoadInternal(ExtensionLoader &loader) {
+	// Register settings
+	RegisterSettings(loader);
+
 	// Register functions
 	EurostatDataFunctions::Register(loader);
 	EurostatInfoFunctions::Register(loader);